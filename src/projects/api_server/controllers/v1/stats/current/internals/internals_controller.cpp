@@ -8,6 +8,10 @@
 //==============================================================================
 #include "internals_controller.h"
 
+#include <modules/containers/bmff/fmp4_packager/fmp4_dvr_writer.h>
+#include <modules/http/server/http_compression_cache.h>
+#include <orchestrator/orchestrator.h>
+
 namespace api
 {
 	namespace v1
@@ -18,6 +22,11 @@ namespace api
 			{
 				RegisterGet(R"()", &InternalsController::OnGetInternals);
 				RegisterGet(R"(\/queues)", &InternalsController::OnGetQueues);
+				RegisterGet(R"(\/workers)", &InternalsController::OnGetWorkers);
+				RegisterGet(R"(\/sockets)", &InternalsController::OnGetSockets);
+				RegisterGet(R"(\/pulls)", &InternalsController::OnGetPulls);
+				RegisterGet(R"(\/dvrWriter)", &InternalsController::OnGetDvrWriter);
+				RegisterGet(R"(\/httpCompression)", &InternalsController::OnGetHttpCompression);
 			};
 
 			ApiResponse InternalsController::OnGetInternals(const std::shared_ptr<http::svr::HttpExchange> &client)
@@ -25,6 +34,11 @@ namespace api
 				Json::Value response(Json::ValueType::arrayValue);
 
 				response.append("/v1/stats/current/internals/queues");
+				response.append("/v1/stats/current/internals/workers");
+				response.append("/v1/stats/current/internals/sockets");
+				response.append("/v1/stats/current/internals/pulls");
+				response.append("/v1/stats/current/internals/dvrWriter");
+				response.append("/v1/stats/current/internals/httpCompression");
 
 				return response;
 			}
@@ -47,6 +61,82 @@ namespace api
 
 				return response;
 			}
+
+			ApiResponse InternalsController::OnGetWorkers(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response(Json::ValueType::arrayValue);
+
+				auto serverMetric = MonitorInstance->GetServerMetrics();
+
+				for (auto &[worker_id, metrics] : serverMetric->GetWorkerMetricsList())
+				{
+					Json::Value obj = serdes::JsonFromWorkerMetrics(metrics);
+
+					if (obj.isNull())
+						continue;
+
+					response.append(obj);
+				}
+
+				return response;
+			}
+
+			ApiResponse InternalsController::OnGetSockets(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response(Json::ValueType::objectValue);
+
+				response["udpBatch"] = serdes::JsonFromSocketBatchStats(ov::SocketBatchStats::GetInstance());
+				response["tcpBatch"] = serdes::JsonFromSocketStreamBatchStats(ov::SocketBatchStats::GetInstance());
+
+				return response;
+			}
+
+			ApiResponse InternalsController::OnGetPulls(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response(Json::ValueType::objectValue);
+
+				auto stats = ocst::Orchestrator::GetInstance()->GetPullRequestStats();
+
+				response["pullCount"] = static_cast<Json::UInt64>(stats.pull_count);
+				response["coalescedWaiterCount"] = static_cast<Json::UInt64>(stats.coalesced_waiter_count);
+				response["totalSetupTimeMsec"] = static_cast<Json::UInt64>(stats.total_setup_time_msec);
+				response["maxSetupTimeMsec"] = static_cast<Json::UInt64>(stats.max_setup_time_msec);
+				response["pendingPullCount"] = static_cast<Json::UInt64>(stats.pending_pull_count);
+
+				return response;
+			}
+
+			ApiResponse InternalsController::OnGetDvrWriter(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response(Json::ValueType::objectValue);
+
+				auto stats = bmff::FMP4DvrWriter::GetInstance()->GetStats();
+
+				response["queuedJobs"] = static_cast<Json::UInt64>(stats.queued_jobs);
+				response["queuedBytes"] = static_cast<Json::UInt64>(stats.queued_bytes);
+				response["peakQueuedJobs"] = static_cast<Json::UInt64>(stats.peak_queued_jobs);
+				response["completedJobs"] = static_cast<Json::UInt64>(stats.completed_jobs);
+				response["completedBytes"] = static_cast<Json::UInt64>(stats.completed_bytes);
+				response["blockedCount"] = static_cast<Json::UInt64>(stats.blocked_count);
+				response["blockedTimeMsec"] = static_cast<Json::UInt64>(stats.blocked_time_ms);
+
+				return response;
+			}
+
+			ApiResponse InternalsController::OnGetHttpCompression(const std::shared_ptr<http::svr::HttpExchange> &client)
+			{
+				Json::Value response(Json::ValueType::objectValue);
+
+				auto stats = http::svr::HttpCompressionCache::GetInstance()->GetStats();
+
+				response["hitCount"] = static_cast<Json::UInt64>(stats.hit_count);
+				response["missCount"] = static_cast<Json::UInt64>(stats.miss_count);
+				response["evictionCount"] = static_cast<Json::UInt64>(stats.eviction_count);
+				response["entryCount"] = static_cast<Json::UInt64>(stats.entry_count);
+				response["cachedBytes"] = static_cast<Json::UInt64>(stats.cached_bytes);
+
+				return response;
+			}
 		}  // namespace stats
 	}  // namespace v1
 }  // namespace api
\ No newline at end of file
@@ -24,6 +24,11 @@ namespace api
 			protected:
 				ApiResponse OnGetInternals(const std::shared_ptr<http::svr::HttpExchange> &client);
 				ApiResponse OnGetQueues(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetWorkers(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetSockets(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetPulls(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetDvrWriter(const std::shared_ptr<http::svr::HttpExchange> &client);
+				ApiResponse OnGetHttpCompression(const std::shared_ptr<http::svr::HttpExchange> &client);
 			};
 		}  // namespace stats
 	}  // namespace v1
@@ -6,8 +6,9 @@
 //  Copyright (c) 2022 AirenSoft. All rights reserved.
 //
 //==============================================================================
-#include "./string.h"
+#include "./files.h"
 #include <iostream>
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <errno.h>
 #include <ftw.h>
@@ -209,4 +210,93 @@ namespace ov
 
 		return true;
 	}
-}
\ No newline at end of file
+
+	std::shared_ptr<ReadOnlyFile> ReadOnlyFile::Open(const ov::String &path)
+	{
+		int fd = ::open(path.CStr(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+		{
+			return nullptr;
+		}
+
+		struct stat info;
+		if ((::fstat(fd, &info) != 0) || (S_ISREG(info.st_mode) == false))
+		{
+			::close(fd);
+			return nullptr;
+		}
+
+		return std::make_shared<ReadOnlyFile>(fd, path, info.st_size, info.st_mtime);
+	}
+
+	ReadOnlyFile::ReadOnlyFile(int fd, const ov::String &path, size_t size, int64_t modified_time)
+		: _fd(fd),
+		  _path(path),
+		  _size(size),
+		  _modified_time(modified_time)
+	{
+	}
+
+	ReadOnlyFile::~ReadOnlyFile()
+	{
+		if (_fd >= 0)
+		{
+			::close(_fd);
+		}
+	}
+
+	int ReadOnlyFile::GetNativeHandle() const
+	{
+		return _fd;
+	}
+
+	const ov::String &ReadOnlyFile::GetPath() const
+	{
+		return _path;
+	}
+
+	size_t ReadOnlyFile::GetSize() const
+	{
+		return _size;
+	}
+
+	int64_t ReadOnlyFile::GetModifiedTime() const
+	{
+		return _modified_time;
+	}
+
+	std::shared_ptr<Data> ReadOnlyFile::Read(off_t offset, size_t length) const
+	{
+		auto data = std::make_shared<Data>(length);
+		data->SetLength(length);
+
+		size_t total_read = 0;
+
+		while (total_read < length)
+		{
+			auto read_bytes = ::pread(_fd, data->GetWritableDataAs<uint8_t>() + total_read, length - total_read, offset + total_read);
+
+			if (read_bytes < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				return nullptr;
+			}
+
+			if (read_bytes == 0)
+			{
+				// EOF
+				break;
+			}
+
+			total_read += read_bytes;
+		}
+
+		data->SetLength(total_read);
+
+		return data;
+	}
+}
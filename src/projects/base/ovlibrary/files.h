@@ -9,6 +9,7 @@
 #pragma once
 
 #include "./string.h"
+#include "./data.h"
 #include <iostream>
 #include <sys/stat.h>
 #include <errno.h>
@@ -32,4 +33,31 @@ namespace ov
 	ov::String GetFileNameWithoutExt(const ov::String &path);
 
 	bool DeleteFile(const ov::String &path);
+
+	// Read-only file which can be shared by several readers (e.g. sent with sendfile(2) from the socket dispatch queue)
+	//
+	// The file descriptor is closed when the last reference is released, so the file can be read even if it is deleted after Open()
+	class ReadOnlyFile
+	{
+	public:
+		static std::shared_ptr<ReadOnlyFile> Open(const ov::String &path);
+
+		ReadOnlyFile(int fd, const ov::String &path, size_t size, int64_t modified_time);
+		~ReadOnlyFile();
+
+		int GetNativeHandle() const;
+		const ov::String &GetPath() const;
+		size_t GetSize() const;
+		// Seconds since epoch
+		int64_t GetModifiedTime() const;
+
+		// Reads up to `length` bytes at `offset` using pread(2)
+		std::shared_ptr<Data> Read(off_t offset, size_t length) const;
+
+	private:
+		int _fd = -1;
+		ov::String _path;
+		size_t _size = 0;
+		int64_t _modified_time = 0;
+	};
 }
\ No newline at end of file
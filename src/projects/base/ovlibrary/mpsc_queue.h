@@ -0,0 +1,120 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <atomic>
+#include <optional>
+
+namespace ov
+{
+	// Lock-free multi-producer single-consumer queue (Dmitry Vyukov's non-intrusive MPSC node-based queue)
+	//
+	// - Push() can be called from any thread (wait-free, one exchange per item)
+	// - Pop() must be called from one thread at a time (e.g. with the consumer's own lock held)
+	// - The items pushed by a thread are popped in the order they were pushed
+	//
+	// Pop() may return std::nullopt while a producer is in the middle of Push() even though GetCount() is not 0,
+	// since the item is linked after it is published. The producer is expected to notify the consumer after Push().
+	template <typename T>
+	class MpscQueue
+	{
+	public:
+		MpscQueue()
+			: _head(&_stub),
+			  _tail(&_stub)
+		{
+		}
+
+		~MpscQueue()
+		{
+			while (Pop().has_value())
+			{
+			}
+
+			// The last popped node is used as the stub
+			if (_tail != &_stub)
+			{
+				delete _tail;
+			}
+		}
+
+		MpscQueue(const MpscQueue &) = delete;
+		MpscQueue &operator=(const MpscQueue &) = delete;
+
+		void Push(T item)
+		{
+			auto node = new Node(std::move(item));
+
+			_count.fetch_add(1, std::memory_order_relaxed);
+
+			auto prev = _head.exchange(node, std::memory_order_acq_rel);
+			prev->next.store(node, std::memory_order_release);
+		}
+
+		std::optional<T> Pop()
+		{
+			auto tail = _tail;
+			auto next = tail->next.load(std::memory_order_acquire);
+
+			if (next == nullptr)
+			{
+				return std::nullopt;
+			}
+
+			// `next` becomes the new stub, so its value is moved out
+			std::optional<T> item(std::move(next->value));
+			next->value.reset();
+
+			_tail = next;
+
+			if (tail != &_stub)
+			{
+				delete tail;
+			}
+
+			_count.fetch_sub(1, std::memory_order_relaxed);
+
+			return item;
+		}
+
+		// The number of items which are pushed but not popped yet (including the items being pushed)
+		size_t GetCount() const
+		{
+			return _count.load(std::memory_order_relaxed);
+		}
+
+		bool IsEmpty() const
+		{
+			return GetCount() == 0;
+		}
+
+	private:
+		struct Node
+		{
+			Node() = default;
+
+			explicit Node(T &&item)
+				: value(std::move(item))
+			{
+			}
+
+			std::atomic<Node *> next{nullptr};
+			std::optional<T> value;
+		};
+
+		Node _stub;
+
+		// Producers append the nodes to the head
+		alignas(64) std::atomic<Node *> _head;
+		// The consumer takes the nodes from the tail
+		alignas(64) Node *_tail;
+
+		std::atomic<size_t> _count{0};
+	};
+}  // namespace ov
@@ -25,6 +25,7 @@
 #include "./json.h"
 #include "./log.h"
 #include "./memory_utilities.h"
+#include "./mpsc_queue.h"
 #include "./map_utilities.h"
 #include "./ovdata_structure.h"
 #include "./path_manager.h"
@@ -97,33 +97,54 @@ namespace ov
 	{
 		logtp("Trying to read UDP packets...");
 
-		auto data = std::make_shared<ov::Data>(UdpBufferSize);
+		// OnReadable() is called only from the thread of SocketPoolWorker, so the buffers don't need to be protected
+		if (_recv_buffers.empty())
+		{
+			_recv_buffers.reserve(OV_SOCKET_MAX_RECV_DATAGRAM_BATCH);
 
-		SocketAddressPair address_pair;
+			for (int index = 0; index < OV_SOCKET_MAX_RECV_DATAGRAM_BATCH; index++)
+			{
+				_recv_buffers.push_back(std::make_shared<Data>(UdpBufferSize));
+			}
+		}
 
 		while (true)
 		{
-			auto error = RecvFrom(data, &address_pair);
+			size_t received_count = 0;
+			auto error = RecvFromMultiple(_recv_buffers, _recv_address_pairs, &received_count);
 
-			if (error == nullptr)
+			if (error != nullptr)
 			{
-				if (data->GetLength() == 0L)
+				// An error occurred
+				break;
+			}
+
+			if (received_count == 0)
+			{
+				// Try later
+				break;
+			}
+
+			auto self = GetSharedPtrAs<DatagramSocket>();
+
+			for (size_t index = 0; index < received_count; index++)
+			{
+				auto &data = _recv_buffers[index];
+
+				if (_datagram_callback != nullptr)
 				{
-					// Try later
-					break;
+					// The buffer is passed without copying
+					_datagram_callback(self, _recv_address_pairs[index], data);
 				}
-				else
+
+				if (data.use_count() > 1)
 				{
-					if (_datagram_callback != nullptr)
-					{
-						_datagram_callback(GetSharedPtrAs<DatagramSocket>(), address_pair, data->Clone());
-					}
+					// The callee keeps the buffer, so it is handed over and a new one is used for this slot
+					data = std::make_shared<Data>(UdpBufferSize);
 				}
-			}
-			else
-			{
-				// An error occurred
-				break;
+
+				// Otherwise, the buffer is reused for the next datagram.
+				// (If the callee keeps a Clone()/Subdata() of it, the memory is detached by copy-on-write when it is written next time)
 			}
 		}
 	}
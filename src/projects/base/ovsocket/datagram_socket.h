@@ -66,5 +66,9 @@ namespace ov
 		}
 
 		DatagramCallback _datagram_callback = nullptr;
+
+		// Preallocated buffers used to receive datagrams using recvmmsg()
+		std::vector<std::shared_ptr<Data>> _recv_buffers;
+		std::vector<SocketAddressPair> _recv_address_pairs;
 	};
 }  // namespace ov
@@ -24,4 +24,5 @@
 #include "socket_pool/socket_pool.h"
 
 // Misc
-#include "ipv6_support.h"
\ No newline at end of file
+#include "ipv6_support.h"
+#include "socket_batch_stats.h"
\ No newline at end of file
@@ -11,18 +11,38 @@
 #include <arpa/inet.h>
 #include <errno.h>
 #include <sys/fcntl.h>
+#include <limits.h>
 #include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
+#if !IS_MACOS
+#	include <netinet/udp.h>
+#endif	// !IS_MACOS
+
 #include <algorithm>
 #include <atomic>
 #include <chrono>
 
 #include "epoll_wrapper.h"
 #include "socket_pool/socket_pool.h"
+#include "socket_batch_stats.h"
 #include "socket_private.h"
 #include "socket_utilities.h"
 
+#if !IS_MACOS
+#	ifndef UDP_SEGMENT
+// Linux 4.18+
+#		define UDP_SEGMENT 103
+#	endif  // UDP_SEGMENT
+
+// The maximum number of segments of a message sent using UDP GSO (UDP_MAX_SEGMENTS of the kernel)
+#	define OV_SOCKET_MAX_GSO_SEGMENTS 64
+// The maximum payload size of a message sent using UDP GSO (64KB - IPv6 header - UDP header)
+#	define OV_SOCKET_MAX_GSO_BYTES (65535 - 40 - 8)
+#endif	// !IS_MACOS
+
 #define logap(format, ...) logtp("[#%d] [%p] " format, (GetNativeHandle() == -1) ? 0 : GetNativeHandle(), this, ##__VA_ARGS__)
 #define logad(format, ...) logtd("[#%d] [%p] " format, (GetNativeHandle() == -1) ? 0 : GetNativeHandle(), this, ##__VA_ARGS__)
 #define logas(format, ...) logts("[#%d] [%p] " format, (GetNativeHandle() == -1) ? 0 : GetNativeHandle(), this, ##__VA_ARGS__)
@@ -242,17 +262,30 @@ namespace ov
 	bool Socket::AppendCommand(DispatchCommand command, bool dispatch_immediately)
 	{
 		SOCKET_PROFILER_INIT();
-		std::lock_guard lock_guard(_dispatch_queue_lock);
 		SOCKET_PROFILER_AFTER_LOCK();
 
 		SOCKET_PROFILER_POST_HANDLER([&](int64_t lock_elapsed, int64_t total_elapsed) {
-			if ((lock_elapsed > 100) || (_dispatch_queue.size() > 10))
+			if ((total_elapsed > 100) || (_incoming_command_queue.GetCount() > 10))
 			{
-				logtw("[SockProfiler] AppendCommand() - %s, Queue: %zu, Lock: %dms, Total: %dms", ToString().CStr(), _dispatch_queue.size(), lock_elapsed, total_elapsed);
+				logtw("[SockProfiler] AppendCommand() - %s, Incoming: %zu, Total: %dms", ToString().CStr(), _incoming_command_queue.GetCount(), total_elapsed);
 			}
 		});
 
-		_dispatch_queue.push_back(std::move(command));
+		if ((command.type == DispatchCommand::Type::Send) && (command.data != nullptr))
+		{
+			_pending_send_bytes += command.data->GetLength();
+		}
+		else if (command.type == DispatchCommand::Type::SendFile)
+		{
+			_pending_send_bytes += command.file_remaining;
+		}
+		else if (command.type == DispatchCommand::Type::SendVector)
+		{
+			_pending_send_bytes += command.GetDataListLength();
+		}
+
+		// The producers don't contend for _dispatch_queue_lock, the dispatching thread moves the command to _dispatch_queue
+		_incoming_command_queue.Push(std::move(command));
 
 		if (dispatch_immediately)
 		{
@@ -847,6 +880,11 @@ namespace ov
 
 			case DispatchCommand::Type::Send:
 				sent_bytes = SendInternal(data);
+
+				if (sent_bytes > 0)
+				{
+					_pending_send_bytes -= sent_bytes;
+				}
 				break;
 
 			case DispatchCommand::Type::SendTo:
@@ -857,6 +895,55 @@ namespace ov
 				sent_bytes = SendFromToInternal(command.address_pair, data);
 				break;
 
+			case DispatchCommand::Type::SendFile:
+				sent_bytes = SendFileInternal(command.file, command.file_offset, command.file_remaining);
+
+				if (sent_bytes < 0)
+				{
+					return DispatchResult::Error;
+				}
+
+				_pending_send_bytes -= sent_bytes;
+
+				if (static_cast<size_t>(sent_bytes) == command.file_remaining)
+				{
+					return DispatchResult::Dispatched;
+				}
+
+				if (sent_bytes > 0)
+				{
+					command.UpdateTime();
+					command.file_offset += sent_bytes;
+					command.file_remaining -= sent_bytes;
+				}
+
+				return DispatchResult::PartialDispatched;
+
+			case DispatchCommand::Type::SendVector: {
+				sent_bytes = SendVectorInternal(command.data_list);
+
+				if (sent_bytes < 0)
+				{
+					return DispatchResult::Error;
+				}
+
+				_pending_send_bytes -= sent_bytes;
+
+				command.ConsumeDataList(sent_bytes);
+
+				if (command.data_list.empty())
+				{
+					return DispatchResult::Dispatched;
+				}
+
+				if (sent_bytes > 0)
+				{
+					command.UpdateTime();
+				}
+
+				return DispatchResult::PartialDispatched;
+			}
+
 			case DispatchCommand::Type::HalfClose:
 				return HalfClose();
 
@@ -908,6 +995,216 @@ namespace ov
 		return DispatchResult::PartialDispatched;
 	}
 
+	bool Socket::AppendDatagramCommand(DispatchCommand command)
+	{
+		{
+			std::lock_guard lock_guard(_datagram_staging_lock);
+
+			_datagram_staging.push_back(std::move(command));
+
+			if (_datagram_dispatching)
+			{
+				// The dispatching thread will send it with the other datagrams
+				return true;
+			}
+
+			_datagram_dispatching = true;
+		}
+
+		std::vector<DispatchCommand> command_list;
+		int round = 0;
+
+		while (true)
+		{
+			bool is_round_exceeded = false;
+
+			{
+				std::lock_guard lock_guard(_datagram_staging_lock);
+
+				if (_datagram_staging.empty())
+				{
+					_datagram_dispatching = false;
+					break;
+				}
+
+				// Swap to reuse the capacity of the vectors
+				command_list.swap(_datagram_staging);
+
+				if (++round > OV_SOCKET_MAX_DATAGRAM_DISPATCH_ROUNDS)
+				{
+					// The other threads keep appending datagrams, so hand the rest over to the worker
+					is_round_exceeded = true;
+					_datagram_dispatching = false;
+				}
+			}
+
+			if (is_round_exceeded)
+			{
+				{
+					std::lock_guard lock_guard(_dispatch_queue_lock);
+
+					for (auto &staged_command : command_list)
+					{
+						_dispatch_queue.push_back(std::move(staged_command));
+					}
+				}
+
+				_worker->EnqueueToDispatchLater(GetSharedPtr());
+				break;
+			}
+
+			{
+				std::lock_guard lock_guard(_dispatch_queue_lock);
+
+				MoveIncomingCommandsInternal();
+
+				for (auto &staged_command : command_list)
+				{
+					_dispatch_queue.push_back(std::move(staged_command));
+				}
+			}
+
+			command_list.clear();
+
+			if (DispatchEvents() == DispatchResult::PartialDispatched)
+			{
+				_worker->EnqueueToDispatchLater(GetSharedPtr());
+			}
+		}
+
+		return true;
+	}
+
+	void Socket::MoveIncomingCommandsInternal()
+	{
+		while (true)
+		{
+			auto command = _incoming_command_queue.Pop();
+
+			if (command.has_value() == false)
+			{
+				break;
+			}
+
+			_dispatch_queue.push_back(std::move(command.value()));
+		}
+	}
+
+	Socket::DispatchResult Socket::DispatchStreamCommandsInternal()
+	{
+		SOCKET_PROFILER_INIT();
+
+		size_t command_count = 0;
+		size_t bytes_to_send = 0;
+		const auto max_iov_count = static_cast<size_t>(IOV_MAX);
+
+		_stream_iov_list.clear();
+
+		auto append_to_iov_list = [&](const std::shared_ptr<const Data> &data) {
+			if ((data != nullptr) && (data->GetLength() > 0))
+			{
+				_stream_iov_list.push_back({const_cast<void *>(data->GetData()), data->GetLength()});
+				bytes_to_send += data->GetLength();
+			}
+		};
+
+		for (const auto &command : _dispatch_queue)
+		{
+			if ((command.IsStreamCommand() == false) || (_stream_iov_list.size() >= max_iov_count))
+			{
+				break;
+			}
+
+			if (command.type == DispatchCommand::Type::SendVector)
+			{
+				for (const auto &data : command.data_list)
+				{
+					if (_stream_iov_list.size() >= max_iov_count)
+					{
+						break;
+					}
+
+					append_to_iov_list(data);
+				}
+			}
+			else
+			{
+				append_to_iov_list(command.data);
+			}
+
+			command_count++;
+		}
+
+		SOCKET_PROFILER_POST_HANDLER([&](int64_t lock_elapsed, int64_t total_elapsed) {
+			if ((total_elapsed > 100) || (command_count > 100))
+			{
+				logtw("[SockProfiler] DispatchStreamCommandsInternal() - %s, Commands: %zu, Buffers: %zu, Bytes: %zu, Total: %dms",
+					  ToString().CStr(), command_count, _stream_iov_list.size(), bytes_to_send, total_elapsed);
+			}
+		});
+
+		ssize_t sent_bytes = 0;
+
+		if (_stream_iov_list.empty() == false)
+		{
+			logap("Trying to send %zu commands (%zu buffers, %zu bytes) using sendmsg()...", command_count, _stream_iov_list.size(), bytes_to_send);
+
+			struct msghdr message = {};
+			message.msg_iov = _stream_iov_list.data();
+			message.msg_iovlen = _stream_iov_list.size();
+
+			sent_bytes = ::sendmsg(GetNativeHandle(), &message, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+			if (sent_bytes < 0L)
+			{
+				sent_bytes = HandleSendError(sent_bytes, 0);
+
+				if (sent_bytes < 0L)
+				{
+					return DispatchResult::Error;
+				}
+
+				// Socket buffer is full - retry later
+				return DispatchResult::PartialDispatched;
+			}
+
+			STATS_COUNTER_INCREASE_PPS();
+			UpdateLastSentTime();
+
+			SocketBatchStats::GetInstance()->OnStreamBatchSent(command_count, _stream_iov_list.size());
+
+			_pending_send_bytes -= sent_bytes;
+		}
+
+		// Remove the commands that have been sent
+		auto remained = static_cast<size_t>(sent_bytes);
+
+		while ((_dispatch_queue.empty() == false) && _dispatch_queue.front().IsStreamCommand())
+		{
+			auto &command = _dispatch_queue.front();
+			auto length = command.GetDataLength();
+
+			if (remained < length)
+			{
+				if (remained > 0)
+				{
+					// Since some data has been sent, the time needs to be updated.
+					command.UpdateTime();
+					command.Consume(remained);
+				}
+
+				break;
+			}
+
+			remained -= length;
+			_dispatch_queue.pop_front();
+		}
+
+		logap("%zd bytes sent", sent_bytes);
+
+		return (static_cast<size_t>(sent_bytes) == bytes_to_send) ? DispatchResult::Dispatched : DispatchResult::PartialDispatched;
+	}
+
 	Socket::DispatchResult Socket::DispatchEventsInternal()
 	{
 		SOCKET_PROFILER_INIT();
@@ -919,6 +1216,8 @@ namespace ov
 
 			std::lock_guard lock_guard(_dispatch_queue_lock);
 
+			MoveIncomingCommandsInternal();
+
 			[[maybe_unused]] auto count = _dispatch_queue.size();
 			SOCKET_PROFILER_POST_HANDLER([&](int64_t lock_elapsed, int64_t total_elapsed) {
 				if ((lock_elapsed > 100) || (count > 10) || (_dispatch_queue.size() > 10))
@@ -934,6 +1233,35 @@ namespace ov
 
 				while (_dispatch_queue.empty() == false)
 				{
+#if !IS_MACOS
+					if ((GetType() == SocketType::Udp) && (GetState() != SocketState::Closed) && _dispatch_queue.front().IsDatagramCommand())
+					{
+						result = DispatchDatagramsInternal();
+
+						if (result == DispatchResult::Dispatched)
+						{
+							// Dispatches the next items
+							continue;
+						}
+
+						break;
+					}
+#endif	// !IS_MACOS
+
+					if ((GetType() == SocketType::Tcp) && (GetState() != SocketState::Closed) && _dispatch_queue.front().IsStreamCommand())
+					{
+						// Drains the queued buffers with a single sendmsg()
+						result = DispatchStreamCommandsInternal();
+
+						if (result == DispatchResult::Dispatched)
+						{
+							// Dispatches the next items
+							continue;
+						}
+
+						break;
+					}
+
 					auto front = _dispatch_queue.front();
 					_dispatch_queue.pop_front();
 
@@ -951,6 +1279,7 @@ namespace ov
 #endif	// DEBUG
 
 						_dispatch_queue.clear();
+						_pending_send_bytes = 0;
 
 						result = DispatchResult::Dispatched;
 						break;
@@ -987,6 +1316,12 @@ namespace ov
 			}
 		}
 
+		if ((result == DispatchResult::Dispatched) && (_incoming_command_queue.IsEmpty() == false))
+		{
+			// Another thread is in the middle of AppendCommand(), so the command has to be dispatched later
+			result = DispatchResult::PartialDispatched;
+		}
+
 		return result;
 	}
 
@@ -1011,6 +1346,12 @@ namespace ov
 
 				CallCloseCallbackIfNeeded();
 
+				if (IsSendDrainedCallbackReady())
+				{
+					// The caller may hold the lock of the sender, so the callback is called by the worker
+					_worker->EnqueueToDispatchLater(GetSharedPtr());
+				}
+
 				return result;
 			}
 		}
@@ -1018,9 +1359,56 @@ namespace ov
 		return DispatchResult::Error;
 	}
 
+	bool Socket::SetSendDrainedCallback(size_t threshold, std::function<void()> callback)
+	{
+		std::lock_guard lock_guard(_send_drained_callback_lock);
+
+		// _pending_send_bytes is decreased before CallSendDrainedCallbackIfNeeded() takes the lock,
+		// so the callback registered here is not missed
+		if ((_blocking_mode != BlockingMode::NonBlocking) || (_pending_send_bytes < threshold) || (GetState() == SocketState::Closed))
+		{
+			return false;
+		}
+
+		_send_drained_threshold = threshold;
+		_send_drained_callback = std::move(callback);
+
+		return true;
+	}
+
+	bool Socket::IsSendDrainedCallbackReady()
+	{
+		std::lock_guard lock_guard(_send_drained_callback_lock);
+
+		return (_send_drained_callback != nullptr) && (_pending_send_bytes < _send_drained_threshold);
+	}
+
+	void Socket::CallSendDrainedCallbackIfNeeded()
+	{
+		std::function<void()> callback;
+
+		{
+			std::lock_guard lock_guard(_send_drained_callback_lock);
+
+			if ((_send_drained_callback == nullptr) || (_pending_send_bytes >= _send_drained_threshold))
+			{
+				return;
+			}
+
+			callback = std::move(_send_drained_callback);
+			_send_drained_callback = nullptr;
+		}
+
+		callback();
+	}
+
 	PostProcessMethod Socket::OnDataWritableEvent()
 	{
-		switch (DispatchEvents())
+		auto result = DispatchEvents();
+
+		CallSendDrainedCallbackIfNeeded();
+
+		switch (result)
 		{
 			case DispatchResult::Dispatched:
 				return PostProcessMethod::Nothing;
@@ -1129,39 +1517,227 @@ namespace ov
 		return total_sent_bytes;
 	}
 
-	ssize_t Socket::SendSrtData(
-		const std::shared_ptr<const Data> &data)
+	ssize_t Socket::SendFileInternal(const std::shared_ptr<const ReadOnlyFile> &file, off_t offset, size_t length)
 	{
-		auto data_to_send = data->GetDataAs<char>();
-		size_t remaining_bytes = data->GetLength();
+		size_t remaining_bytes = length;
 		size_t total_sent_bytes = 0L;
 
-		logap("Trying to send data %zu bytes...", remaining_bytes);
+		logap("Trying to send file %s (offset: %jd, %zu bytes)...", file->GetPath().CStr(), static_cast<intmax_t>(offset), remaining_bytes);
 
 		while ((remaining_bytes > 0L) && (_force_stop == false))
 		{
-			// SRT limits packet size up to 1316
-			const auto bytes_to_send = std::min(1316UL, remaining_bytes);
-
-			const auto sent = ::srt_sendmsg(GetNativeHandle(), data_to_send, bytes_to_send, -1, 1);
+			// sendfile() advances the offset
+			const auto sent = ::sendfile(GetNativeHandle(), file->GetNativeHandle(), &offset, remaining_bytes);
 
-			if (sent == SRT_ERROR)
+			if (sent < 0L)
 			{
-				const auto error = SrtError::CreateErrorFromSrt();
-
-				if (error->GetCode() == SRT_EASYNCSND)
-				{
-					// Socket buffer is full - retry later
-					STATS_COUNTER_INCREASE_RETRY();
-					return total_sent_bytes;
-				}
+				return HandleSendError(sent, total_sent_bytes);
+			}
 
+			if (sent == 0L)
+			{
+				// The file is truncated
+				logaw("Could not send file: %s is shorter than expected (%zu bytes left)", file->GetPath().CStr(), remaining_bytes);
 				STATS_COUNTER_INCREASE_ERROR();
-				logaw("Could not send data: %zd (%s)", sent, SrtError::CreateErrorFromSrt()->What());
-				return sent;
+				return -1L;
 			}
 
-			OV_ASSERT2(static_cast<ssize_t>(remaining_bytes) >= sent);
+			STATS_COUNTER_INCREASE_PPS();
+
+			remaining_bytes -= sent;
+			total_sent_bytes += sent;
+
+			UpdateLastSentTime();
+		}
+
+		logap("%zu bytes sent", total_sent_bytes);
+		return total_sent_bytes;
+	}
+
+	bool Socket::SendFile(const std::shared_ptr<const ReadOnlyFile> &file, off_t offset, size_t length)
+	{
+		if (file == nullptr)
+		{
+			OV_ASSERT2(file != nullptr);
+			return false;
+		}
+
+		if (GetType() != SocketType::Tcp)
+		{
+			logac("Could not send file - Invalid socket type: %s", StringFromSocketType(GetType()));
+			OV_ASSERT2(false);
+			return false;
+		}
+
+		if (length == 0)
+		{
+			return true;
+		}
+
+		switch (_blocking_mode)
+		{
+			case BlockingMode::Blocking:
+				return (SendFileInternal(file, offset, length) == static_cast<ssize_t>(length));
+
+			case BlockingMode::NonBlocking:
+				if (IsSendable())
+				{
+					return AppendCommand(DispatchCommand(file, offset, length), true);
+				}
+				break;
+		}
+
+		return false;
+	}
+
+	ssize_t Socket::SendVectorInternal(const std::vector<std::shared_ptr<const Data>> &data_list)
+	{
+		std::vector<struct iovec> iov_list;
+		iov_list.reserve(std::min(data_list.size(), static_cast<size_t>(IOV_MAX)));
+
+		size_t total_sent_bytes = 0L;
+		auto it = data_list.begin();
+
+		logap("Trying to send %zu data using writev()...", data_list.size());
+
+		while ((it != data_list.end()) && (_force_stop == false))
+		{
+			iov_list.clear();
+
+			size_t bytes_to_send = 0L;
+
+			for (; (it != data_list.end()) && (iov_list.size() < static_cast<size_t>(IOV_MAX)); ++it)
+			{
+				auto &data = *it;
+
+				if (data->GetLength() > 0)
+				{
+					iov_list.push_back({const_cast<void *>(data->GetData()), data->GetLength()});
+					bytes_to_send += data->GetLength();
+				}
+			}
+
+			if (iov_list.empty())
+			{
+				break;
+			}
+
+			// writev() doesn't accept flags, so sendmsg() is used to avoid SIGPIPE
+			struct msghdr message = {};
+			message.msg_iov = iov_list.data();
+			message.msg_iovlen = iov_list.size();
+
+			const auto sent = ::sendmsg(GetNativeHandle(), &message, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+			if (sent < 0L)
+			{
+				return HandleSendError(sent, total_sent_bytes);
+			}
+
+			STATS_COUNTER_INCREASE_PPS();
+
+			total_sent_bytes += sent;
+			UpdateLastSentTime();
+
+			if (static_cast<size_t>(sent) < bytes_to_send)
+			{
+				// Socket buffer is full - the caller will send the rest later
+				break;
+			}
+		}
+
+		logap("%zu bytes sent", total_sent_bytes);
+		return total_sent_bytes;
+	}
+
+	bool Socket::Send(const std::vector<std::shared_ptr<const Data>> &data_list)
+	{
+		if (GetType() != SocketType::Tcp)
+		{
+			// Other types of sockets have their own framing, so the data are sent one by one
+			for (const auto &data : data_list)
+			{
+				if (Send(data) == false)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		if (data_list.empty())
+		{
+			return true;
+		}
+
+		switch (_blocking_mode)
+		{
+			case BlockingMode::Blocking: {
+				DispatchCommand command(data_list);
+				auto length = command.GetDataListLength();
+
+				while (length > 0)
+				{
+					auto sent_bytes = SendVectorInternal(command.data_list);
+
+					if (sent_bytes <= 0)
+					{
+						return false;
+					}
+
+					// Blocking socket may send the data partially when it is interrupted by a signal
+					length -= sent_bytes;
+					command.ConsumeDataList(sent_bytes);
+				}
+
+				return true;
+			}
+
+			case BlockingMode::NonBlocking:
+				if (IsSendable())
+				{
+					return AppendCommand(DispatchCommand(data_list), true);
+				}
+				break;
+		}
+
+		return false;
+	}
+
+	ssize_t Socket::SendSrtData(
+		const std::shared_ptr<const Data> &data)
+	{
+		auto data_to_send = data->GetDataAs<char>();
+		size_t remaining_bytes = data->GetLength();
+		size_t total_sent_bytes = 0L;
+
+		logap("Trying to send data %zu bytes...", remaining_bytes);
+
+		while ((remaining_bytes > 0L) && (_force_stop == false))
+		{
+			// SRT limits packet size up to 1316
+			const auto bytes_to_send = std::min(1316UL, remaining_bytes);
+
+			const auto sent = ::srt_sendmsg(GetNativeHandle(), data_to_send, bytes_to_send, -1, 1);
+
+			if (sent == SRT_ERROR)
+			{
+				const auto error = SrtError::CreateErrorFromSrt();
+
+				if (error->GetCode() == SRT_EASYNCSND)
+				{
+					// Socket buffer is full - retry later
+					STATS_COUNTER_INCREASE_RETRY();
+					return total_sent_bytes;
+				}
+
+				STATS_COUNTER_INCREASE_ERROR();
+				logaw("Could not send data: %zd (%s)", sent, SrtError::CreateErrorFromSrt()->What());
+				return sent;
+			}
+
+			OV_ASSERT2(static_cast<ssize_t>(remaining_bytes) >= sent);
 
 			STATS_COUNTER_INCREASE_PPS();
 
@@ -1281,11 +1857,9 @@ namespace ov
 			case BlockingMode::NonBlocking:
 				if (IsSendable())
 				{
-					return AppendCommand(
-						(GetType() == SocketType::Udp)
-							? DispatchCommand(address, data->Clone())
-							: DispatchCommand(data->Clone()),
-						true);
+					return (GetType() == SocketType::Udp)
+							   ? AppendDatagramCommand(DispatchCommand(address, data->Clone()))
+							   : AppendCommand(DispatchCommand(data->Clone()), true);
 				}
 				break;
 		}
@@ -1454,11 +2028,9 @@ namespace ov
 			case BlockingMode::NonBlocking:
 				if (IsSendable())
 				{
-					return AppendCommand(
-						(GetType() == SocketType::Udp)
-							? DispatchCommand(address_pair, data->Clone())
-							: DispatchCommand(data->Clone()),
-						true);
+					return (GetType() == SocketType::Udp)
+							   ? AppendDatagramCommand(DispatchCommand(address_pair, data->Clone()))
+							   : AppendCommand(DispatchCommand(data->Clone()), true);
 				}
 		}
 
@@ -1470,6 +2042,200 @@ namespace ov
 		return SendFromTo(address_pair, (data == nullptr) ? nullptr : std::make_shared<Data>(data, length));
 	}
 
+#if !IS_MACOS
+	Socket::DispatchResult Socket::DispatchDatagramsInternal()
+	{
+		// Room for IP(V6)_PKTINFO + UDP_SEGMENT
+		constexpr size_t CONTROL_SIZE = CMSG_SPACE(sizeof(in6_pktinfo)) + CMSG_SPACE(sizeof(uint16_t));
+
+		if (_force_stop)
+		{
+			return DispatchResult::PartialDispatched;
+		}
+
+		mmsghdr messages[OV_SOCKET_MAX_DATAGRAM_BATCH]{};
+		iovec iovs[OV_SOCKET_MAX_DATAGRAM_BATCH]{};
+		// The number of datagrams contained in each message
+		size_t segment_counts[OV_SOCKET_MAX_DATAGRAM_BATCH]{};
+		alignas(cmsghdr) uint8_t controls[OV_SOCKET_MAX_DATAGRAM_BATCH][CONTROL_SIZE]{};
+
+		const auto command_count = std::min(_dispatch_queue.size(), static_cast<size_t>(OV_SOCKET_MAX_DATAGRAM_BATCH));
+		size_t message_count = 0;
+		size_t index = 0;
+		bool use_gso = false;
+
+		while (index < command_count)
+		{
+			auto &first = _dispatch_queue[index];
+
+			if (first.IsDatagramCommand() == false)
+			{
+				break;
+			}
+
+			const bool is_send_from_to = (first.type == DispatchCommand::Type::SendFromTo);
+			const auto segment_size = first.data->GetLength();
+			size_t total_bytes = segment_size;
+			size_t segment_count = 1;
+
+			// This is intentional conversion
+			iovs[index].iov_base = const_cast<void *>(first.data->GetData());
+			iovs[index].iov_len = segment_size;
+
+			// Datagrams of the same destination are sent as one message using UDP GSO.
+			// All segments must have the same size except the last one, which can be smaller.
+			while (_gso_enabled && ((index + segment_count) < command_count) && (segment_count < OV_SOCKET_MAX_GSO_SEGMENTS))
+			{
+				auto &next = _dispatch_queue[index + segment_count];
+				const auto next_size = next.data->GetLength();
+
+				if ((next.type != first.type) ||
+					(is_send_from_to ? (next.address_pair != first.address_pair) : (next.address != first.address)) ||
+					(iovs[index + segment_count - 1].iov_len != segment_size) ||
+					(next_size == 0) || (next_size > segment_size) ||
+					((total_bytes + next_size) > OV_SOCKET_MAX_GSO_BYTES))
+				{
+					break;
+				}
+
+				iovs[index + segment_count].iov_base = const_cast<void *>(next.data->GetData());
+				iovs[index + segment_count].iov_len = next_size;
+
+				total_bytes += next_size;
+				segment_count++;
+			}
+
+			const auto &remote_address = is_send_from_to ? first.address_pair.GetRemoteAddress() : first.address;
+			auto &header = messages[message_count].msg_hdr;
+			auto control = controls[message_count];
+			size_t control_length = 0;
+
+			// This is intentional conversion
+			header.msg_name = const_cast<sockaddr *>(remote_address.ToSockAddr());
+			header.msg_namelen = remote_address.GetSockAddrInLength();
+			header.msg_iov = &iovs[index];
+			header.msg_iovlen = segment_count;
+
+			if (is_send_from_to)
+			{
+				auto cmsg = reinterpret_cast<cmsghdr *>(control);
+
+				if (_family == SocketFamily::Inet6)
+				{
+					in6_pktinfo pktinfo{};
+					SetAddr(&pktinfo, first.address_pair.GetLocalAddress());
+
+					cmsg->cmsg_level = IPPROTO_IPV6;
+					cmsg->cmsg_type = IPV6_PKTINFO;
+					cmsg->cmsg_len = CMSG_LEN(sizeof(pktinfo));
+					::memcpy(CMSG_DATA(cmsg), &pktinfo, sizeof(pktinfo));
+
+					control_length += CMSG_SPACE(sizeof(pktinfo));
+				}
+				else
+				{
+					in_pktinfo pktinfo{};
+					SetAddr(&pktinfo, first.address_pair.GetLocalAddress());
+
+					cmsg->cmsg_level = IPPROTO_IP;
+					cmsg->cmsg_type = IP_PKTINFO;
+					cmsg->cmsg_len = CMSG_LEN(sizeof(pktinfo));
+					::memcpy(CMSG_DATA(cmsg), &pktinfo, sizeof(pktinfo));
+
+					control_length += CMSG_SPACE(sizeof(pktinfo));
+				}
+			}
+
+			if (segment_count > 1)
+			{
+				auto cmsg = reinterpret_cast<cmsghdr *>(control + control_length);
+				uint16_t gso_size = static_cast<uint16_t>(segment_size);
+
+				cmsg->cmsg_level = SOL_UDP;
+				cmsg->cmsg_type = UDP_SEGMENT;
+				cmsg->cmsg_len = CMSG_LEN(sizeof(gso_size));
+				::memcpy(CMSG_DATA(cmsg), &gso_size, sizeof(gso_size));
+
+				control_length += CMSG_SPACE(sizeof(gso_size));
+				use_gso = true;
+			}
+
+			header.msg_control = (control_length > 0) ? control : nullptr;
+			header.msg_controllen = control_length;
+
+			segment_counts[message_count] = segment_count;
+			message_count++;
+			index += segment_count;
+		}
+
+		logap("Trying to send %zu datagrams in %zu messages...", index, message_count);
+
+		const auto sent_count = ::sendmmsg(GetNativeHandle(), messages, message_count, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+		if (sent_count < 0)
+		{
+			const auto error = errno;
+
+			if (use_gso && ((error == EIO) || (error == EINVAL) || (error == ENOPROTOOPT) || (error == EOPNOTSUPP)))
+			{
+				// The kernel or NIC doesn't support UDP GSO
+				logaw("UDP GSO is disabled: %s", ::strerror(error));
+
+				_gso_enabled = false;
+				SocketBatchStats::GetInstance()->OnGsoDisabled();
+
+				return DispatchDatagramsInternal();
+			}
+
+			if (HandleSendError(sent_count, 0) == 0)
+			{
+				// EAGAIN
+				return DispatchResult::PartialDispatched;
+			}
+
+			// The datagrams of the first message cannot be sent - drop them like SendToInternal() does
+			for (size_t datagram_index = 0; datagram_index < segment_counts[0]; datagram_index++)
+			{
+				_dispatch_queue.pop_front();
+			}
+
+			return DispatchResult::Error;
+		}
+
+		size_t sent_datagram_count = 0;
+
+		for (int message_index = 0; message_index < sent_count; message_index++)
+		{
+			const auto segment_count = segment_counts[message_index];
+
+			if (segment_count > 1)
+			{
+				SocketBatchStats::GetInstance()->OnSegmentsSent(segment_count);
+			}
+
+			sent_datagram_count += segment_count;
+		}
+
+		SocketBatchStats::GetInstance()->OnBatchSent(sent_datagram_count);
+
+		for (size_t datagram_index = 0; datagram_index < sent_datagram_count; datagram_index++)
+		{
+			STATS_COUNTER_INCREASE_PPS();
+			_dispatch_queue.pop_front();
+		}
+
+		if (sent_datagram_count > 0)
+		{
+			UpdateLastSentTime();
+		}
+
+		logap("%zu datagrams sent", sent_datagram_count);
+
+		// If some messages are not sent, the next call will retry them (and get EAGAIN or the error)
+		return DispatchResult::Dispatched;
+	}
+#endif	// !IS_MACOS
+
 	std::shared_ptr<const SocketError> Socket::Recv(std::shared_ptr<Data> &data, const bool non_block)
 	{
 		OV_ASSERT2(data != nullptr);
@@ -1817,6 +2583,127 @@ namespace ov
 		return socket_error;
 	}
 
+	std::shared_ptr<const SocketError> Socket::RecvFromMultiple(std::vector<std::shared_ptr<Data>> &data_list, std::vector<SocketAddressPair> &address_pair_list, size_t *received_count, const bool non_block)
+	{
+		OV_ASSERT2(_socket.IsValid());
+		OV_ASSERT2(received_count != nullptr);
+
+		*received_count = 0;
+
+		const auto count = std::min(data_list.size(), static_cast<size_t>(OV_SOCKET_MAX_RECV_DATAGRAM_BATCH));
+
+		address_pair_list.resize(data_list.size());
+
+		if (count == 0)
+		{
+			return nullptr;
+		}
+
+#if IS_MACOS
+		// recvmmsg() is not supported - receive only one datagram
+		auto error = RecvFrom(data_list[0], &address_pair_list[0], non_block);
+
+		if ((error == nullptr) && (data_list[0]->GetLength() > 0))
+		{
+			*received_count = 1;
+		}
+
+		return error;
+#else	// IS_MACOS
+		if (GetType() != SocketType::Udp)
+		{
+			// RecvFromMultiple() is supported only for UDP
+			OV_ASSERT2(false);
+			return SocketError::CreateError("RecvFromMultiple() is not supported for %s", StringFromSocketType(GetType()));
+		}
+
+		constexpr size_t CONTROL_SIZE = CMSG_SPACE(sizeof(in6_pktinfo));
+
+		mmsghdr messages[OV_SOCKET_MAX_RECV_DATAGRAM_BATCH]{};
+		iovec iovs[OV_SOCKET_MAX_RECV_DATAGRAM_BATCH]{};
+		sockaddr_storage remotes[OV_SOCKET_MAX_RECV_DATAGRAM_BATCH]{};
+		alignas(cmsghdr) uint8_t controls[OV_SOCKET_MAX_RECV_DATAGRAM_BATCH][CONTROL_SIZE]{};
+
+		for (size_t index = 0; index < count; index++)
+		{
+			auto &data = data_list[index];
+
+			OV_ASSERT2(data != nullptr);
+			OV_ASSERT2(data->GetCapacity() > 0);
+
+			// If the buffer is still referenced by another Data (Clone()/Subdata()), a new buffer is allocated here (copy-on-write)
+			data->SetLength(data->GetCapacity());
+
+			iovs[index].iov_base = data->GetWritableData();
+			iovs[index].iov_len = data->GetLength();
+
+			auto &header = messages[index].msg_hdr;
+			header.msg_name = &remotes[index];
+			header.msg_namelen = sizeof(remotes[index]);
+			header.msg_iov = &iovs[index];
+			header.msg_iovlen = 1;
+			header.msg_control = controls[index];
+			header.msg_controllen = CONTROL_SIZE;
+		}
+
+		logad("Trying to read %zu datagrams from the socket...", count);
+
+		const auto read_count = ::recvmmsg(
+			GetNativeHandle(),
+			messages, count,
+			((_blocking_mode == BlockingMode::NonBlocking) || non_block) ? MSG_DONTWAIT : 0,
+			nullptr);
+
+		std::shared_ptr<SocketError> socket_error;
+
+		if (read_count < 0)
+		{
+			auto error = Error::CreateErrorFromErrno();
+
+			for (size_t index = 0; index < count; index++)
+			{
+				data_list[index]->SetLength(0L);
+			}
+
+			if (error->GetCode() != EAGAIN)
+			{
+				socket_error = SocketError::CreateError(error);
+
+				logae("An error occurred while read data: %s\nStack trace: %s",
+					  socket_error->What(),
+					  StackTrace::GetStackTrace().CStr());
+
+				CloseWithState(SocketState::Error);
+			}
+
+			return socket_error;
+		}
+
+		const auto port = GetLocalAddress()->Port();
+
+		for (int index = 0; index < read_count; index++)
+		{
+			auto &message = messages[index];
+
+			data_list[index]->SetLength(message.msg_len);
+
+			address_pair_list[index].SetLocalAddress(QueryLocalAddress(_family, port, remotes[index], &(message.msg_hdr)));
+			address_pair_list[index].SetRemoteAddress(SocketAddress("", remotes[index]));
+		}
+
+		logad("%d datagrams read", read_count);
+
+		*received_count = read_count;
+
+		if (read_count > 0)
+		{
+			UpdateLastRecvTime();
+		}
+
+		return nullptr;
+#endif	// IS_MACOS
+	}
+
 	std::chrono::system_clock::time_point Socket::GetLastRecvTime() const
 	{
 		return _last_recv_time;
@@ -1842,7 +2729,7 @@ namespace ov
 		CHECK_STATE(== SocketState::Connected, false);
 
 		// Dispatch ALL commands
-		while (_dispatch_queue.size() > 0)
+		while (HasCommand())
 		{
 			if (DispatchEvents() == DispatchResult::Error)
 			{
@@ -1929,6 +2816,9 @@ namespace ov
 				{
 					logad("Enqueuing close command (new_state: %s)", StringFromSocketState(new_state));
 
+					// The commands enqueued before Close() have to be dispatched before the close command
+					MoveIncomingCommandsInternal();
+
 					_has_close_command = true;
 
 					if ((GetState() != SocketState::Disconnected) && (GetState() != SocketState::Error))
@@ -2075,6 +2965,9 @@ namespace ov
 	{
 		CHECK_STATE(!= SocketState::Closed, false);
 
+		// Destroyed after the lock of the callback is released, since the objects captured by it may be released
+		std::function<void()> send_drained_callback;
+
 		_post_callback = std::move(_callback);
 		_close_reason = close_reason;
 
@@ -2100,6 +2993,8 @@ namespace ov
 
 			_socket.SetValid(false);
 
+			MoveIncomingCommandsInternal();
+
 			if (_dispatch_queue.size() > 0)
 			{
 				if (_dispatch_queue.front().IsCloseCommand() == false)
@@ -2116,6 +3011,14 @@ namespace ov
 			}
 
 			_dispatch_queue.clear();
+			_pending_send_bytes = 0;
+
+			{
+				// The data will not be sent anymore
+				std::lock_guard lock_guard(_send_drained_callback_lock);
+				send_drained_callback = std::move(_send_drained_callback);
+				_send_drained_callback = nullptr;
+			}
 
 			logad("Socket is closed successfully");
 
@@ -21,6 +21,7 @@
 #endif	// !IS_MACOS
 
 #include <sys/socket.h>
+#include <sys/uio.h>
 
 #include <functional>
 #include <map>
@@ -31,6 +32,14 @@
 // For example, it can occur when EAGAIN continues to occur for a period of time, or when the peer's TCP window is full and no longer receives data.
 #define OV_SOCKET_EXPIRE_TIMEOUT (10 * 1000)
 
+// The maximum number of datagrams sent by one sendmmsg() call
+#define OV_SOCKET_MAX_DATAGRAM_BATCH 64
+// The maximum number of datagrams received by one recvmmsg() call
+#define OV_SOCKET_MAX_RECV_DATAGRAM_BATCH 32
+// The maximum number of rounds a sending thread dispatches the datagrams staged by the other threads,
+// the rest is dispatched by the socket pool worker so that the sending thread is not held indefinitely
+#define OV_SOCKET_MAX_DATAGRAM_DISPATCH_ROUNDS 8
+
 namespace ov
 {
 	// Forward declaration
@@ -178,6 +187,10 @@ namespace ov
 
 		bool Send(const std::shared_ptr<const Data> &data);
 		bool Send(const void *data, size_t length);
+		// Sends the list of data using writev(2) without concatenating them (TCP only)
+		//
+		// Unlike Send(data), the data in the list are not copied, so they must not be modified after this call
+		bool Send(const std::vector<std::shared_ptr<const Data>> &data_list);
 
 		bool SendTo(const SocketAddress &address, const std::shared_ptr<const Data> &data);
 		bool SendTo(const SocketAddress &address, const void *data, size_t length);
@@ -185,6 +198,10 @@ namespace ov
 		bool SendFromTo(const SocketAddressPair &address_pair, const std::shared_ptr<const Data> &data);
 		bool SendFromTo(const SocketAddressPair &address_pair, const void *data, size_t length);
 
+		// Sends `length` bytes of the file from `offset` using sendfile(2) without copying the file into the user space
+		// (TCP only - the data must be sent as is, so it cannot be used for TLS)
+		bool SendFile(const std::shared_ptr<const ReadOnlyFile> &file, off_t offset, size_t length);
+
 		// When Recv is called in non-blocking mode,
 		//
 		// 1. return != nullptr: An error occurred (Include disconnecting the client)
@@ -200,6 +217,15 @@ namespace ov
 		// If MakeNonBlocking() is called, non_block is ignored
 		std::shared_ptr<const SocketError> RecvFrom(std::shared_ptr<Data> &data, SocketAddressPair *address_pair, const bool non_block = false);
 
+		// Receives up to data_list.size() datagrams at once (using recvmmsg())
+		//
+		// Each item of data_list must have the capacity reserved in advance. Received data are written to the items in order,
+		// and *received_count is set to the number of the received datagrams (0 == Retry later (EAGAIN)).
+		// address_pair_list is resized to data_list.size().
+		//
+		// If MakeNonBlocking() is called, non_block is ignored
+		std::shared_ptr<const SocketError> RecvFromMultiple(std::vector<std::shared_ptr<Data>> &data_list, std::vector<SocketAddressPair> &address_pair_list, size_t *received_count, const bool non_block = false);
+
 		std::chrono::system_clock::time_point GetLastRecvTime() const;
 		std::chrono::system_clock::time_point GetLastSentTime() const;
 
@@ -217,14 +243,28 @@ namespace ov
 
 		bool HasCommand() const
 		{
-			return _dispatch_queue.size() > 0;
+			return (_dispatch_queue.size() > 0) || (_incoming_command_queue.IsEmpty() == false);
+		}
+
+		// The number of bytes queued by Send() in nonblocking mode that have not been sent to the kernel yet
+		size_t GetPendingSendBytes() const
+		{
+			return _pending_send_bytes;
 		}
 
+		// The callback is called once when GetPendingSendBytes() goes below the threshold (nonblocking mode only),
+		// so the sender can queue the next data without loading all of it into the socket at once.
+		// It is called by the socket pool worker, never from Send(), so the sender may hold its lock while sending.
+		// Returns false if it is already below the threshold, then the callback is not registered and is not called.
+		// The callback is discarded when the socket is closed.
+		bool SetSendDrainedCallback(size_t threshold, std::function<void()> callback);
+
 		bool HasExpiredCommand() const
 		{
 			std::lock_guard lock_guard(_dispatch_queue_lock);
 
-			if (HasCommand())
+			// The commands in _incoming_command_queue have just been enqueued, so only _dispatch_queue is checked
+			if (_dispatch_queue.empty() == false)
 			{
 				return _dispatch_queue.front().IsExpired(OV_SOCKET_EXPIRE_TIMEOUT);
 			}
@@ -266,6 +306,10 @@ namespace ov
 				SendTo = 0x02,
 				// Need to send data using sendmsg()
 				SendFromTo = 0x03,
+				// Need to send a range of the file using sendfile() (TCP only)
+				SendFile = 0x04,
+				// Need to send the list of data using writev() (TCP only)
+				SendVector = 0x05,
 
 				// Need to call shutdown(SHUT_WR) (TCP only)
 				HalfClose = CLOSE_TYPE_MASK | 0x01,
@@ -291,6 +335,12 @@ namespace ov
 					case Type::SendFromTo:
 						return "SendFromTo";
 
+					case Type::SendFile:
+						return "SendFile";
+
+					case Type::SendVector:
+						return "SendVector";
+
 					case Type::HalfClose:
 						return "HalfClose";
 
@@ -327,6 +377,22 @@ namespace ov
 			{
 			}
 
+			DispatchCommand(const std::shared_ptr<const ReadOnlyFile> &file, off_t offset, size_t length)
+				: type(Type::SendFile),
+				  file(file),
+				  file_offset(offset),
+				  file_remaining(length),
+				  enqueued_time(std::chrono::system_clock::now())
+			{
+			}
+
+			DispatchCommand(const std::vector<std::shared_ptr<const Data>> &data_list)
+				: type(Type::SendVector),
+				  data_list(data_list),
+				  enqueued_time(std::chrono::system_clock::now())
+			{
+			}
+
 			DispatchCommand(Type type)
 				: type(type),
 				  enqueued_time(std::chrono::system_clock::now())
@@ -347,6 +413,10 @@ namespace ov
 				  address(another_command.address),
 				  address_pair(another_command.address_pair),
 				  data(another_command.data),
+				  data_list(another_command.data_list),
+				  file(another_command.file),
+				  file_offset(another_command.file_offset),
+				  file_remaining(another_command.file_remaining),
 				  enqueued_time(another_command.enqueued_time)
 			{
 			}
@@ -359,6 +429,10 @@ namespace ov
 				std::swap(address, another_command.address);
 				std::swap(address_pair, another_command.address_pair);
 				std::swap(data, another_command.data);
+				std::swap(data_list, another_command.data_list);
+				std::swap(file, another_command.file);
+				std::swap(file_offset, another_command.file_offset);
+				std::swap(file_remaining, another_command.file_remaining);
 				std::swap(enqueued_time, another_command.enqueued_time);
 			}
 
@@ -367,11 +441,76 @@ namespace ov
 				return OV_CHECK_FLAG(static_cast<uint8_t>(type), CLOSE_TYPE_MASK);
 			}
 
+			bool IsDatagramCommand() const
+			{
+				return (type == Type::SendTo) || (type == Type::SendFromTo);
+			}
+
+			// Commands that can be sent together with a single sendmsg() (TCP only)
+			bool IsStreamCommand() const
+			{
+				return (type == Type::Send) || (type == Type::SendVector);
+			}
+
+			size_t GetDataLength() const
+			{
+				if (type == Type::SendVector)
+				{
+					return GetDataListLength();
+				}
+
+				return (data != nullptr) ? data->GetLength() : 0;
+			}
+
+			// Drops the data that have been sent, and keeps the rest of the partially sent one
+			void Consume(size_t sent_bytes)
+			{
+				if (type == Type::SendVector)
+				{
+					ConsumeDataList(sent_bytes);
+				}
+				else if ((data != nullptr) && (sent_bytes > 0))
+				{
+					data = data->Subdata(sent_bytes);
+				}
+			}
+
 			void UpdateTime()
 			{
 				enqueued_time = std::chrono::system_clock::now();
 			}
 
+			size_t GetDataListLength() const
+			{
+				size_t length = 0;
+
+				for (const auto &item : data_list)
+				{
+					length += item->GetLength();
+				}
+
+				return length;
+			}
+
+			// Drops the data that have been sent, and keeps the rest of the partially sent one
+			void ConsumeDataList(size_t sent_bytes)
+			{
+				auto it = data_list.begin();
+
+				while ((it != data_list.end()) && (sent_bytes >= (*it)->GetLength()))
+				{
+					sent_bytes -= (*it)->GetLength();
+					++it;
+				}
+
+				data_list.erase(data_list.begin(), it);
+
+				if (sent_bytes > 0)
+				{
+					data_list.front() = data_list.front()->Subdata(sent_bytes);
+				}
+			}
+
 			bool IsExpired(int millisecond_time) const
 			{
 				auto delta = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - enqueued_time);
@@ -402,6 +541,16 @@ namespace ov
 					description.AppendFormat(", data: %zu bytes", data->GetLength());
 				}
 
+				if (data_list.empty() == false)
+				{
+					description.AppendFormat(", data_list: %zu items (%zu bytes)", data_list.size(), GetDataListLength());
+				}
+
+				if (file != nullptr)
+				{
+					description.AppendFormat(", file: %s (offset: %jd, remaining: %zu bytes)", file->GetPath().CStr(), static_cast<intmax_t>(file_offset), file_remaining);
+				}
+
 				description.Append('>');
 
 				return description;
@@ -412,6 +561,12 @@ namespace ov
 			SocketAddress address;
 			SocketAddressPair address_pair;
 			std::shared_ptr<const Data> data;
+			// For SendVector
+			std::vector<std::shared_ptr<const Data>> data_list;
+			// For SendFile
+			std::shared_ptr<const ReadOnlyFile> file;
+			off_t file_offset = 0;
+			size_t file_remaining = 0;
 			std::chrono::time_point<std::chrono::system_clock> enqueued_time;
 		};
 
@@ -424,6 +579,9 @@ namespace ov
 		bool SetBlockingInternal(BlockingMode mode);
 
 		bool AppendCommand(DispatchCommand command, bool dispatch_immediately);
+		// If another thread is dispatching the datagrams of this socket, the command is handed over to that thread
+		// and sent with the others in a batch. Otherwise, this thread dispatches it (and the ones appended meanwhile).
+		bool AppendDatagramCommand(DispatchCommand command);
 
 		//--------------------------------------------------------------------
 		// Implementation of SocketPoolEventInterface
@@ -434,13 +592,24 @@ namespace ov
 		//--------------------------------------------------------------------
 
 		DispatchResult DispatchEventInternal(DispatchCommand &command);
+		// Sends the datagram commands at the front of _dispatch_queue using sendmmsg() (and UDP GSO if possible)
+		DispatchResult DispatchDatagramsInternal();
+		// Sends the consecutive Send/SendVector commands at the front of _dispatch_queue using a single sendmsg() (TCP only)
+		DispatchResult DispatchStreamCommandsInternal();
+		// Moves the commands of _incoming_command_queue to _dispatch_queue (_dispatch_queue_lock must be held)
+		void MoveIncomingCommandsInternal();
 
 		bool IsSendable() const;
 		ssize_t HandleSendError(const ssize_t result, const size_t total_sent);
 
 		bool DispatchEventsAfterAppendCommand();
+		bool IsSendDrainedCallbackReady();
+		// Called by the worker after dispatching without any lock held
+		void CallSendDrainedCallbackIfNeeded();
 
 		ssize_t SendData(const std::shared_ptr<const Data> &data);
+		ssize_t SendFileInternal(const std::shared_ptr<const ReadOnlyFile> &file, off_t offset, size_t length);
+		ssize_t SendVectorInternal(const std::vector<std::shared_ptr<const Data>> &data_list);
 		ssize_t SendSrtData(const std::shared_ptr<const Data> &data);
 
 		ssize_t SendInternal(const std::shared_ptr<const Data> &data);
@@ -525,9 +694,28 @@ namespace ov
 		std::shared_ptr<SocketAddress> _local_address = nullptr;
 		std::shared_ptr<SocketAddress> _remote_address = nullptr;
 
+		// Commands enqueued by AppendCommand() without taking _dispatch_queue_lock,
+		// they are moved to _dispatch_queue by the dispatching thread
+		MpscQueue<DispatchCommand> _incoming_command_queue;
+
 		mutable std::recursive_mutex _dispatch_queue_lock;
 		std::deque<DispatchCommand> _dispatch_queue;
+		// iovec list of DispatchStreamCommandsInternal() (reused to avoid allocations)
+		std::vector<struct iovec> _stream_iov_list;
 		bool _has_close_command = false;
+		// Total length of the data of Send commands in _incoming_command_queue and _dispatch_queue
+		std::atomic<size_t> _pending_send_bytes{0};
+
+		std::mutex _send_drained_callback_lock;
+		size_t _send_drained_threshold = 0;
+		std::function<void()> _send_drained_callback;
+
+		// Datagrams waiting to be moved to _dispatch_queue by the dispatching thread
+		std::mutex _datagram_staging_lock;
+		std::vector<DispatchCommand> _datagram_staging;
+		bool _datagram_dispatching = false;
+		// Disabled when the kernel/NIC doesn't support UDP_SEGMENT
+		bool _gso_enabled = true;
 
 		std::atomic<bool> _connection_event_fired{false};
 		std::shared_ptr<SocketAsyncInterface> _callback;
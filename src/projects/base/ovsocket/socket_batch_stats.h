@@ -0,0 +1,187 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Hyunjun Jang
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+namespace ov
+{
+	// Statistics of batched sending
+	//
+	// - Datagrams: sendmmsg/UDP GSO
+	// - Streams (TCP): the queued buffers sent with a single sendmsg()
+	//
+	// Histograms use power-of-2 buckets: [1], [2, 3], [4, 7], ..., [2^(N-1), inf)
+	class SocketBatchStats : public Singleton<SocketBatchStats>
+	{
+	public:
+		static constexpr size_t HISTOGRAM_BUCKET_COUNT = 8;
+
+		using Histogram = std::array<int64_t, HISTOGRAM_BUCKET_COUNT>;
+
+		// Called for each sendmmsg() call
+		//
+		// datagram_count: The number of datagrams sent by the call
+		void OnBatchSent(size_t datagram_count)
+		{
+			_batch_count++;
+			_datagram_count += datagram_count;
+
+			_batch_histogram[GetBucketIndex(datagram_count)]++;
+		}
+
+		// Called for each message which is split into segments by UDP GSO
+		void OnSegmentsSent(size_t segment_count)
+		{
+			_gso_count++;
+			_gso_segment_count += segment_count;
+
+			_gso_histogram[GetBucketIndex(segment_count)]++;
+		}
+
+		void OnGsoDisabled()
+		{
+			_gso_disabled_count++;
+		}
+
+		// Called for each sendmsg() call which drains the dispatch queue of a TCP socket
+		//
+		// command_count: The number of queued commands sent by the call
+		// buffer_count: The number of buffers (iovec entries) sent by the call
+		void OnStreamBatchSent(size_t command_count, size_t buffer_count)
+		{
+			_stream_batch_count++;
+			_stream_command_count += command_count;
+			_stream_buffer_count += buffer_count;
+
+			_stream_batch_histogram[GetBucketIndex(command_count)]++;
+			_stream_buffer_histogram[GetBucketIndex(buffer_count)]++;
+		}
+
+		int64_t GetBatchCount() const
+		{
+			return _batch_count;
+		}
+
+		int64_t GetDatagramCount() const
+		{
+			return _datagram_count;
+		}
+
+		int64_t GetGsoCount() const
+		{
+			return _gso_count;
+		}
+
+		int64_t GetGsoSegmentCount() const
+		{
+			return _gso_segment_count;
+		}
+
+		int64_t GetGsoDisabledCount() const
+		{
+			return _gso_disabled_count;
+		}
+
+		int64_t GetStreamBatchCount() const
+		{
+			return _stream_batch_count;
+		}
+
+		int64_t GetStreamCommandCount() const
+		{
+			return _stream_command_count;
+		}
+
+		int64_t GetStreamBufferCount() const
+		{
+			return _stream_buffer_count;
+		}
+
+		Histogram GetBatchHistogram() const
+		{
+			return LoadHistogram(_batch_histogram);
+		}
+
+		Histogram GetGsoHistogram() const
+		{
+			return LoadHistogram(_gso_histogram);
+		}
+
+		Histogram GetStreamBatchHistogram() const
+		{
+			return LoadHistogram(_stream_batch_histogram);
+		}
+
+		Histogram GetStreamBufferHistogram() const
+		{
+			return LoadHistogram(_stream_buffer_histogram);
+		}
+
+		// Returns the label of the bucket (e.g. "1", "2-3", "128+")
+		static String GetBucketLabel(size_t index)
+		{
+			size_t lower = 1ULL << index;
+
+			if (index == 0)
+			{
+				return "1";
+			}
+
+			if (index == (HISTOGRAM_BUCKET_COUNT - 1))
+			{
+				return String::FormatString("%zu+", lower);
+			}
+
+			return String::FormatString("%zu-%zu", lower, (lower << 1) - 1);
+		}
+
+	protected:
+		static size_t GetBucketIndex(size_t value)
+		{
+			size_t index = 0;
+
+			while ((value > 1) && (index < (HISTOGRAM_BUCKET_COUNT - 1)))
+			{
+				value >>= 1;
+				index++;
+			}
+
+			return index;
+		}
+
+		static Histogram LoadHistogram(const std::array<std::atomic<int64_t>, HISTOGRAM_BUCKET_COUNT> &source)
+		{
+			Histogram histogram;
+
+			for (size_t index = 0; index < HISTOGRAM_BUCKET_COUNT; index++)
+			{
+				histogram[index] = source[index];
+			}
+
+			return histogram;
+		}
+
+		std::atomic<int64_t> _batch_count{0};
+		std::atomic<int64_t> _datagram_count{0};
+		std::array<std::atomic<int64_t>, HISTOGRAM_BUCKET_COUNT> _batch_histogram{};
+
+		std::atomic<int64_t> _gso_count{0};
+		std::atomic<int64_t> _gso_segment_count{0};
+		std::array<std::atomic<int64_t>, HISTOGRAM_BUCKET_COUNT> _gso_histogram{};
+
+		std::atomic<int64_t> _gso_disabled_count{0};
+
+		std::atomic<int64_t> _stream_batch_count{0};
+		std::atomic<int64_t> _stream_command_count{0};
+		std::atomic<int64_t> _stream_buffer_count{0};
+		std::array<std::atomic<int64_t>, HISTOGRAM_BUCKET_COUNT> _stream_batch_histogram{};
+		std::array<std::atomic<int64_t>, HISTOGRAM_BUCKET_COUNT> _stream_buffer_histogram{};
+	};
+}  // namespace ov
@@ -795,6 +795,8 @@ namespace ov
 					}
 					break;
 			}
+
+			socket->CallSendDrainedCallbackIfNeeded();
 		}
 	}
 
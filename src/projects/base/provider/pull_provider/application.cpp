@@ -64,6 +64,12 @@ namespace pvd
 			{
 				auto stream = std::dynamic_pointer_cast<PullStream>(x.second);
 
+				if (stream->IsStarting())
+				{
+					// The StreamMotor is starting the stream, and it has its own timeouts
+					continue;
+				}
+
 				if (stream->GetState() == Stream::State::STOPPED || stream->GetState() == Stream::State::ERROR)
 				{
 					// Retry
@@ -122,6 +128,12 @@ namespace pvd
 								auto ping = CreateStream(0, "_ping_for_failback_", {failback_url}, ping_props);
 								if (ping)
 								{
+									if (ping->IsStarting())
+									{
+										// The ping stream is not added to the StreamMotor
+										ping->CompleteStart();
+									}
+
 									auto state = ping->GetState() ;
 									ping->Stop();
 
@@ -246,6 +258,42 @@ namespace pvd
 			return nullptr;
 		}
 
+		if (stream->IsStarting())
+		{
+			// The StreamMotor drives the start along with the other streams, and the stream is added to the application
+			// once it is playing (the tracks are known). The media is processed after that.
+			auto motor = GetStreamMotorInternal(stream);
+			if (motor == nullptr)
+			{
+				motor = CreateStreamMotorInternal(stream);
+			}
+
+			motor->AddStream(stream);
+
+			if (stream->WaitForStarted() == false)
+			{
+				logte("Could not start stream : %s/%s(%u)", stream->GetApplicationInfo().GetVHostAppName().CStr(), stream->GetName().CStr(), stream->GetId());
+				DeleteStreamMotorInternal(stream);
+				return nullptr;
+			}
+
+			if (AddStream(stream) == false)
+			{
+				logte("Could not add stream : %s/%s(%u)", stream->GetApplicationInfo().GetVHostAppName().CStr(), stream->GetName().CStr(), stream->GetId());
+				DeleteStreamMotorInternal(stream);
+				return nullptr;
+			}
+
+			// If it has been stopped in the meantime, WhiteElephantCollector resumes it
+			if (stream->CompleteRegistration())
+			{
+				// Now the fd of the stream is added to the epoll
+				motor->UpdateStream(stream);
+			}
+
+			return stream;
+		}
+
 		if (AddStream(stream) == false)
 		{
 			logte("Could not add stream : %s/%s(%u)", stream->GetApplicationInfo().GetVHostAppName().CStr(), stream->GetName().CStr(), stream->GetId());
@@ -289,7 +337,11 @@ namespace pvd
 			return false;
 		}
 
-		NotifyStreamUpdated(pull_stream);
+		// If the stream is starting asynchronously, the stream is updated when the start is completed
+		if (pull_stream->IsStarting() == false)
+		{
+			NotifyStreamUpdated(pull_stream);
+		}
 
 		if(motor->UpdateStream(pull_stream) == false)
 		{
@@ -62,6 +62,14 @@ namespace pvd
 			}
 		}
 
+		if (IsAsyncStartSupported())
+		{
+			// The StreamMotor completes the start
+			_is_async_start_by_resume = false;
+			SetAsyncStartState(AsyncStartState::Starting);
+			return true;
+		}
+
 		logti("%s has started to play [%s(%u)] stream : %s", GetApplicationTypeName(), GetName().CStr(), GetId(), GetMediaSource().CStr());
 		return Stream::Start();
 	}
@@ -70,6 +78,12 @@ namespace pvd
 	{
 		std::lock_guard<std::mutex> lock(_start_stop_stream_lock);
 		StopStream();
+
+		if (IsStarting())
+		{
+			SetAsyncStartState(AsyncStartState::None);
+		}
+
 		return Stream::Stop();
 	}
 
@@ -87,12 +101,167 @@ namespace pvd
 
 			return false;
 		}
+
+		if (IsAsyncStartSupported())
+		{
+			// The StreamMotor completes the start, and the stream is updated then
+			_is_async_start_by_resume = true;
+			SetAsyncStartState(AsyncStartState::Starting);
+			return true;
+		}
+
 		UpdateStream();
 
 		_restart_count = 0;
 		return Stream::Start();
 	}
 
+	bool PullStream::IsStarting() const
+	{
+		return (_async_start_state == AsyncStartState::Starting) || (_async_start_state == AsyncStartState::Registering);
+	}
+
+	void PullStream::SetAsyncStartState(AsyncStartState state)
+	{
+		{
+			std::lock_guard<std::mutex> lock(_async_start_mutex);
+			_async_start_state = state;
+		}
+
+		_async_start_condition.notify_all();
+	}
+
+	bool PullStream::RetryAsyncStart()
+	{
+		while (true)
+		{
+			_restart_count++;
+			if (_restart_count > (_url_list.size() * _properties->GetRetryConnectCount()))
+			{
+				return false;
+			}
+
+			if (StartStream(GetNextURL()))
+			{
+				return true;
+			}
+		}
+	}
+
+	PullStream::ProcessMediaResult PullStream::ProcessStarting()
+	{
+		std::lock_guard<std::mutex> lock(_start_stop_stream_lock);
+
+		if (IsStarting() == false)
+		{
+			// Stopped while starting
+			return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+		}
+
+		if (_async_start_state == AsyncStartState::Registering)
+		{
+			return ProcessMediaResult::PROCESS_MEDIA_TRY_AGAIN;
+		}
+
+		auto result = ContinueStartStream();
+
+		if (result == ProcessMediaResult::PROCESS_MEDIA_TRY_AGAIN)
+		{
+			return result;
+		}
+
+		if (result == ProcessMediaResult::PROCESS_MEDIA_SUCCESS)
+		{
+			_restart_count = 0;
+
+			if (_is_async_start_by_resume)
+			{
+				UpdateStream();
+			}
+
+			logti("%s has started to play [%s(%u)] stream : %s", GetApplicationTypeName(), GetName().CStr(), GetId(), GetMediaSource().CStr());
+			Stream::Start();
+
+			if (_is_async_start_by_resume == false)
+			{
+				// The StreamMotor processes the media after CompleteRegistration()
+				SetAsyncStartState(AsyncStartState::Registering);
+				return ProcessMediaResult::PROCESS_MEDIA_TRY_AGAIN;
+			}
+
+			SetAsyncStartState(AsyncStartState::Started);
+			return result;
+		}
+
+		if (_is_async_start_by_resume)
+		{
+			// Same as the failure of Resume(), WhiteElephantCollector will resume the stream again
+			StopStream();
+			Stream::Stop();
+
+			_restart_count++;
+			if (_restart_count > _url_list.size() * _properties->GetRetryConnectCount())
+			{
+				SetState(Stream::State::TERMINATED);
+			}
+		}
+		else
+		{
+			// Same as Start(), try the next URL immediately
+			if (RetryAsyncStart())
+			{
+				return ProcessMediaResult::PROCESS_MEDIA_TRY_AGAIN;
+			}
+
+			StopStream();
+			SetState(Stream::State::TERMINATED);
+		}
+
+		SetAsyncStartState(AsyncStartState::Failed);
+		return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+	}
+
+	bool PullStream::WaitForStarted()
+	{
+		std::unique_lock<std::mutex> lock(_async_start_mutex);
+
+		_async_start_condition.wait(lock, [this]() -> bool {
+			return _async_start_state != AsyncStartState::Starting;
+		});
+
+		return (_async_start_state == AsyncStartState::Registering) || (_async_start_state == AsyncStartState::Started);
+	}
+
+	bool PullStream::CompleteRegistration()
+	{
+		std::lock_guard<std::mutex> lock(_start_stop_stream_lock);
+
+		if (_async_start_state != AsyncStartState::Registering)
+		{
+			return false;
+		}
+
+		SetAsyncStartState(AsyncStartState::Started);
+
+		return true;
+	}
+
+	bool PullStream::CompleteStart()
+	{
+		while (_async_start_state == AsyncStartState::Starting)
+		{
+			if (ProcessStarting() == ProcessMediaResult::PROCESS_MEDIA_TRY_AGAIN)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+		}
+
+		// The stream is not added to the application
+		CompleteRegistration();
+
+		return _async_start_state == AsyncStartState::Started;
+	}
+
 	const std::shared_ptr<const ov::Url> PullStream::GetNextURL()
 	{
 		if (_url_list.size() == 0)
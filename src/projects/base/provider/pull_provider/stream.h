@@ -51,6 +51,29 @@ namespace pvd
 		// Media data has to be processed here.
 		virtual ProcessMediaResult ProcessMediaPacket() = 0;
 
+		// Asynchronous start
+		//
+		// If IsAsyncStartSupported() returns true, StartStream()/RestartStream() only begin the connection without blocking,
+		// and the StreamMotor continues it by calling ProcessStarting() until the stream is playing or the start fails.
+		virtual bool IsAsyncStartSupported()
+		{
+			return false;
+		}
+		bool IsStarting() const;
+		// Called by the StreamMotor while the stream is starting
+		//   PROCESS_MEDIA_TRY_AGAIN: In progress
+		//   PROCESS_MEDIA_SUCCESS: The stream has started playing and can be added to the epoll
+		//                          (the stream started by Start() returns TRY_AGAIN until CompleteRegistration())
+		//   PROCESS_MEDIA_FAILURE: The start has failed (the stream is STOPPED or TERMINATED)
+		ProcessMediaResult ProcessStarting();
+		// Waits until the start driven by the StreamMotor is completed, returns true if the stream has started playing
+		bool WaitForStarted();
+		// The media of the stream started by Start() is not processed until the stream is added to the application,
+		// otherwise the MediaRouter drops the frames of the unknown stream. Returns false if the stream has been stopped.
+		bool CompleteRegistration();
+		// Drives the start in the calling thread, used for the stream which is not added to a StreamMotor
+		bool CompleteStart();
+
 	protected:
 		PullStream(const std::shared_ptr<pvd::Application> &application, const info::Stream &stream_info, const std::vector<ov::String> &url_list, const std::shared_ptr<pvd::PullStreamProperties> &properties = nullptr);
 
@@ -58,6 +81,13 @@ namespace pvd
 		virtual bool RestartStream(const std::shared_ptr<const ov::Url> &url) = 0; // Failover
 		virtual bool StopStream() = 0; // Stop
 
+		// Continues the start begun by StartStream()/RestartStream() if IsAsyncStartSupported() returns true
+		// Returns PROCESS_MEDIA_TRY_AGAIN while in progress, PROCESS_MEDIA_SUCCESS when the stream is playing
+		virtual ProcessMediaResult ContinueStartStream()
+		{
+			return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+		}
+
 		DirectionType GetDirectionType() override
 		{
 			return DirectionType::PULL;
@@ -73,6 +103,26 @@ namespace pvd
 		// It can be called by multiple thread
 		std::mutex _start_stop_stream_lock;
 
+		enum class AsyncStartState : uint8_t
+		{
+			None,
+			Starting,
+			// Playing, but waiting for CompleteRegistration()
+			Registering,
+			Started,
+			Failed
+		};
+
+		void SetAsyncStartState(AsyncStartState state);
+		// Returns false if all retries have been exhausted
+		bool RetryAsyncStart();
+
+		std::atomic<AsyncStartState> _async_start_state{AsyncStartState::None};
+		// The start by Resume() notifies the stream update when it is completed
+		bool _is_async_start_by_resume = false;
+		std::mutex _async_start_mutex;
+		std::condition_variable _async_start_condition;
+
 	public:
 		const std::shared_ptr<const ov::Url> GetNextURL();
 		const std::shared_ptr<const ov::Url> GetPrimaryURL();
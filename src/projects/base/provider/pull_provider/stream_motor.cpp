@@ -120,7 +120,9 @@ namespace pvd
 		_streams[stream->GetId()] = stream;
 		lock.unlock();
 
-		switch (stream->GetProcessMediaEventTriggerMode())
+		// The socket of the stream which is starting may not be connected yet,
+		// so it is added to the epoll when the start is completed
+		switch (stream->IsStarting() ? PullStream::ProcessMediaEventTrigger::TRIGGER_INTERVAL : stream->GetProcessMediaEventTriggerMode())
 		{
 			case PullStream::ProcessMediaEventTrigger::TRIGGER_EPOLL:
 				if (!AddStreamToEpoll(stream))
@@ -148,7 +150,9 @@ namespace pvd
 		}
 		lock.unlock();
 
-		switch (stream->GetProcessMediaEventTriggerMode())
+		// The socket of the stream which is starting may not be connected yet,
+		// so it is added to the epoll when the start is completed
+		switch (stream->IsStarting() ? PullStream::ProcessMediaEventTrigger::TRIGGER_INTERVAL : stream->GetProcessMediaEventTriggerMode())
 		{
 			case PullStream::ProcessMediaEventTrigger::TRIGGER_EPOLL:
 				if (!AddStreamToEpoll(stream))
@@ -195,13 +199,55 @@ namespace pvd
 		return true;
 	}
 
+	void StreamMotor::ProcessStartingStreams(bool &has_starting_stream)
+	{
+		std::vector<std::shared_ptr<PullStream>> starting_streams;
+
+		std::shared_lock<std::shared_mutex> stream_lock(_streams_map_guard);
+		for (const auto &[stream_id, stream] : _streams)
+		{
+			if (stream->IsStarting())
+			{
+				starting_streams.push_back(stream);
+			}
+		}
+		stream_lock.unlock();
+
+		has_starting_stream = false;
+
+		// The stream may notify the stream update when the start is completed, so it is called without the lock
+		for (const auto &stream : starting_streams)
+		{
+			auto result = stream->ProcessStarting();
+
+			if (result == PullStream::ProcessMediaResult::PROCESS_MEDIA_TRY_AGAIN)
+			{
+				has_starting_stream = true;
+			}
+			else if (result == PullStream::ProcessMediaResult::PROCESS_MEDIA_SUCCESS)
+			{
+				if (stream->GetProcessMediaEventTriggerMode() == PullStream::ProcessMediaEventTrigger::TRIGGER_EPOLL)
+				{
+					AddStreamToEpoll(stream);
+				}
+			}
+			else
+			{
+				// it will be resumed or deleted from WhiteElephantCollector
+			}
+		}
+	}
+
 	void StreamMotor::WorkerThread()
 	{
+		bool has_starting_stream = false;
+
 		while(true)
 		{
 			struct epoll_event epoll_events[MAX_EPOLL_EVENTS];
 
-			int event_count = epoll_wait(_epoll_fd, epoll_events, MAX_EPOLL_EVENTS, EPOLL_TIMEOUT_MSEC);
+			// Poll more frequently while streams are starting, so that each step of the start is not delayed
+			int event_count = epoll_wait(_epoll_fd, epoll_events, MAX_EPOLL_EVENTS, has_starting_stream ? STARTING_EPOLL_TIMEOUT_MSEC : EPOLL_TIMEOUT_MSEC);
 
 			if(_stop_thread_flag)
 			{
@@ -276,6 +322,8 @@ namespace pvd
 				}
 			}
 
+			ProcessStartingStreams(has_starting_stream);
+
 			std::shared_lock<std::shared_mutex> stream_lock(_streams_map_guard);
 			for (const auto &[stream_id, stream] : _streams)
 			{
@@ -283,6 +331,9 @@ namespace pvd
 				if (stream->GetProcessMediaEventTriggerMode() != PullStream::ProcessMediaEventTrigger::TRIGGER_INTERVAL)
 					continue;
 
+				if (stream->IsStarting())
+					continue;
+
 				if (stream->GetState() == Stream::State::PLAYING)
 				{
 					auto result = stream->ProcessMediaPacket();
@@ -21,6 +21,7 @@
 
 #define MAX_EPOLL_EVENTS						1024
 #define EPOLL_TIMEOUT_MSEC						100
+#define STARTING_EPOLL_TIMEOUT_MSEC				10
 namespace pvd
 {
 	class StreamMotor
@@ -42,6 +43,9 @@ namespace pvd
 		bool AddStreamToEpoll(const std::shared_ptr<PullStream> &stream);
 		bool DelStreamFromEpoll(const std::shared_ptr<PullStream> &stream);
 
+		// Continues the asynchronous start of the streams
+		void ProcessStartingStreams(bool &has_starting_stream);
+
 		void WorkerThread();
 
 		uint32_t _id;
@@ -6,7 +6,7 @@
 #include "base/info/push.h"
 #include "base/mediarouter/media_buffer.h"
 #include "base/mediarouter/media_event.h"
-#include "modules/managed_queue/managed_queue.h"
+#include "modules/managed_queue/lock_free_managed_queue.h"
 #include "session.h"
 
 #define MAX_STREAM_WORKER_THREAD_COUNT 72
@@ -41,7 +41,7 @@ namespace pub
 		ov::Semaphore _queue_event;
 
 		std::optional<std::any> PopStreamPacket();
-		ov::ManagedQueue<std::any> _packet_queue;
+		ov::LockFreeManagedQueue<std::any> _packet_queue;
 
 		struct SessionMessage
 		{
@@ -10,6 +10,8 @@
 
 #include "p2p.h"
 #include "recovery.h"
+#include "response_compression.h"
+#include "transcoder_worker_pool.h"
 
 namespace cfg
 {
@@ -29,6 +31,9 @@ namespace cfg
 			ModuleTemplate _etag{false};
 			// Experimental feature is disabled by default
 			ModuleTemplate _ertmp{false};
+			// Experimental feature is disabled by default
+			TranscoderWorkerPool _transcoder_worker_pool{false};
+			ResponseCompression _response_compression{true};
 
 		public:
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetHttp2, _http2)
@@ -38,6 +43,8 @@ namespace cfg
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetDynamicAppRemoval, _dynamic_app_removal)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetETag, _etag)
 			CFG_DECLARE_CONST_REF_GETTER_OF(GetERTMP, _ertmp)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetTranscoderWorkerPool, _transcoder_worker_pool)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetResponseCompression, _response_compression)
 
 		protected:
 			void MakeList() override
@@ -49,6 +56,8 @@ namespace cfg
 				Register<Optional>("DynamicAppRemoval", &_dynamic_app_removal);
 				Register<Optional>("ETag", &_etag);
 				Register<Optional>("ERTMP", &_ertmp);
+				Register<Optional>("TranscoderWorkerPool", &_transcoder_worker_pool);
+				Register<Optional>("ResponseCompression", &_response_compression);
 			}
 		};
 	}  // namespace modules
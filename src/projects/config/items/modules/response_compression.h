@@ -0,0 +1,58 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		struct ResponseCompression : public ModuleTemplate
+		{
+		protected:
+			// Responses smaller than this are not compressed
+			int _min_size = 1024;
+			int _cache_size_mb = 64;
+
+		public:
+			ResponseCompression(bool enable) : ModuleTemplate(enable)
+			{
+			}
+
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetMinSize, _min_size)
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetCacheSizeMB, _cache_size_mb)
+
+		protected:
+			void MakeList() override
+			{
+				ModuleTemplate::MakeList();
+
+				/**
+					Compresses the text responses of the HTTP server (playlists, JSON of the REST API, ...)
+					according to the Accept-Encoding of the request.
+
+					The compressed data is cached by the content, so the same version of a playlist
+					is compressed only once no matter how many clients request it.
+
+					server.xml:
+						<Modules>
+							<ResponseCompression>
+								<Enable>true</Enable>
+								<MinSize>1024</MinSize>
+								<CacheSizeMB>64</CacheSizeMB>
+							</ResponseCompression>
+						</Modules>
+				*/
+				Register<Optional>("MinSize", &_min_size);
+				Register<Optional>("CacheSizeMB", &_cache_size_mb);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
@@ -0,0 +1,55 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Keukhan Kwon
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "module_template.h"
+
+namespace cfg
+{
+	namespace modules
+	{
+		struct TranscoderWorkerPool : public ModuleTemplate
+		{
+		protected:
+			int _worker_count = 0;
+
+		public:
+			// Experimental feature is disabled by default
+			TranscoderWorkerPool(bool enable) : ModuleTemplate(enable)
+			{
+			}
+
+			CFG_DECLARE_CONST_REF_GETTER_OF(GetWorkerCount, _worker_count)
+
+		protected:
+			void MakeList() override
+			{
+				ModuleTemplate::MakeList();
+
+				/**
+					[Experimental] Shared worker pool of the transcoder
+
+					Instead of creating a thread for each filter, the filters of all streams are executed 
+					by a shared worker pool. The tasks of the same stream are assigned to the same worker, 
+					and idle workers steal tasks from busy workers.
+
+					server.xml:
+						<Modules>
+							<TranscoderWorkerPool>
+								<Enable>true</Enable>
+								<!-- If this value is set to zero, the number of CPU cores is used. -->
+								<WorkerCount>0</WorkerCount>
+							</TranscoderWorkerPool>
+						</Modules>
+				*/
+				Register<Optional>("WorkerCount", &_worker_count);
+			}
+		};
+	}  // namespace modules
+}  // namespace cfg
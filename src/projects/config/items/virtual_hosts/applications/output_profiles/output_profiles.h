@@ -25,11 +25,13 @@ namespace cfg
 				protected:
 					bool _hwaccel = false;
 					HWAccels _hwaccels;
+					bool _cascaded_scaling = false;
 					std::vector<OutputProfile> _output_profiles;
 					Decodes _decodes;
 				public:
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsHardwareAcceleration, _hwaccel);
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetHWAccels, _hwaccels);
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsCascadedScaling, _cascaded_scaling);
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetOutputProfileList, _output_profiles);
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetDecodes, _decodes);
 
@@ -45,6 +47,7 @@ namespace cfg
 							}
 						);
 						Register<Optional>({"HWAccels", "hwaccels"}, &_hwaccels);
+						Register<Optional>("CascadedScaling", &_cascaded_scaling);
 						Register<Optional>("OutputProfile", &_output_profiles);
 						Register<Optional>({"Decodes", "decodes"}, &_decodes);
 					}
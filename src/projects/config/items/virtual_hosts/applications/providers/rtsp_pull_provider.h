@@ -26,6 +26,8 @@ namespace cfg
 					}
 
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsBlockDuplicateStreamName, _is_block_duplicate_stream_name)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetConnectTimeout, _connect_timeout)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetRequestTimeout, _request_timeout)
 
 				protected:
 					void MakeList() override
@@ -33,11 +35,17 @@ namespace cfg
 						Provider::MakeList();
 
 						Register<Optional>("BlockDuplicateStreamName", &_is_block_duplicate_stream_name);
+						Register<Optional>("ConnectTimeout", &_connect_timeout);
+						Register<Optional>("RequestTimeout", &_request_timeout);
 					}
 
 					// true: block(disconnect) new incoming stream
 					// false: don't block new incoming stream
 					bool _is_block_duplicate_stream_name = true;
+					// Timeout (milliseconds) of connecting to the RTSP server
+					int _connect_timeout = 3000;
+					// Timeout (milliseconds) of each request (DESCRIBE, SETUP, PLAY) while starting the stream
+					int _request_timeout = 3000;
 				};
 			}  // namespace pvd
 		}	   // namespace app
@@ -25,6 +25,10 @@ namespace cfg
 					double _chunk_duration = 0.5;
 					double _part_hold_back = 0; // it will be set to 3 * chunk_duration automatically
 					bool _enable_preload_hint = true;
+					// Push the part of EXT-X-PRELOAD-HINT with the chunklist (HTTP/2 only)
+					bool _enable_http2_push = false;
+					// Deliver the part in progress with chunked transfer (HTTP/1.1) or open DATA frames (HTTP/2) as it is packaged
+					bool _enable_progressive_part = false;
 					Drm _drm;
 
 				public:
@@ -36,6 +40,8 @@ namespace cfg
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetChunkDuration, _chunk_duration)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetPartHoldBack, _part_hold_back)
 					CFG_DECLARE_CONST_REF_GETTER_OF(IsPreloadHintEnabled, _enable_preload_hint)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsHttp2PushEnabled, _enable_http2_push)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsProgressivePartEnabled, _enable_progressive_part)
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetDrm, _drm)
 
 				protected:
@@ -46,6 +52,8 @@ namespace cfg
 						Register<Optional>("ChunkDuration", &_chunk_duration);
 						Register<Optional>("PartHoldBack", &_part_hold_back);
 						Register<Optional>("EnablePreloadHint", &_enable_preload_hint);
+						Register<Optional>("EnableHttp2Push", &_enable_http2_push);
+						Register<Optional>("EnableProgressivePart", &_enable_progressive_part);
 						Register<Optional>("DRM", &_drm);
 					}
 				};
@@ -29,14 +29,22 @@ namespace cfg
 
 				protected:
 					pub::StreamMap _stream_map;
+					// Use the built-in nonblocking RTMP client instead of ffmpeg for rtmp:// destinations
+					bool _native_rtmp = false;
+					// Maximum bytes queued to the socket per push before packets are dropped until the next key frame
+					int _send_buffer_size = 4 * 1024 * 1024;
 
 				public:
 					CFG_DECLARE_CONST_REF_GETTER_OF(GetStreamMap, _stream_map)
+					CFG_DECLARE_CONST_REF_GETTER_OF(IsNativeRtmp, _native_rtmp)
+					CFG_DECLARE_CONST_REF_GETTER_OF(GetSendBufferSize, _send_buffer_size)
 
 				protected:
 					void MakeList() override
 					{
 						Register<Optional>({"StreamMap", "streamMap"}, &_stream_map);
+						Register<Optional>({"NativeRtmp", "nativeRtmp"}, &_native_rtmp);
+						Register<Optional>({"SendBufferSize", "sendBufferSize"}, &_send_buffer_size);
 					}
 				};
 			}  // namespace pub
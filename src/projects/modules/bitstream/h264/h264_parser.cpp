@@ -2,6 +2,8 @@
 
 #include "h264_decoder_configuration_record.h"
 
+#include "../nalu/nal_unit_scanner.h"
+
 #define OV_LOG_TAG "H264Parser"
 
 std::vector<NaluIndex> H264Parser::FindNaluIndexes(const uint8_t *bitstream, size_t length)
@@ -51,41 +53,14 @@ std::vector<NaluIndex> H264Parser::FindNaluIndexes(const uint8_t *bitstream, siz
 
 int H264Parser::FindAnnexBStartCode(const uint8_t *bitstream, size_t length, size_t &start_code_size)
 {
-	size_t offset = 0;
-	start_code_size = 0;
+	auto offset = NalUnitScanner::FindStartCode(bitstream, length, 0, &start_code_size);
 
-	while (offset < length)
+	if (start_code_size == 0)
 	{
-		size_t remaining = length - offset;
-		const uint8_t *data = bitstream + offset;
-
-		// fast forward to the next start code
-		// if the 3rd byte isn't 1 or 0, we can skip 3 bytes
-		if (remaining >= 3 && data[2] > 0x01)
-		{
-			offset += 3;
-		}
-		else if ((remaining >= 3 && data[0] == 0x00 && data[1] == 0x00 && data[2] == 0x01) ||
-			(remaining >= 4 && data[0] == 0x00 && data[1] == 0x00 && data[2] == 0x00 && data[3] == 0x01))
-		{
-			if (data[2] == 0x01)
-			{
-				start_code_size = 3;
-			}
-			else
-			{
-				start_code_size = 4;
-			}
-
-			return offset;
-		}
-		else
-		{
-			offset += 1;
-		}
+		return -1;
 	}
 
-	return -1;
+	return static_cast<int>(offset);
 }
 
 bool H264Parser::CheckAnnexBKeyframe(const uint8_t *bitstream, size_t length)
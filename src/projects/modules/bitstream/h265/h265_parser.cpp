@@ -6,41 +6,22 @@
 
 #include "h265_types.h"
 
+#include "../nalu/nal_unit_scanner.h"
+
 #define OV_LOG_TAG "H265Parser"
 
 // returns offset (start point), code_size : 3(001) or 4(0001)
 // returns -1 if there is no start code in the buffer
 int H265Parser::FindAnnexBStartCode(const uint8_t *bitstream, size_t length, size_t &start_code_size)
 {
-	size_t offset = 0;
-	start_code_size = 0;
+	auto offset = NalUnitScanner::FindStartCode(bitstream, length, 0, &start_code_size);
 
-	while (offset < length)
+	if (start_code_size == 0)
 	{
-		size_t remaining = length - offset;
-		const uint8_t *data = bitstream + offset;
-
-		if ((remaining >= 3 && data[0] == 0x00 && data[1] == 0x00 && data[2] == 0x01) ||
-			(remaining >= 4 && data[0] == 0x00 && data[1] == 0x00 && data[2] == 0x00 && data[3] == 0x01))
-		{
-			if (data[2] == 0x01)
-			{
-				start_code_size = 3;
-			}
-			else
-			{
-				start_code_size = 4;
-			}
-
-			return offset;
-		}
-		else
-		{
-			offset += 1;
-		}
+		return -1;
 	}
 
-	return -1;
+	return static_cast<int>(offset);
 }
 
 bool H265Parser::CheckKeyframe(const uint8_t *bitstream, size_t length)
@@ -48,37 +29,27 @@ bool H265Parser::CheckKeyframe(const uint8_t *bitstream, size_t length)
 	size_t offset = 0;
 	while (offset < length)
 	{
-		size_t remaining = length - offset;
-		const uint8_t *data = bitstream + offset;
+		size_t start_code_size = 0;
+		offset = NalUnitScanner::FindStartCode(bitstream, length, offset, &start_code_size);
 
-		if ((remaining >= 3 && data[0] == 0x00 && data[1] == 0x00 && data[2] == 0x01) ||
-			(remaining >= 4 && data[0] == 0x00 && data[1] == 0x00 && data[2] == 0x00 && data[3] == 0x01))
+		if (start_code_size == 0)
 		{
-			if (data[2] == 0x01)
-			{
-				offset += 3;
-			}
-			else
-			{
-				offset += 4;
-			}
+			break;
+		}
 
-			if (length - offset > H265_NAL_UNIT_HEADER_SIZE)
-			{
-				H265NalUnitHeader header;
-				ParseNalUnitHeader(bitstream + offset, H265_NAL_UNIT_HEADER_SIZE, header);
+		offset += start_code_size;
 
-				if (header.GetNalUnitType() == H265NALUnitType::IDR_W_RADL ||
-					header.GetNalUnitType() == H265NALUnitType::CRA_NUT ||
-					header.GetNalUnitType() == H265NALUnitType::BLA_W_RADL)
-				{
-					return true;
-				}
-			}
-		}
-		else
+		if (length - offset > H265_NAL_UNIT_HEADER_SIZE)
 		{
-			offset++;
+			H265NalUnitHeader header;
+			ParseNalUnitHeader(bitstream + offset, H265_NAL_UNIT_HEADER_SIZE, header);
+
+			if (header.GetNalUnitType() == H265NALUnitType::IDR_W_RADL ||
+				header.GetNalUnitType() == H265NALUnitType::CRA_NUT ||
+				header.GetNalUnitType() == H265NALUnitType::BLA_W_RADL)
+			{
+				return true;
+			}
 		}
 	}
 	return false;
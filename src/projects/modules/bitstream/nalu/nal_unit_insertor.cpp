@@ -2,6 +2,7 @@
 
 #include <modules/bitstream/h264/h264_parser.h>
 #include <modules/bitstream/nalu/nal_unit_fragment_header.h>
+#include <modules/bitstream/nalu/nal_unit_scanner.h>
 
 #define OV_LOG_TAG "NalUnitInsertor"
 
@@ -137,38 +138,41 @@ std::shared_ptr<ov::Data> NalUnitInsertor::EmulationPreventionBytes(const std::s
 		return nullptr;
 	}
 
-	ov::ByteStream stream(nal);
-	ov::ByteStream new_nal(nal->GetLength() + (nal->GetLength() / 2));
-	
-	int8_t zeroCount  = 0;
+	static const uint8_t EMULATION_PREVENTION_BYTE = 0x03;
 
-	while (stream.Remained() > 0)
+	auto buffer = nal->GetDataAs<uint8_t>();
+	size_t length = nal->GetLength();
+	auto new_nal = std::make_shared<ov::Data>(length + (length / 2));
+
+	size_t offset = 0;
+	size_t last_offset = 0;
+
+	while (true)
 	{
-		uint8_t byte = stream.Read8();
+		// 00 00 0x (x <= 0x03)
+		offset = NalUnitScanner::FindEmulationPreventionPattern(buffer, length, offset);
 
-		if (zeroCount == 2 && byte == 0x03)
+		if (offset >= length)
 		{
-			zeroCount = 0;
+			break;
 		}
 
-		if (zeroCount == 2 && byte <= 0x03)
-		{
-			new_nal.Write8(0x03);
-			zeroCount = 0;
-		}
+		auto third_offset = offset + 2;
 
-		if (byte == 0x00)
+		// 00 00 03 is regarded as already escaped
+		if (buffer[third_offset] != EMULATION_PREVENTION_BYTE)
 		{
-			zeroCount++;
-		}
-		else
-		{
-			zeroCount = 0;
+			new_nal->Append(buffer + last_offset, third_offset - last_offset);
+			new_nal->Append(&EMULATION_PREVENTION_BYTE, sizeof(EMULATION_PREVENTION_BYTE));
+
+			last_offset = third_offset;
 		}
 
-		new_nal.Write8(byte);
+		// The zero count is reset after the third byte, so the next pattern can start from it
+		offset = third_offset;
 	}
 
+	new_nal->Append(buffer + last_offset, length - last_offset);
 
-	return new_nal.GetDataPointer();;
+	return new_nal;
 }
@@ -0,0 +1,163 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "nal_unit_scanner.h"
+
+#if defined(__x86_64__)
+#	include <immintrin.h>
+#	define NAL_UNIT_SCANNER_USE_X86_64 1
+#else
+#	define NAL_UNIT_SCANNER_USE_X86_64 0
+#endif
+
+namespace
+{
+	using FindFunction = size_t (*)(const uint8_t *bitstream, size_t length, size_t offset, uint8_t third_mask, uint8_t third_value);
+
+	size_t FindScalar(const uint8_t *bitstream, size_t length, size_t offset, uint8_t third_mask, uint8_t third_value)
+	{
+		while ((offset + 3) <= length)
+		{
+			const uint8_t *data = bitstream + offset;
+
+			if ((data[2] != 0x00) && ((data[2] & third_mask) != third_value))
+			{
+				// The pattern can't start at data[0], data[1] and data[2]
+				offset += 3;
+			}
+			else if (data[1] != 0x00)
+			{
+				// The pattern can't start at data[0] and data[1]
+				offset += 2;
+			}
+			else if ((data[0] == 0x00) && ((data[2] & third_mask) == third_value))
+			{
+				return offset;
+			}
+			else
+			{
+				offset++;
+			}
+		}
+
+		return length;
+	}
+
+#if NAL_UNIT_SCANNER_USE_X86_64
+	// SSE2 is always available on x86-64
+	size_t FindSse2(const uint8_t *bitstream, size_t length, size_t offset, uint8_t third_mask, uint8_t third_value)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i mask = _mm_set1_epi8(static_cast<char>(third_mask));
+		const __m128i value = _mm_set1_epi8(static_cast<char>(third_value));
+
+		// Compare 16 positions at once: data[i] == 0 && data[i + 1] == 0 && (data[i + 2] & mask) == value
+		while ((offset + 16 + 2) <= length)
+		{
+			const uint8_t *data = bitstream + offset;
+
+			auto first = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data)), zero);
+			auto second = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 1)), zero);
+			auto third = _mm_cmpeq_epi8(_mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 2)), mask), value);
+
+			auto bits = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_and_si128(first, second), third)));
+
+			if (bits != 0)
+			{
+				return offset + __builtin_ctz(bits);
+			}
+
+			offset += 16;
+		}
+
+		return FindScalar(bitstream, length, offset, third_mask, third_value);
+	}
+
+	__attribute__((target("avx2"))) size_t FindAvx2(const uint8_t *bitstream, size_t length, size_t offset, uint8_t third_mask, uint8_t third_value)
+	{
+		const __m256i zero = _mm256_setzero_si256();
+		const __m256i mask = _mm256_set1_epi8(static_cast<char>(third_mask));
+		const __m256i value = _mm256_set1_epi8(static_cast<char>(third_value));
+
+		while ((offset + 32 + 2) <= length)
+		{
+			const uint8_t *data = bitstream + offset;
+
+			auto first = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data)), zero);
+			auto second = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + 1)), zero);
+			auto third = _mm256_cmpeq_epi8(_mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + 2)), mask), value);
+
+			auto bits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_and_si256(first, second), third)));
+
+			if (bits != 0)
+			{
+				return offset + __builtin_ctz(bits);
+			}
+
+			offset += 32;
+		}
+
+		return FindSse2(bitstream, length, offset, third_mask, third_value);
+	}
+#endif	// NAL_UNIT_SCANNER_USE_X86_64
+
+	FindFunction SelectFindFunction()
+	{
+#if NAL_UNIT_SCANNER_USE_X86_64
+		__builtin_cpu_init();
+
+		if (__builtin_cpu_supports("avx2"))
+		{
+			return FindAvx2;
+		}
+
+		return FindSse2;
+#else	// NAL_UNIT_SCANNER_USE_X86_64
+		return FindScalar;
+#endif	// NAL_UNIT_SCANNER_USE_X86_64
+	}
+}  // namespace
+
+size_t NalUnitScanner::FindZeroZeroPattern(const uint8_t *bitstream, size_t length, size_t offset, uint8_t third_mask, uint8_t third_value)
+{
+	static const FindFunction find_function = SelectFindFunction();
+
+	if ((bitstream == nullptr) || (offset >= length))
+	{
+		return length;
+	}
+
+	return find_function(bitstream, length, offset, third_mask, third_value);
+}
+
+size_t NalUnitScanner::FindStartCode(const uint8_t *bitstream, size_t length, size_t offset, size_t *start_code_size)
+{
+	// Find 00 00 01, and then check whether it is a part of 00 00 00 01
+	auto position = FindZeroZeroPattern(bitstream, length, offset, 0xFF, 0x01);
+
+	if (position >= length)
+	{
+		*start_code_size = 0;
+		return length;
+	}
+
+	if ((position > offset) && (bitstream[position - 1] == 0x00))
+	{
+		*start_code_size = 4;
+		return position - 1;
+	}
+
+	*start_code_size = 3;
+	return position;
+}
+
+size_t NalUnitScanner::FindEmulationPreventionPattern(const uint8_t *bitstream, size_t length, size_t offset)
+{
+	// 00 00 00, 00 00 01, 00 00 02, 00 00 03
+	return FindZeroZeroPattern(bitstream, length, offset, 0xFC, 0x00);
+}
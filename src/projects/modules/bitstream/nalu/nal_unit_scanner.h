@@ -0,0 +1,34 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Finds the byte patterns of H.264/H.265 Annex-B bitstream (start codes, emulation prevention)
+//
+// Uses SSE2/AVX2 on x86-64 (AVX2 is selected at runtime), and a scalar loop on the other platforms
+class NalUnitScanner
+{
+public:
+	// Returns the offset of the first start code (00 00 01 or 00 00 00 01) at or after `offset`,
+	// or `length` if there is no start code
+	//
+	// start_code_size: 3 or 4 (0 if there is no start code)
+	static size_t FindStartCode(const uint8_t *bitstream, size_t length, size_t offset, size_t *start_code_size);
+
+	// Returns the offset of the first 3-byte sequence 00 00 0x (x <= 0x03) at or after `offset`, or `length` if not found
+	//
+	// In NAL unit payload, these sequences must be escaped with emulation_prevention_three_byte (0x03)
+	static size_t FindEmulationPreventionPattern(const uint8_t *bitstream, size_t length, size_t offset);
+
+	// Returns the offset of the first 3-byte sequence `00 00 x` at or after `offset` where `(x & third_mask) == third_value`,
+	// or `length` if not found
+	static size_t FindZeroZeroPattern(const uint8_t *bitstream, size_t length, size_t offset, uint8_t third_mask, uint8_t third_value);
+};
@@ -2215,20 +2215,25 @@ namespace bmff
 		return WriteFullBox(container_stream, "senc", *stream.GetData(), 0, flag);
 	}
 
-	bool Packager::WriteMdatBox(ov::ByteStream &container_stream, const std::shared_ptr<const Samples> &samples)
+	bool Packager::WriteMdatBox(ov::ByteStream &container_stream, const std::shared_ptr<const Samples> &samples, std::vector<std::shared_ptr<const ov::Data>> &payload_list)
 	{
 		// ISO/IEC 14496-12 8.1.1
 		// aligned(8) class MediaDataBox extends Box(‘mdat’)
 		// {
 		// 	bit(8) data[];
 		// }
-		auto data = std::make_shared<ov::Data>(samples->GetTotalSize());
+
+		// Box header (size + type)
+		container_stream.WriteBE32(samples->GetTotalSize() + BMFF_BOX_HEADER_SIZE);
+		container_stream.WriteText("mdat");
+
+		// data[] refers to the payloads of the media packets
 		for (const auto &sample : samples->GetList())
 		{
-			data->Append(sample._media_packet->GetData());
+			payload_list.push_back(sample._media_packet->GetData());
 		}
 
-		return WriteBox(container_stream, "mdat", *data);
+		return true;
 	}
 	
 	bool Packager::WriteBaseDescriptor(ov::ByteStream &stream, uint8_t tag, const ov::Data &data)
@@ -96,7 +96,8 @@ namespace bmff
 		virtual bool WriteTrunBox(ov::ByteStream &container_stream, const std::shared_ptr<const Samples> &samples);
 		virtual bool GetSampleFlags(const std::shared_ptr<const MediaPacket> &sample, uint32_t &flags);
 
-		virtual bool WriteMdatBox(ov::ByteStream &container_stream, const std::shared_ptr<const Samples> &samples);
+		// Writes only the header of mdat box to container_stream, and appends the payloads of the samples to payload_list without copying them
+		virtual bool WriteMdatBox(ov::ByteStream &container_stream, const std::shared_ptr<const Samples> &samples, std::vector<std::shared_ptr<const ov::Data>> &payload_list);
 
 		// Write BaseDescriptor
 		bool WriteBaseDescriptor(ov::ByteStream &stream, uint8_t tag, const ov::Data &data);
@@ -0,0 +1,236 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "fmp4_dvr_writer.h"
+
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "fmp4_private.h"
+
+namespace bmff
+{
+	FMP4DvrWriter::FMP4DvrWriter()
+	{
+	}
+
+	FMP4DvrWriter::~FMP4DvrWriter()
+	{
+		Stop();
+	}
+
+	void FMP4DvrWriter::Start()
+	{
+		for (size_t index = 0; index < _shards.size(); index++)
+		{
+			auto shard = &_shards[index];
+
+			shard->thread = std::thread(&FMP4DvrWriter::WriterThread, this, shard);
+			pthread_setname_np(shard->thread.native_handle(), ov::String::FormatString("DVRWriter-%zu", index).CStr());
+		}
+
+		logti("DVR writer has been started (threads: %zu, max queued jobs per thread: %zu)", _shards.size(), MaxQueuedJobsPerThread);
+	}
+
+	void FMP4DvrWriter::Stop()
+	{
+		_stop_requested = true;
+
+		for (auto &shard : _shards)
+		{
+			{
+				std::lock_guard<std::mutex> lock(shard.mutex);
+				shard.not_empty.notify_all();
+				shard.not_full.notify_all();
+			}
+
+			if (shard.thread.joinable())
+			{
+				shard.thread.join();
+			}
+		}
+	}
+
+	bool FMP4DvrWriter::Enqueue(Job job)
+	{
+		if ((_stop_requested == true) || (job.task == nullptr))
+		{
+			return false;
+		}
+
+		std::call_once(_start_flag, [this]() { Start(); });
+
+		auto &shard = _shards[std::hash<std::string>()(job.key.CStr()) % _shards.size()];
+		auto bytes = job.bytes;
+
+		std::unique_lock<std::mutex> lock(shard.mutex);
+
+		if (shard.jobs.size() >= MaxQueuedJobsPerThread)
+		{
+			// The disk cannot keep up with the packagers, so the producer has to wait
+			ov::StopWatch stop_watch;
+			stop_watch.Start();
+
+			shard.not_full.wait(lock, [&]() {
+				return (shard.jobs.size() < MaxQueuedJobsPerThread) || (_stop_requested == true);
+			});
+
+			auto elapsed = stop_watch.Elapsed();
+
+			_blocked_count++;
+			_blocked_time_ms += elapsed;
+
+			logtw("DVR writer is too slow, the packager was blocked for %" PRId64 " ms (key: %s, queued jobs: %zu, queued bytes: %zu)",
+				  elapsed, job.key.CStr(), _queued_jobs.load(), _queued_bytes.load());
+
+			if (_stop_requested == true)
+			{
+				return false;
+			}
+		}
+
+		shard.jobs.push_back(std::move(job));
+
+		auto queued_jobs = ++_queued_jobs;
+		_queued_bytes += bytes;
+
+		auto peak = _peak_queued_jobs.load();
+		while ((queued_jobs > peak) && (_peak_queued_jobs.compare_exchange_weak(peak, queued_jobs) == false))
+		{
+		}
+
+		shard.not_empty.notify_one();
+
+		return true;
+	}
+
+	void FMP4DvrWriter::WriterThread(Shard *shard)
+	{
+		while (true)
+		{
+			Job job;
+
+			{
+				std::unique_lock<std::mutex> lock(shard->mutex);
+
+				shard->not_empty.wait(lock, [&]() {
+					return (shard->jobs.empty() == false) || (_stop_requested == true);
+				});
+
+				if (shard->jobs.empty())
+				{
+					// Stop is requested
+					break;
+				}
+
+				job = std::move(shard->jobs.front());
+				shard->jobs.pop_front();
+
+				shard->not_full.notify_one();
+			}
+
+			// Remaining jobs are still executed while stopping, so that every pending segment is persisted
+			job.task();
+
+			_queued_jobs--;
+			_queued_bytes -= job.bytes;
+			_completed_jobs++;
+			_completed_bytes += job.bytes;
+		}
+	}
+
+	FMP4DvrWriter::Stats FMP4DvrWriter::GetStats() const
+	{
+		Stats stats;
+
+		stats.queued_jobs = _queued_jobs;
+		stats.queued_bytes = _queued_bytes;
+		stats.peak_queued_jobs = _peak_queued_jobs;
+		stats.completed_jobs = _completed_jobs;
+		stats.completed_bytes = _completed_bytes;
+		stats.blocked_count = _blocked_count;
+		stats.blocked_time_ms = _blocked_time_ms;
+
+		return stats;
+	}
+
+	bool FMP4DvrWriter::WriteToFile(const ov::String &file_path, const FMP4DataList &data_list)
+	{
+		auto temp_file_path = file_path + ".tmp";
+
+		int fd = ::open(temp_file_path.CStr(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+		if (fd < 0)
+		{
+			logte("Could not open file: %s (%s)", temp_file_path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+			return false;
+		}
+
+		std::vector<struct iovec> iov_list;
+		iov_list.reserve(data_list.size());
+
+		for (const auto &data : data_list)
+		{
+			if ((data != nullptr) && (data->GetLength() > 0))
+			{
+				iov_list.push_back({const_cast<void *>(data->GetData()), data->GetLength()});
+			}
+		}
+
+		bool result = true;
+		size_t index = 0;
+
+		while (index < iov_list.size())
+		{
+			auto count = std::min(iov_list.size() - index, static_cast<size_t>(IOV_MAX));
+			auto written = ::writev(fd, &iov_list[index], count);
+
+			if (written < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				logte("Could not write to file: %s (%s)", temp_file_path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+				result = false;
+				break;
+			}
+
+			// Skip the fully written buffers, and adjust the partially written one
+			auto remained = static_cast<size_t>(written);
+			while ((index < iov_list.size()) && (remained >= iov_list[index].iov_len))
+			{
+				remained -= iov_list[index].iov_len;
+				index++;
+			}
+
+			if (remained > 0)
+			{
+				iov_list[index].iov_base = static_cast<uint8_t *>(iov_list[index].iov_base) + remained;
+				iov_list[index].iov_len -= remained;
+			}
+		}
+
+		::close(fd);
+
+		if ((result == false) || (::rename(temp_file_path.CStr(), file_path.CStr()) != 0))
+		{
+			if (result == true)
+			{
+				logte("Could not rename file: %s -> %s (%s)", temp_file_path.CStr(), file_path.CStr(), ov::Error::CreateErrorFromErrno()->What());
+			}
+
+			::unlink(temp_file_path.CStr());
+			return false;
+		}
+
+		return true;
+	}
+}  // namespace bmff
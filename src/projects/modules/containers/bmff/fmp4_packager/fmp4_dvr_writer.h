@@ -0,0 +1,89 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include "fmp4_structure.h"
+
+namespace bmff
+{
+	// Persists DVR segments in the background so that the packaging path never waits for the disk
+	//
+	// Jobs are distributed to the writer threads by key (DVR directory of the track), so the jobs of a track
+	// are always executed in order by the same thread. Each thread has a bounded queue, and Enqueue() blocks
+	// the producer only when the queue is full (backpressure).
+	class FMP4DvrWriter : public ov::Singleton<FMP4DvrWriter>
+	{
+	public:
+		struct Job
+		{
+			ov::String key;
+			// Used only for statistics
+			size_t bytes = 0;
+			std::function<void()> task;
+		};
+
+		struct Stats
+		{
+			// Jobs waiting in the queues
+			size_t queued_jobs = 0;
+			size_t queued_bytes = 0;
+			size_t peak_queued_jobs = 0;
+
+			uint64_t completed_jobs = 0;
+			uint64_t completed_bytes = 0;
+
+			// The number of times the producer had to wait for the queue (backpressure)
+			uint64_t blocked_count = 0;
+			uint64_t blocked_time_ms = 0;
+		};
+
+		static constexpr size_t WriterThreadCount = 2;
+		static constexpr size_t MaxQueuedJobsPerThread = 64;
+
+		FMP4DvrWriter();
+		~FMP4DvrWriter() override;
+
+		bool Enqueue(Job job);
+
+		Stats GetStats() const;
+
+		// Writes the data list to the file using writev() (the list is not copied into a contiguous buffer)
+		//
+		// The data is written to a temporary file and then renamed, so readers never see a partially written segment
+		static bool WriteToFile(const ov::String &file_path, const FMP4DataList &data_list);
+
+	private:
+		struct Shard
+		{
+			std::mutex mutex;
+			std::condition_variable not_empty;
+			std::condition_variable not_full;
+			std::deque<Job> jobs;
+			std::thread thread;
+		};
+
+		void Start();
+		void Stop();
+		void WriterThread(Shard *shard);
+
+		std::once_flag _start_flag;
+		std::atomic<bool> _stop_requested{false};
+		std::array<Shard, WriterThreadCount> _shards;
+
+		std::atomic<size_t> _queued_jobs{0};
+		std::atomic<size_t> _queued_bytes{0};
+		std::atomic<size_t> _peak_queued_jobs{0};
+		std::atomic<uint64_t> _completed_jobs{0};
+		std::atomic<uint64_t> _completed_bytes{0};
+		std::atomic<uint64_t> _blocked_count{0};
+		std::atomic<uint64_t> _blocked_time_ms{0};
+	};
+}  // namespace bmff
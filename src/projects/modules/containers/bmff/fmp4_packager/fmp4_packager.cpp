@@ -307,44 +307,20 @@ namespace bmff
 					((next_total_sample_duration_ms > _target_chunk_duration_ms) && (total_sample_duration_ms >= _target_chunk_duration_ms * 0.85)) 
 				)
 			{
-				double reserve_buffer_size;
-				
-				if (GetMediaTrack()->GetMediaType() == cmn::MediaType::Video)
-				{
-					// Reserve 10 Mbps.
-					reserve_buffer_size = (_target_chunk_duration_ms / 1000.0) * ((10.0 * 1000.0 * 1000.0) / 8.0);
-				}
-				else
-				{
-					// Reserve 0.5 Mbps.
-					reserve_buffer_size = (_target_chunk_duration_ms / 1000.0) * ((0.5 * 1000.0 * 1000.0) / 8.0);
-				}
-
-				ov::ByteStream chunk_stream(reserve_buffer_size);
-				
-				auto data_samples = GetDataSamples(samples->GetStartTimestamp(), samples->GetEndTimestamp());
-				if (data_samples != nullptr)
-				{
-					if (WriteEmsgBox(chunk_stream, data_samples) == false)
-					{
-						logtw("FMP4Packager::AppendSample() - Failed to write emsg box");
-					}
-				}
+				FMP4DataList chunk;
 
-				if (WriteMoofBox(chunk_stream, samples) == false)
+				if (_config.progressive_chunk == true)
 				{
-					logte("FMP4Packager::AppendSample() - Failed to write moof box");
-					return false;
+					// The fragments of the samples have already been written (and delivered) when the samples were appended
+					chunk = std::move(_progressive_chunk);
+					_progressive_chunk.clear();
 				}
-
-				if (WriteMdatBox(chunk_stream, samples) == false)
+				else if (WriteFragment(samples, chunk) == false)
 				{
-					logte("FMP4Packager::AppendSample() - Failed to write mdat box");
+					logte("FMP4Packager::AppendSample() - Failed to write fragment");
 					return false;
 				}
 
-				auto chunk = chunk_stream.GetDataPointer();
-
 				auto markers = PopMarkers(samples->GetStartTimestamp(), samples->GetEndTimestamp());
 
 				////////////////////////////////////////////////////
@@ -427,6 +403,13 @@ namespace bmff
 		}
 
 		samples = _sample_buffer.GetSamples();
+
+		if (_config.progressive_chunk == true && AppendProgressiveFragment(samples) == false)
+		{
+			logte("FMP4Packager::AppendSample() - Failed to append progressive fragment");
+			return false;
+		}
+
 		total_sample_duration = samples != nullptr ? samples->GetTotalDuration() : 0;
 		total_sample_duration_ms = (static_cast<double>(total_sample_duration) / GetMediaTrack()->GetTimeBase().GetTimescale()) * 1000.0;
 
@@ -457,31 +440,19 @@ namespace bmff
 
 		if (samples != nullptr && samples->GetTotalCount() > 0)
 		{
-			ov::ByteStream chunk_stream(4096);
-
-			auto data_samples = GetDataSamples(samples->GetStartTimestamp(), samples->GetEndTimestamp());
-			if (data_samples != nullptr)
-			{
-				if (WriteEmsgBox(chunk_stream, data_samples) == false)
-				{
-					logtw("FMP4Packager::Flush() - Failed to write emsg box");
-				}
-			}
+			FMP4DataList chunk;
 
-			if (WriteMoofBox(chunk_stream, samples) == false)
+			if (_config.progressive_chunk == true)
 			{
-				logte("FMP4Packager::Flush() - Failed to write moof box");
-				return false;
+				chunk = std::move(_progressive_chunk);
+				_progressive_chunk.clear();
 			}
-
-			if (WriteMdatBox(chunk_stream, samples) == false)
+			else if (WriteFragment(samples, chunk) == false)
 			{
-				logte("FMP4Packager::Flush() - Failed to write mdat box");
+				logte("FMP4Packager::Flush() - Failed to write fragment");
 				return false;
 			}
 
-			auto chunk = chunk_stream.GetDataPointer();
-
 			if (_storage != nullptr && _storage->AppendMediaChunk(chunk, 
 											samples->GetStartTimestamp(), 
 											samples->GetTotalDuration(), 
@@ -497,6 +468,68 @@ namespace bmff
 		return true;
 	}
 
+	bool FMP4Packager::WriteFragment(const std::shared_ptr<const Samples> &samples, FMP4DataList &fragment)
+	{
+		// Only the box headers are written to fragment_stream, the payloads of samples are referenced by the fragment
+		ov::ByteStream fragment_stream(4096);
+		FMP4DataList payload_list;
+
+		auto data_samples = GetDataSamples(samples->GetStartTimestamp(), samples->GetEndTimestamp());
+		if (data_samples != nullptr)
+		{
+			if (WriteEmsgBox(fragment_stream, data_samples) == false)
+			{
+				logtw("FMP4Packager::WriteFragment() - Failed to write emsg box");
+			}
+		}
+
+		if (WriteMoofBox(fragment_stream, samples) == false)
+		{
+			logte("FMP4Packager::WriteFragment() - Failed to write moof box");
+			return false;
+		}
+
+		if (WriteMdatBox(fragment_stream, samples, payload_list) == false)
+		{
+			logte("FMP4Packager::WriteFragment() - Failed to write mdat box");
+			return false;
+		}
+
+		fragment.reserve(fragment.size() + payload_list.size() + 1);
+		fragment.emplace_back(fragment_stream.GetDataPointer());
+		fragment.insert(fragment.end(), payload_list.begin(), payload_list.end());
+
+		return true;
+	}
+
+	bool FMP4Packager::AppendProgressiveFragment(const std::shared_ptr<const Samples> &samples)
+	{
+		if (samples == nullptr || samples->IsEmpty())
+		{
+			return false;
+		}
+
+		// The fragment is made with the sample just appended (the sample is encrypted by the sample buffer if CENC is enabled)
+		auto fragment_samples = std::make_shared<Samples>();
+		fragment_samples->AppendSample(samples->GetList().back());
+
+		FMP4DataList fragment;
+		if (WriteFragment(fragment_samples, fragment) == false)
+		{
+			return false;
+		}
+
+		_progressive_chunk.insert(_progressive_chunk.end(), fragment.begin(), fragment.end());
+
+		if (_storage != nullptr && _storage->AppendMediaChunkFragment(fragment) == false)
+		{
+			logte("FMP4Packager::AppendProgressiveFragment() - Failed to store media chunk fragment");
+			return false;
+		}
+
+		return true;
+	}
+
 	// Get config
 	const FMP4Packager::Config &FMP4Packager::GetConfig() const
 	{
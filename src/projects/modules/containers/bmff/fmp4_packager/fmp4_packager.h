@@ -24,6 +24,11 @@ namespace bmff
 		{
 			double chunk_duration_ms = 500.0;
 			double segment_duration_ms = 6000.0;
+
+			// A fragment (moof + mdat) is written for every sample and appended to the storage immediately,
+			// so that the chunk in progress can be delivered before it is completed.
+			// The chunk is made up of the fragments of its samples.
+			bool progressive_chunk = false;
 			
 			CencProperty cenc_property;
 		};
@@ -53,6 +58,12 @@ namespace bmff
 
 		std::shared_ptr<bmff::Samples> GetDataSamples(int64_t start_timestamp, int64_t end_timestamp);
 
+		// Writes emsg (if there are data samples) + moof + mdat of the samples
+		// Only the box headers are written, the payloads of the samples are referenced by the fragment
+		bool WriteFragment(const std::shared_ptr<const Samples> &samples, FMP4DataList &fragment);
+		// Writes the fragment of the last sample of the samples and appends it to the chunk in progress (progressive chunk)
+		bool AppendProgressiveFragment(const std::shared_ptr<const Samples> &samples);
+
 		bool StoreInitializationSection(const std::shared_ptr<ov::Data> &segment);
 
 		std::shared_ptr<const MediaPacket> ConvertBitstreamFormat(const std::shared_ptr<const MediaPacket> &media_packet);
@@ -64,6 +75,9 @@ namespace bmff
 
 		double _target_chunk_duration_ms = 0.0;
 
+		// Fragments of the chunk in progress (progressive chunk)
+		FMP4DataList _progressive_chunk;
+
 		std::queue<std::shared_ptr<const MediaPacket>> _reserved_data_packets;
 
 		std::map<int64_t, Marker> _markers;
@@ -39,6 +39,9 @@ namespace bmff
 	{
 		if (_config.dvr_enabled == true)
 		{
+			// The segments queued to the DVR writer refer to this storage
+			WaitForPendingDvrWrites();
+
 			// Delete all dvr directory and files
 			auto dvr_path = GetDVRDirectory();
 
@@ -57,27 +60,29 @@ namespace bmff
 
 	std::shared_ptr<FMP4Segment> FMP4Storage::GetMediaSegment(uint32_t segment_number) const
 	{
-		std::shared_lock<std::shared_mutex> lock(_segments_lock);
-		
-		if (_segments.empty())
 		{
-			return nullptr;
-		}
+			std::shared_lock<std::shared_mutex> lock(_segments_lock);
 
-		auto it = _segments.find(segment_number);
-		if (it != _segments.end())
-		{
-			return it->second;
-		}
-		
-		auto min_number = _segments.begin()->first;
-		if (segment_number < min_number)
-		{
-			// If the segment is not in the list, try to load it from the file
-			return LoadMediaSegmentFromFile(segment_number);
+			if (_segments.empty())
+			{
+				return nullptr;
+			}
+
+			auto it = _segments.find(segment_number);
+			if (it != _segments.end())
+			{
+				return it->second;
+			}
+
+			auto min_number = _segments.begin()->first;
+			if (segment_number >= min_number)
+			{
+				return nullptr;
+			}
 		}
 
-		return nullptr;
+		// If the segment is not in the list, try to load it from the file (without holding _segments_lock)
+		return LoadMediaSegmentFromFile(segment_number);
 	}
 
 	std::shared_ptr<FMP4Segment> FMP4Storage::GetLastSegment() const
@@ -123,6 +128,35 @@ namespace bmff
 		return chunk;
 	}
 
+	ov::String FMP4Storage::GetMediaSegmentFilePath(uint32_t segment_number) const
+	{
+		if (_config.dvr_enabled == false)
+		{
+			return "";
+		}
+
+		{
+			std::shared_lock<std::shared_mutex> lock(_segments_lock);
+
+			if (_segments.empty() || (segment_number >= _segments.begin()->first))
+			{
+				return "";
+			}
+		}
+
+		if (GetDvrCachedSegment(segment_number) != nullptr)
+		{
+			return "";
+		}
+
+		if (_dvr_info.GetSegmentInfo(segment_number).IsAvailable() == false)
+		{
+			return "";
+		}
+
+		return GetSegmentFilePath(segment_number);
+	}
+
 	uint64_t FMP4Storage::GetSegmentCount() const
 	{
 		std::shared_lock<std::shared_mutex> lock(_segments_lock);
@@ -193,6 +227,46 @@ namespace bmff
 			return false;
 		}
 
+		// Keep the segment in the cache until it is written, so it can be served while it is waiting for the writer
+		AddDvrCachedSegment(segment, false);
+
+		{
+			std::lock_guard<std::mutex> lock(_dvr_pending_writes_lock);
+			_dvr_pending_writes++;
+		}
+
+		FMP4DvrWriter::Job job;
+		job.key = GetDVRDirectory();
+		job.bytes = segment->GetDataLength();
+		job.task = [this, segment]() {
+			if (_dvr_stopping == false)
+			{
+				WriteMediaSegmentToFile(segment);
+			}
+
+			std::lock_guard<std::mutex> lock(_dvr_pending_writes_lock);
+			_dvr_pending_writes--;
+			_dvr_pending_writes_cv.notify_all();
+		};
+
+		if (FMP4DvrWriter::GetInstance()->Enqueue(std::move(job)) == false)
+		{
+			logte("Could not queue segment to DVR writer: %s/%u", GetDVRDirectory().CStr(), segment->GetNumber());
+
+			RemoveDvrCachedSegment(segment->GetNumber());
+
+			std::lock_guard<std::mutex> lock(_dvr_pending_writes_lock);
+			_dvr_pending_writes--;
+			_dvr_pending_writes_cv.notify_all();
+
+			return false;
+		}
+
+		return true;
+	}
+
+	bool FMP4Storage::WriteMediaSegmentToFile(const std::shared_ptr<FMP4Segment> &segment)
+	{
 		// Save to file
 		auto file_path = GetSegmentFilePath(segment->GetNumber());
 		auto dir = GetDVRDirectory();
@@ -204,19 +278,24 @@ namespace bmff
 			if (ov::CreateDirectories(dir) == false)
 			{
 				logte("Could not create directory for DVR: %s", dir.CStr());
+				RemoveDvrCachedSegment(segment->GetNumber());
 				return false;
 			}
 		}
 
 		// Save to file
-		if (ov::DumpToFile(file_path, segment->GetData()) == nullptr)
+		if (FMP4DvrWriter::WriteToFile(file_path, segment->GetDataList()) == false)
 		{
 			logte("Could not save segment to file: %s", file_path.CStr());
+			RemoveDvrCachedSegment(segment->GetNumber());
 			return false;
 		}
 
 		_dvr_info.AppendSegment(segment->GetNumber(), segment->GetDurationMs(), segment->GetDataLength());
 
+		// From now on, the segment can be evicted from the cache
+		AddDvrCachedSegment(segment, true);
+
 		// Delete old segments until the total duration is less than the maximum DVR duration
 		while (_dvr_info.GetTotalDurationMs() > (_config.dvr_duration_sec * 1000.0))
 		{
@@ -226,6 +305,8 @@ namespace bmff
 				break;
 			}
 
+			RemoveDvrCachedSegment(segment_to_delete.segment_number);
+
 			auto file_path = GetSegmentFilePath(segment_to_delete.segment_number);
 			if (std::remove(file_path) != 0)
 			{
@@ -248,6 +329,12 @@ namespace bmff
 			return nullptr;
 		}
 
+		auto cached_segment = GetDvrCachedSegment(segment_number);
+		if (cached_segment != nullptr)
+		{
+			return cached_segment;
+		}
+
 		auto info = _dvr_info.GetSegmentInfo(segment_number);
 		if (info.IsAvailable() == false)
 		{
@@ -271,13 +358,85 @@ namespace bmff
 			return nullptr;
 		}
 
+		AddDvrCachedSegment(segment, true);
+
 		return segment;
 	}
 
+	std::shared_ptr<FMP4Segment> FMP4Storage::GetDvrCachedSegment(uint32_t segment_number) const
+	{
+		std::lock_guard<std::mutex> lock(_dvr_cache_lock);
+
+		auto it = _dvr_cache.find(segment_number);
+		if (it == _dvr_cache.end())
+		{
+			return nullptr;
+		}
+
+		it->second.last_access = ++_dvr_cache_access_count;
+
+		return it->second.segment;
+	}
+
+	void FMP4Storage::AddDvrCachedSegment(const std::shared_ptr<FMP4Segment> &segment, bool persisted) const
+	{
+		std::lock_guard<std::mutex> lock(_dvr_cache_lock);
+
+		auto &item = _dvr_cache[segment->GetNumber()];
+		item.segment = segment;
+		item.persisted = persisted;
+		item.last_access = ++_dvr_cache_access_count;
+
+		// Evict the least recently used segments among the persisted segments
+		while (true)
+		{
+			size_t persisted_count = 0;
+			auto lru_it = _dvr_cache.end();
+
+			for (auto it = _dvr_cache.begin(); it != _dvr_cache.end(); ++it)
+			{
+				if (it->second.persisted == false)
+				{
+					continue;
+				}
+
+				persisted_count++;
+
+				if ((lru_it == _dvr_cache.end()) || (it->second.last_access < lru_it->second.last_access))
+				{
+					lru_it = it;
+				}
+			}
+
+			if (persisted_count <= DvrCacheSize)
+			{
+				break;
+			}
+
+			_dvr_cache.erase(lru_it);
+		}
+	}
+
+	void FMP4Storage::RemoveDvrCachedSegment(uint32_t segment_number)
+	{
+		std::lock_guard<std::mutex> lock(_dvr_cache_lock);
+		_dvr_cache.erase(segment_number);
+	}
+
+	void FMP4Storage::WaitForPendingDvrWrites()
+	{
+		// The remaining segments are discarded since the DVR directory will be deleted
+		_dvr_stopping = true;
+
+		std::unique_lock<std::mutex> lock(_dvr_pending_writes_lock);
+		_dvr_pending_writes_cv.wait(lock, [this]() { return _dvr_pending_writes == 0; });
+	}
+
 	std::shared_ptr<FMP4Segment> FMP4Storage::CreateNextSegment()
 	{
 		// Create next segment
 		auto segment = std::make_shared<FMP4Segment>(GetLastSegmentNumber() + 1, _config.segment_duration_ms);
+		std::shared_ptr<FMP4Segment> segment_to_save;
 		{
 			std::lock_guard<std::shared_mutex> lock(_segments_lock);
 			_segments.emplace(segment->GetNumber(), segment);
@@ -296,10 +455,10 @@ namespace bmff
 					_segments.erase(_segments.begin());
 				}
 
-				// DVR
+				// DVR (the segment is saved after releasing the lock)
 				if (_config.dvr_enabled)
 				{
-					SaveMediaSegmentToFile(old_segment);
+					segment_to_save = old_segment;
 				}
 				else
 				{
@@ -311,6 +470,11 @@ namespace bmff
 			}
 		}
 
+		if (segment_to_save != nullptr)
+		{
+			SaveMediaSegmentToFile(segment_to_save);
+		}
+
 		if (_observer != nullptr)
 		{
 			_observer->OnMediaSegmentCreated(_track->GetId(), segment->GetNumber());
@@ -319,7 +483,46 @@ namespace bmff
 		return segment;
 	}
 
-	bool FMP4Storage::AppendMediaChunk(const std::shared_ptr<ov::Data> &chunk, int64_t start_timestamp, double duration_ms, bool independent, bool last_chunk, const std::vector<std::shared_ptr<Marker>> &markers)
+	bool FMP4Storage::AppendMediaChunkFragment(const FMP4DataList &fragment)
+	{
+		auto segment = GetLastSegment();
+		if (segment == nullptr || segment->IsCompleted() == true)
+		{
+			segment = CreateNextSegment();
+		}
+
+		if (segment->AppendProgressiveChunkData(fragment) == false)
+		{
+			return false;
+		}
+
+		if (_observer != nullptr)
+		{
+			_observer->OnMediaChunkFragmentAppended(_track->GetId(), segment->GetNumber(), segment->GetChunkCount());
+		}
+
+		return true;
+	}
+
+	std::tuple<bool, bool, FMP4DataList> FMP4Storage::GetMediaChunkDataList(uint32_t segment_number, uint32_t chunk_number, size_t offset) const
+	{
+		std::shared_ptr<FMP4Segment> segment;
+
+		{
+			std::shared_lock<std::shared_mutex> lock(_segments_lock);
+			auto it = _segments.find(segment_number);
+			if (it == _segments.end())
+			{
+				return {false, false, {}};
+			}
+
+			segment = it->second;
+		}
+
+		return segment->GetChunkDataList(chunk_number, offset);
+	}
+
+	bool FMP4Storage::AppendMediaChunk(const FMP4DataList &chunk, int64_t start_timestamp, double duration_ms, bool independent, bool last_chunk, const std::vector<std::shared_ptr<Marker>> &markers)
 	{
 		auto segment = GetLastSegment();
 		if (segment == nullptr || segment->IsCompleted() == true)
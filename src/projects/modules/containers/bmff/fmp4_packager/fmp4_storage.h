@@ -9,6 +9,7 @@
 #pragma once
 
 #include "fmp4_structure.h"
+#include "fmp4_dvr_writer.h"
 #include <modules/marker/marker_box.h>
 
 namespace bmff
@@ -19,6 +20,8 @@ namespace bmff
 		virtual void OnFMp4StorageInitialized(const int32_t &track_id) = 0;
 		virtual void OnMediaSegmentCreated(const int32_t &track_id, const uint32_t &segment_number) = 0;
 		virtual void OnMediaChunkUpdated(const int32_t &track_id, const uint32_t &segment_number, const uint32_t &chunk_number, bool last_chunk) = 0;
+		// A fragment of the chunk in progress is appended (progressive chunk)
+		virtual void OnMediaChunkFragmentAppended(const int32_t &track_id, const uint32_t &segment_number, const uint32_t &chunk_number) = 0;
 		virtual void OnMediaSegmentDeleted(const int32_t &track_id, const uint32_t &segment_number) = 0;
 	};
 
@@ -43,6 +46,9 @@ namespace bmff
 		std::shared_ptr<FMP4Segment> GetMediaSegment(uint32_t segment_number) const;
 		std::shared_ptr<FMP4Segment> GetLastSegment() const;
 		std::shared_ptr<FMP4Chunk> GetMediaChunk(uint32_t segment_number, uint32_t chunk_number) const;
+		// Returns the path of the DVR segment file if the segment is only on the disk (empty if it is in the memory),
+		// so that it can be sent from the file without loading it
+		ov::String GetMediaSegmentFilePath(uint32_t segment_number) const;
 
 		uint64_t GetSegmentCount() const;
 
@@ -50,7 +56,11 @@ namespace bmff
 		int64_t GetLastSegmentNumber() const;
 
 		bool StoreInitializationSection(const std::shared_ptr<ov::Data> &section);
-		bool AppendMediaChunk(const std::shared_ptr<ov::Data> &chunk, int64_t start_timestamp, double duration_ms, bool independent, bool last_chunk, const std::vector<std::shared_ptr<Marker>> &markers = {});
+		bool AppendMediaChunk(const FMP4DataList &chunk, int64_t start_timestamp, double duration_ms, bool independent, bool last_chunk, const std::vector<std::shared_ptr<Marker>> &markers = {});
+		// Appends a fragment of the chunk in progress, the chunk is completed by AppendMediaChunk() with all of its fragments
+		bool AppendMediaChunkFragment(const FMP4DataList &fragment);
+		// <found, completed, data list> of the chunk from the offset (in bytes), the chunk may be in progress
+		std::tuple<bool, bool, FMP4DataList> GetMediaChunkDataList(uint32_t segment_number, uint32_t chunk_number, size_t offset) const;
 
 		uint64_t GetMaxChunkDurationMs() const;
 		uint64_t GetMinChunkDurationMs() const;
@@ -141,7 +151,7 @@ namespace bmff
 				}
 
 				// Check if the segment number is valid
-				if (_first_segment_number > segment_number)
+				if ((_first_segment_number > segment_number) || ((segment_number - _first_segment_number) >= _segments.size()))
 				{
 					return {0, 0, 0};
 				}
@@ -159,11 +169,41 @@ namespace bmff
 
 		DvrInfo _dvr_info;
 
+		// Segments which are being written or recently loaded
+		struct DvrCacheItem
+		{
+			std::shared_ptr<FMP4Segment> segment;
+			// false while the segment is waiting for the DVR writer (it must not be evicted)
+			bool persisted = false;
+			uint64_t last_access = 0;
+		};
+
+		// The number of persisted segments kept in the DVR cache
+		static constexpr size_t DvrCacheSize = 8;
+
+		mutable std::map<uint32_t, DvrCacheItem> _dvr_cache;
+		mutable std::mutex _dvr_cache_lock;
+		mutable uint64_t _dvr_cache_access_count = 0;
+
+		// The number of segments queued to the DVR writer but not written yet
+		size_t _dvr_pending_writes = 0;
+		std::mutex _dvr_pending_writes_lock;
+		std::condition_variable _dvr_pending_writes_cv;
+		std::atomic<bool> _dvr_stopping{false};
+
 		ov::String GetDVRDirectory() const;
 		ov::String GetSegmentFilePath(uint32_t segment_number) const;
+		// Queues the segment to the DVR writer, it is kept in the DVR cache until it is written
 		bool SaveMediaSegmentToFile(const std::shared_ptr<FMP4Segment> &segment);
+		// Called by the DVR writer thread
+		bool WriteMediaSegmentToFile(const std::shared_ptr<FMP4Segment> &segment);
 		std::shared_ptr<FMP4Segment> LoadMediaSegmentFromFile(uint32_t segment_number) const;
 
+		std::shared_ptr<FMP4Segment> GetDvrCachedSegment(uint32_t segment_number) const;
+		void AddDvrCachedSegment(const std::shared_ptr<FMP4Segment> &segment, bool persisted) const;
+		void RemoveDvrCachedSegment(uint32_t segment_number);
+		void WaitForPendingDvrWrites();
+
 		std::shared_ptr<FMP4Segment> CreateNextSegment();
 
 		Config	_config;
@@ -8,21 +8,50 @@
 //==============================================================================
 #pragma once
 
+#include <base/ovcrypto/message_digest.h>
 #include <base/ovlibrary/ovlibrary.h>
 #include <modules/marker/marker_box.h>
 
 namespace bmff
 {
+	// Fragmented MP4 data which is made up of several buffers (scatter/gather list)
+	//
+	// The samples of a chunk are not copied into a contiguous buffer. The list holds the box headers (emsg/moof/mdat header)
+	// followed by the references to the payloads of the original MediaPackets.
+	using FMP4DataList = std::vector<std::shared_ptr<const ov::Data>>;
+
+	static inline std::shared_ptr<const ov::Data> ComputeMd5(const FMP4DataList &data_list)
+	{
+		ov::MessageDigest md5;
+
+		if (md5.Create(ov::CryptoAlgorithm::Md5) == false)
+		{
+			return nullptr;
+		}
+
+		for (const auto &data : data_list)
+		{
+			md5.Update(data);
+		}
+
+		return md5.Finish();
+	}
+
 	class FMP4Chunk
 	{
 	public:
-		FMP4Chunk(const std::shared_ptr<ov::Data> &data, uint64_t number, int64_t start_timestamp, double duration_ms, bool independent)
+		FMP4Chunk(const FMP4DataList &data_list, uint64_t number, int64_t start_timestamp, double duration_ms, bool independent)
 		{
-			_data = data;
+			_data_list = data_list;
 			_number = number;
 			_duration_ms = duration_ms;
 			_start_timestamp = start_timestamp;
 			_independent = independent;
+
+			for (const auto &data : _data_list)
+			{
+				_size += data->GetLength();
+			}
 		}
 
 		int64_t GetNumber() const
@@ -43,7 +72,7 @@ namespace bmff
 		// Get Size
 		uint64_t GetSize() const
 		{
-			return _data->GetLength();
+			return _size;
 		}
 
 		bool IsIndependent() const
@@ -51,9 +80,32 @@ namespace bmff
 			return _independent;
 		}
 
-		const std::shared_ptr<ov::Data> &GetData() const
+		const FMP4DataList &GetDataList() const
+		{
+			return _data_list;
+		}
+
+		// Copies the data list into a contiguous buffer
+		std::shared_ptr<ov::Data> GetData() const
+		{
+			auto data = std::make_shared<ov::Data>(_size);
+
+			for (const auto &item : _data_list)
+			{
+				data->Append(item);
+			}
+
+			return data;
+		}
+
+		// The digest is computed once when it is requested first (for ETag)
+		std::shared_ptr<const ov::Data> GetMd5() const
 		{
-			return _data;
+			std::call_once(_md5_once, [this]() {
+				_md5 = ComputeMd5(_data_list);
+			});
+
+			return _md5;
 		}
 
 	private:
@@ -61,7 +113,11 @@ namespace bmff
 		int64_t _start_timestamp = 0;
 		double _duration_ms = 0;
 		bool _independent = false;
-		std::shared_ptr<ov::Data> _data;
+		FMP4DataList _data_list;
+		uint64_t _size = 0;
+
+		mutable std::once_flag _md5_once;
+		mutable std::shared_ptr<const ov::Data> _md5;
 	};
 
 	class FMP4Segment
@@ -70,16 +126,15 @@ namespace bmff
 		FMP4Segment(uint64_t number, uint64_t target_duration)
 		{
 			_number = number;
-
-			// For performance, reserve memory for 4Mbps * target_duration (sec)
-			_data = std::make_shared<ov::Data>(((1000.0 * 1000.0 * 4.0)/8.0) * (static_cast<double>(target_duration) / 1000.0));
 		}
 
+		// Segment loaded from a file (DVR)
 		FMP4Segment(uint64_t number, double duration_ms, const std::shared_ptr<ov::Data> &data)
 		{
 			_number = number;
 			_duration_ms = duration_ms;
 			_data = data;
+			_data_length = data->GetLength();
 
 			SetCompleted();
 		}
@@ -94,7 +149,7 @@ namespace bmff
 			return _is_completed;
 		}
 
-		bool AppendChunkData(const std::shared_ptr<ov::Data> &chunk_data, int64_t start_timestamp, double duration_ms, bool independent)
+		bool AppendChunkData(const FMP4DataList &chunk_data, int64_t start_timestamp, double duration_ms, bool independent)
 		{
 			if (_is_completed)
 			{
@@ -109,27 +164,135 @@ namespace bmff
 				_start_timestamp = start_timestamp;
 			}
 
-			_chunks.emplace_back(std::make_shared<FMP4Chunk>(chunk_data, chunk_number, start_timestamp, duration_ms, independent));
+			auto chunk = std::make_shared<FMP4Chunk>(chunk_data, chunk_number, start_timestamp, duration_ms, independent);
+			_chunks.emplace_back(chunk);
 			_last_chunk_number = chunk_number;
+			_data_length += chunk->GetSize();
+
+			// The chunk in progress is completed
+			_progressive_chunk_data.clear();
 
 			lock.unlock();
-			
-			// Append data
+
 			_duration_ms += duration_ms;
-			_data->Append(chunk_data);
 
 			return true;
 		}
 
-		// Get Data
+		// Appends a fragment of the chunk in progress (the chunk which will be appended next by AppendChunkData)
+		bool AppendProgressiveChunkData(const FMP4DataList &fragment)
+		{
+			if (_is_completed)
+			{
+				return false;
+			}
+
+			std::unique_lock<std::shared_mutex> lock(_chunks_lock);
+			_progressive_chunk_data.insert(_progressive_chunk_data.end(), fragment.begin(), fragment.end());
+
+			return true;
+		}
+
+		// Returns the data of the chunk from the offset (in bytes), whether the chunk is completed or still in progress
+		// <found, completed, data list>
+		std::tuple<bool, bool, FMP4DataList> GetChunkDataList(uint64_t chunk_number, size_t offset) const
+		{
+			std::shared_lock<std::shared_mutex> lock(_chunks_lock);
+
+			const FMP4DataList *source = nullptr;
+			bool completed = false;
+
+			if (chunk_number < _chunks.size())
+			{
+				source = &_chunks[chunk_number]->GetDataList();
+				completed = true;
+			}
+			else if (chunk_number == _chunks.size() && _is_completed == false)
+			{
+				source = &_progressive_chunk_data;
+			}
+			else
+			{
+				return {false, false, {}};
+			}
+
+			FMP4DataList data_list;
+
+			for (const auto &data : *source)
+			{
+				if (offset >= data->GetLength())
+				{
+					offset -= data->GetLength();
+					continue;
+				}
+
+				data_list.emplace_back((offset > 0) ? data->Subdata(offset) : data);
+				offset = 0;
+			}
+
+			return {true, completed, data_list};
+		}
+
+		// The segment is a view over its chunks, so the data of the chunks are not copied into the segment
+		FMP4DataList GetDataList() const
+		{
+			if (_data != nullptr)
+			{
+				return {_data};
+			}
+
+			FMP4DataList data_list;
+
+			std::shared_lock<std::shared_mutex> lock(_chunks_lock);
+
+			for (const auto &chunk : _chunks)
+			{
+				const auto &chunk_data_list = chunk->GetDataList();
+				data_list.insert(data_list.end(), chunk_data_list.begin(), chunk_data_list.end());
+			}
+
+			return data_list;
+		}
+
+		// Copies the data of the chunks into a contiguous buffer
 		std::shared_ptr<ov::Data> GetData() const
 		{
-			return _data;
+			if (_data != nullptr)
+			{
+				return _data;
+			}
+
+			auto data = std::make_shared<ov::Data>(_data_length);
+
+			for (const auto &item : GetDataList())
+			{
+				data->Append(item);
+			}
+
+			return data;
 		}
 
 		size_t GetDataLength() const
 		{
-			return _data == nullptr ? 0 : _data->GetLength();
+			return _data_length;
+		}
+
+		// The digest of the completed segment is computed once when it is requested first (for ETag)
+		std::shared_ptr<const ov::Data> GetMd5() const
+		{
+			if (_is_completed == false)
+			{
+				return ComputeMd5(GetDataList());
+			}
+
+			std::lock_guard<std::mutex> lock(_md5_lock);
+
+			if (_md5 == nullptr)
+			{
+				_md5 = ComputeMd5(GetDataList());
+			}
+
+			return _md5;
 		}
 
 		// Get Number
@@ -159,7 +322,7 @@ namespace bmff
 
 		size_t GetSize() const
 		{
-			return _data->GetLength();
+			return _data_length;
 		}
 
 		// Get Last Chunk Number
@@ -214,9 +377,18 @@ namespace bmff
 
 		int64_t _last_chunk_number = -1;
 
-		// Segment Data
+		// Fragments of the chunk in progress (See FMP4Packager::Config::progressive_chunk)
+		FMP4DataList _progressive_chunk_data;
+
+		// Total length of the chunks
+		std::atomic<size_t> _data_length{0};
+
+		// Segment Data (only for the segment loaded from a file)
 		std::shared_ptr<ov::Data> _data;
 
+		mutable std::mutex _md5_lock;
+		mutable std::shared_ptr<const ov::Data> _md5;
+
 		std::vector<std::shared_ptr<Marker>> _markers;
 	};
 }
\ No newline at end of file
@@ -18,13 +18,20 @@ namespace http
 	{
 		namespace h2
 		{
-            // Not yet implemented
+			// https://www.rfc-editor.org/rfc/rfc7540#section-6.6
 			class Http2PushPromiseFrame : public Http2Frame
 			{
 			public:
+				enum class Flags : uint8_t
+				{
+					None = 0x00,
+					EndHeaders = 0x04,
+					Padded = 0x08,
+				};
+
 				// Make by itself
-				Http2PushPromiseFrame()
-					: Http2Frame(0)
+				Http2PushPromiseFrame(uint32_t stream_id)
+					: Http2Frame(stream_id)
 				{
 					SetType(Http2Frame::Type::PushPromise);
 				}
@@ -34,17 +41,50 @@ namespace http
 				{
 				}
 
+				// Setters
+				void SetEndHeaders()
+				{
+					TURN_ON_HTTP2_FRAME_FLAG(Flags::EndHeaders);
+				}
+
+				void SetPromisedStreamId(uint32_t promised_stream_id)
+				{
+					_promised_stream_id = promised_stream_id & 0x7FFFFFFF;
+				}
+
+				uint32_t GetPromisedStreamId() const
+				{
+					return _promised_stream_id;
+				}
+
+				// Set Header Block Fragment
+				void SetHeaderBlockFragment(const std::shared_ptr<const ov::Data> &data)
+				{
+					_header_block_fragment = data;
+				}
+
+				// Get Header Block Fragment
+				const std::shared_ptr<const ov::Data> &GetHeaderBlockFragment() const
+				{
+					return _header_block_fragment;
+				}
+
 				// To String
 				ov::String ToString() const override
 				{
 					ov::String str;
-					
+
 					str = Http2Frame::ToString();
 
 					str += "\n";
 					str += "[PUSH_PROMISE Frame]\n";
 
-					str += ov::String::FormatString("Not yet implemented\n");
+					str += ov::String::FormatString("Promised Stream ID : %u\n", _promised_stream_id);
+					str += ov::String::FormatString("Header Block Fragment Length : %zu\n", (_header_block_fragment != nullptr) ? _header_block_fragment->GetLength() : 0);
+
+					str += ov::String::FormatString("Flags : EndHeader(%s) Padded(%s)\n",
+					ov::Converter::ToString(CHECK_HTTP2_FRAME_FLAG(Flags::EndHeaders)).CStr(),
+					ov::Converter::ToString(CHECK_HTTP2_FRAME_FLAG(Flags::Padded)).CStr());
 
 					return str;
 				}
@@ -57,7 +97,19 @@ namespace http
 						return Http2Frame::GetPayload();
 					}
 
-					return nullptr;
+					auto payload = std::make_shared<ov::Data>();
+					ov::ByteStream stream(payload.get());
+
+					// Reserved bit is always unset
+					stream.WriteBE32(_promised_stream_id & 0x7FFFFFFF);
+
+					// Append Header Block Fragment
+					if (_header_block_fragment != nullptr)
+					{
+						payload->Append(_header_block_fragment);
+					}
+
+					return payload;
 				}
 
 			private:
@@ -68,11 +120,46 @@ namespace http
 						return false;
 					}
 
-					SetParsingState(ParsingState::Error);
+					auto payload = GetPayload();
+					if (payload == nullptr)
+					{
+						return false;
+					}
+
+					auto payload_data = payload->GetDataAs<uint8_t>();
+					size_t payload_offset = 0;
+					size_t header_block_size = payload->GetLength();
+					uint8_t pad_length = 0;
+
+					if (CHECK_HTTP2_FRAME_FLAG(Flags::Padded))
+					{
+						if (header_block_size < 1)
+						{
+							return false;
+						}
+
+						pad_length = payload_data[payload_offset];
+						payload_offset++;
+						header_block_size--;
+					}
+
+					if (header_block_size < static_cast<size_t>(4 + pad_length))
+					{
+						return false;
+					}
+
+					_promised_stream_id = ByteReader<uint32_t>::ReadBigEndian(payload_data + payload_offset) & 0x7FFFFFFF;
+					payload_offset += 4;
+					header_block_size -= 4 + pad_length;
+
+					_header_block_fragment = payload->Subdata(payload_offset, header_block_size);
 
 					return true;
 				}
+
+				uint32_t _promised_stream_id = 0;
+				std::shared_ptr<const ov::Data> _header_block_fragment = nullptr;
 			};
 		}
 	}
-}
\ No newline at end of file
+}
@@ -149,16 +149,7 @@ namespace http
 				auto payload_length = payload == nullptr ? 0 : payload->GetLength();
 
 				// Frame Header
-				auto header_data = data->GetWritableDataAs<uint8_t>();
-				header_data[0] = (payload_length >> 16) & 0xFF;
-				header_data[1] = (payload_length >> 8) & 0xFF;
-				header_data[2] = payload_length & 0xFF;
-				header_data[3] = static_cast<uint8_t>(_type);
-				header_data[4] = _flags;
-				header_data[5] = (_stream_id >> 24) & 0xFF;
-				header_data[6] = (_stream_id >> 16) & 0xFF;
-				header_data[7] = (_stream_id >> 8) & 0xFF;
-				header_data[8] = _stream_id & 0xFF;
+				WriteHeader(data->GetWritableDataAs<uint8_t>(), payload_length, _type, _flags, _stream_id);
 
 				// Frame Payload
 				// It sometimes comes from child class
@@ -170,6 +161,19 @@ namespace http
 				return data;
 			}
 
+			void Http2Frame::WriteHeader(uint8_t *buffer, uint32_t payload_length, Type type, uint8_t flags, uint32_t stream_id)
+			{
+				buffer[0] = (payload_length >> 16) & 0xFF;
+				buffer[1] = (payload_length >> 8) & 0xFF;
+				buffer[2] = payload_length & 0xFF;
+				buffer[3] = static_cast<uint8_t>(type);
+				buffer[4] = flags;
+				buffer[5] = (stream_id >> 24) & 0xFF;
+				buffer[6] = (stream_id >> 16) & 0xFF;
+				buffer[7] = (stream_id >> 8) & 0xFF;
+				buffer[8] = stream_id & 0xFF;
+			}
+
 			void Http2Frame::SetParsingState(ParsingState state) noexcept
 			{
 				_state = state;
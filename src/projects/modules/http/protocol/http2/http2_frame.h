@@ -94,6 +94,10 @@ namespace http
 				// To data
 				std::shared_ptr<ov::Data> ToData() const;
 
+				// Writes the frame header (HTTP2_FRAME_HEADER_SIZE bytes) to the buffer,
+				// so that the header and the payload can be sent separately without copying the payload
+				static void WriteHeader(uint8_t *buffer, uint32_t payload_length, Type type, uint8_t flags, uint32_t stream_id);
+
 			protected:
 				// Copy construcor only can be called in derived class
 				Http2Frame(const std::shared_ptr<const Http2Frame> &frame);
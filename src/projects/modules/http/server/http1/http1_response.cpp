@@ -55,6 +55,23 @@ namespace http
 				return _chunked_transfer;
 			}
 
+			bool Http1Response::SetStreamingMode()
+			{
+				SetChunkedTransfer();
+				return true;
+			}
+
+			bool Http1Response::SendEndOfStream()
+			{
+				// The last chunk
+				return SendChunkedData(nullptr);
+			}
+
+			bool Http1Response::SendFilePiece(const std::shared_ptr<const ov::Data> &data)
+			{
+				return _chunked_transfer ? SendChunkedData(data) : HttpResponse::SendFilePiece(data);
+			}
+
 			int32_t Http1Response::SendHeader()
 			{
 				std::shared_ptr<ov::Data> response = std::make_shared<ov::Data>(65535);
@@ -113,6 +130,12 @@ namespace http
 				{
 					if (_chunked_transfer)
 					{
+						if (data->IsEmpty())
+						{
+							// An empty chunk means the end of the payload
+							continue;
+						}
+
 						sent &= SendChunkedData(data);
 						if (sent == true)
 						{
@@ -139,6 +162,27 @@ namespace http
 					}
 				}
 
+				auto file = GetResponseFile();
+				if (file != nullptr)
+				{
+					if (_chunked_transfer)
+					{
+						// Each piece of the file is sent as a chunk (SendFilePiece())
+						if (SendFileInPieces(file, 0, file->GetSize()) == false)
+						{
+							logte("Could not send chunked file : %s", file->GetPath().CStr());
+							return -1;
+						}
+					}
+					else if (SendFile(file, 0, file->GetSize()) == false)
+					{
+						logte("Could not send file : %s (%zu bytes)", file->GetPath().CStr(), file->GetSize());
+						return -1;
+					}
+
+					sent_bytes += file->GetSize();
+				}
+
 				ResetResponseData();
 
 				logtd("All datas are sent...");
@@ -33,6 +33,11 @@ namespace http
 				int32_t SendHeader() override;
 				int32_t SendPayload() override;
 
+				bool SetStreamingMode() override;
+				bool SendEndOfStream() override;
+
+				bool SendFilePiece(const std::shared_ptr<const ov::Data> &data) override;
+
 				bool _chunked_transfer = false;
 			};
 		}
@@ -0,0 +1,514 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "http2_frame_writer.h"
+
+#include "../http_server_private.h"
+
+namespace http
+{
+	namespace svr
+	{
+		namespace h2
+		{
+			Http2FrameWriter::Http2FrameWriter(const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<ov::TlsServerData> &tls_data)
+				: _client_socket(client_socket),
+				  _tls_data(tls_data)
+			{
+			}
+
+			bool Http2FrameWriter::SendFrames(const std::vector<std::shared_ptr<const prot::h2::Http2Frame>> &frames)
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				if (_closed)
+				{
+					return false;
+				}
+
+				for (const auto &frame : frames)
+				{
+					if (frame->GetType() == prot::h2::Http2Frame::Type::Data)
+					{
+						// DATA frames are subject to flow control
+						auto data_frame = std::dynamic_pointer_cast<const prot::h2::Http2DataFrame>(frame);
+
+						if (data_frame != nullptr)
+						{
+							auto it = _stream_map.find(frame->GetStreamId());
+							if (it == _stream_map.end())
+							{
+								logtd("Could not send DATA frame: stream %u is closed", frame->GetStreamId());
+								return false;
+							}
+
+							PendingData pending_data;
+							pending_data.data = data_frame->GetData();
+							pending_data.remaining = (pending_data.data != nullptr) ? pending_data.data->GetLength() : 0;
+							pending_data.end_stream = data_frame->IS_HTTP2_FRAME_FLAG_ON(prot::h2::Http2DataFrame::Flags::EndStream);
+
+							it->second.pending_list.push_back(std::move(pending_data));
+							continue;
+						}
+					}
+
+					AppendToBatch(frame->GetType(), frame->GetFlags(), frame->GetStreamId(), frame->GetPayload());
+				}
+
+				return FlushInternal();
+			}
+
+			bool Http2FrameWriter::SendFrame(const std::shared_ptr<const prot::h2::Http2Frame> &frame)
+			{
+				return SendFrames({frame});
+			}
+
+			bool Http2FrameWriter::SendData(uint32_t stream_id, const std::shared_ptr<const ov::Data> &data, bool end_stream)
+			{
+				PendingData pending_data;
+
+				pending_data.data = data;
+				pending_data.remaining = (data != nullptr) ? data->GetLength() : 0;
+				pending_data.end_stream = end_stream;
+
+				return QueueData(stream_id, std::move(pending_data));
+			}
+
+			bool Http2FrameWriter::SendFile(uint32_t stream_id, const std::shared_ptr<const ov::ReadOnlyFile> &file, bool end_stream)
+			{
+				if (file == nullptr)
+				{
+					OV_ASSERT2(file != nullptr);
+					return false;
+				}
+
+				PendingData pending_data;
+
+				pending_data.file = file;
+				pending_data.remaining = file->GetSize();
+				pending_data.end_stream = end_stream;
+
+				return QueueData(stream_id, std::move(pending_data));
+			}
+
+			bool Http2FrameWriter::QueueData(uint32_t stream_id, PendingData pending_data)
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				if (_closed)
+				{
+					return false;
+				}
+
+				auto it = _stream_map.find(stream_id);
+				if (it == _stream_map.end())
+				{
+					logtd("Could not send data: stream %u is closed", stream_id);
+					return false;
+				}
+
+				if ((pending_data.remaining == 0) && (pending_data.end_stream == false))
+				{
+					// Nothing to send
+					return true;
+				}
+
+				it->second.pending_list.push_back(std::move(pending_data));
+
+				return FlushInternal();
+			}
+
+			void Http2FrameWriter::OpenStream(uint32_t stream_id)
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				if (_stream_map.find(stream_id) == _stream_map.end())
+				{
+					StreamContext context;
+					context.window_size = _initial_window_size;
+
+					_stream_map.emplace(stream_id, std::move(context));
+				}
+			}
+
+			void Http2FrameWriter::ReleaseStream(uint32_t stream_id)
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				auto it = _stream_map.find(stream_id);
+				if (it == _stream_map.end())
+				{
+					return;
+				}
+
+				if (it->second.pending_list.empty())
+				{
+					_stream_map.erase(it);
+				}
+				else
+				{
+					it->second.released = true;
+				}
+			}
+
+			void Http2FrameWriter::ResetStream(uint32_t stream_id)
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				_stream_map.erase(stream_id);
+			}
+
+			bool Http2FrameWriter::OnWindowUpdate(uint32_t stream_id, uint32_t increment)
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				if (_closed)
+				{
+					return false;
+				}
+
+				if (increment == 0)
+				{
+					// https://www.rfc-editor.org/rfc/rfc7540#section-6.9
+					// A receiver MUST treat the receipt of a WINDOW_UPDATE frame with an flow-control window increment of 0 as a PROTOCOL_ERROR
+					logtw("Invalid WINDOW_UPDATE frame: increment is 0 (stream: %u, %s)", stream_id, _client_socket->ToString().CStr());
+					return false;
+				}
+
+				int64_t *window_size = nullptr;
+
+				if (stream_id == 0)
+				{
+					window_size = &_connection_window_size;
+				}
+				else
+				{
+					auto it = _stream_map.find(stream_id);
+					if (it == _stream_map.end())
+					{
+						// WINDOW_UPDATE can be received for a closed stream
+						return true;
+					}
+
+					window_size = &(it->second.window_size);
+				}
+
+				*window_size += increment;
+
+				if (*window_size > MAX_WINDOW_SIZE)
+				{
+					// FLOW_CONTROL_ERROR
+					logtw("Flow control window exceeds the maximum size: %" PRId64 " (stream: %u, %s)", *window_size, stream_id, _client_socket->ToString().CStr());
+					return false;
+				}
+
+				return FlushInternal();
+			}
+
+			bool Http2FrameWriter::OnInitialWindowSizeChanged(uint32_t initial_window_size)
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				if (_closed)
+				{
+					return false;
+				}
+
+				if (initial_window_size > MAX_WINDOW_SIZE)
+				{
+					logtw("Invalid SETTINGS_INITIAL_WINDOW_SIZE: %u (%s)", initial_window_size, _client_socket->ToString().CStr());
+					return false;
+				}
+
+				// https://www.rfc-editor.org/rfc/rfc7540#section-6.9.2
+				// The change is applied to all open streams, and the window of a stream can become negative
+				auto delta = static_cast<int64_t>(initial_window_size) - _initial_window_size;
+				_initial_window_size = initial_window_size;
+
+				for (auto &[stream_id, context] : _stream_map)
+				{
+					context.window_size += delta;
+				}
+
+				return FlushInternal();
+			}
+
+			void Http2FrameWriter::Close()
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				_closed = true;
+
+				_stream_map.clear();
+				_batch.clear();
+				_batch_bytes = 0;
+			}
+
+			void Http2FrameWriter::AppendToBatch(prot::h2::Http2Frame::Type type, uint8_t flags, uint32_t stream_id, const std::shared_ptr<const ov::Data> &payload)
+			{
+				_batch.push_back({type, flags, stream_id, payload});
+				_batch_bytes += HTTP2_FRAME_HEADER_SIZE + ((payload != nullptr) ? payload->GetLength() : 0);
+			}
+
+			bool Http2FrameWriter::FlushInternal()
+			{
+				while (true)
+				{
+					bool sent = true;
+					bool file_read_deferred = false;
+
+					// Each stream sends one DATA frame in turn, so a large response does not delay the other streams
+					while (sent)
+					{
+						sent = false;
+
+						for (auto it = _stream_map.begin(); it != _stream_map.end();)
+						{
+							auto stream_id = it->first;
+							auto &context = it->second;
+
+							if (context.pending_list.empty())
+							{
+								++it;
+								continue;
+							}
+
+							auto &pending_data = context.pending_list.front();
+							auto length = std::min(pending_data.remaining, MAX_DATA_FRAME_PAYLOAD_SIZE);
+
+							if (length > 0)
+							{
+								auto window_size = std::min(_connection_window_size, context.window_size);
+
+								if (window_size <= 0)
+								{
+									// Wait for WINDOW_UPDATE
+									++it;
+									continue;
+								}
+
+								length = std::min(length, static_cast<size_t>(window_size));
+							}
+
+							if ((length > 0) && (pending_data.file != nullptr) &&
+								((_client_socket->GetPendingSendBytes() + _batch_bytes) >= MAX_PENDING_FILE_BYTES))
+							{
+								// Wait until the socket is drained
+								file_read_deferred = true;
+								++it;
+								continue;
+							}
+
+							std::shared_ptr<const ov::Data> payload;
+
+							if (length == 0)
+							{
+								// Empty DATA frame with END_STREAM flag (not subject to flow control)
+								payload = nullptr;
+							}
+							else if (pending_data.file != nullptr)
+							{
+								payload = pending_data.file->Read(pending_data.offset, length);
+
+								if ((payload == nullptr) || payload->IsEmpty())
+								{
+									logte("Could not read file: %s (offset: %jd)", pending_data.file->GetPath().CStr(), static_cast<intmax_t>(pending_data.offset));
+
+									// The response cannot be completed, so the peer is notified instead of waiting for the rest
+									auto rst_stream_payload = std::make_shared<ov::Data>(sizeof(uint32_t));
+									ov::ByteStream stream(rst_stream_payload.get());
+									stream.WriteBE32(INTERNAL_ERROR);
+
+									AppendToBatch(prot::h2::Http2Frame::Type::RstStream, 0, stream_id, rst_stream_payload);
+									sent = true;
+
+									it = _stream_map.erase(it);
+									continue;
+								}
+
+								length = payload->GetLength();
+							}
+							else
+							{
+								payload = pending_data.data->Subdata(pending_data.offset, length);
+							}
+
+							pending_data.offset += length;
+							pending_data.remaining -= length;
+
+							_connection_window_size -= length;
+							context.window_size -= length;
+
+							bool end_stream = false;
+
+							if (pending_data.remaining == 0)
+							{
+								end_stream = pending_data.end_stream;
+								context.pending_list.pop_front();
+							}
+
+							AppendToBatch(prot::h2::Http2Frame::Type::Data,
+										  end_stream ? static_cast<uint8_t>(prot::h2::Http2DataFrame::Flags::EndStream) : 0,
+										  stream_id, payload);
+							sent = true;
+
+							if (end_stream || (context.released && context.pending_list.empty()))
+							{
+								// Nothing will be sent on the stream anymore
+								it = _stream_map.erase(it);
+							}
+							else
+							{
+								++it;
+							}
+
+							if ((_batch.size() >= MAX_BATCH_FRAME_COUNT) || (_batch_bytes >= MAX_BATCH_BYTES))
+							{
+								if (SendBatch() == false)
+								{
+									return false;
+								}
+							}
+						}
+					}
+
+					if (SendBatch() == false)
+					{
+						return false;
+					}
+
+					if ((file_read_deferred == false) || _waiting_for_socket_drained)
+					{
+						return true;
+					}
+
+					std::weak_ptr<Http2FrameWriter> weak_writer = GetSharedPtr();
+
+					_waiting_for_socket_drained = _client_socket->SetSendDrainedCallback(MAX_PENDING_FILE_BYTES, [weak_writer]() {
+						auto writer = weak_writer.lock();
+						if (writer != nullptr)
+						{
+							writer->OnSocketDrained();
+						}
+					});
+
+					if (_waiting_for_socket_drained)
+					{
+						return true;
+					}
+
+					// Drained in the meantime, so the files are read again
+				}
+			}
+
+			void Http2FrameWriter::OnSocketDrained()
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				_waiting_for_socket_drained = false;
+
+				if (_closed)
+				{
+					return;
+				}
+
+				if (FlushInternal() == false)
+				{
+					logtd("Could not send the frames after the socket is drained: %s", _client_socket->ToString().CStr());
+				}
+			}
+
+			bool Http2FrameWriter::SendBatch()
+			{
+				if (_batch.empty())
+				{
+					return true;
+				}
+
+				auto header_size = _batch.size() * HTTP2_FRAME_HEADER_SIZE;
+
+				if (_tls_data != nullptr)
+				{
+					// The frames are encrypted together, so a TLS record is not made for each frame header
+					auto plain_data = std::make_shared<ov::Data>(_batch_bytes);
+					uint8_t header[HTTP2_FRAME_HEADER_SIZE];
+
+					for (const auto &frame : _batch)
+					{
+						auto payload_length = (frame.payload != nullptr) ? frame.payload->GetLength() : 0;
+
+						prot::h2::Http2Frame::WriteHeader(header, payload_length, frame.type, frame.flags, frame.stream_id);
+						plain_data->Append(header, HTTP2_FRAME_HEADER_SIZE);
+
+						if (payload_length > 0)
+						{
+							plain_data->Append(frame.payload);
+						}
+					}
+
+					_batch.clear();
+					_batch_bytes = 0;
+
+					std::shared_ptr<const ov::Data> cipher_data;
+
+					if (_tls_data->Encrypt(plain_data, &cipher_data) == false)
+					{
+						logte("Failed to encrypt data: %s", _client_socket->ToString().CStr());
+						return false;
+					}
+
+					if ((cipher_data == nullptr) || cipher_data->IsEmpty())
+					{
+						// There is no data to send
+						return true;
+					}
+
+					// The cipher data is owned by this batch, so it is sent without copying
+					return _client_socket->Send(std::vector<std::shared_ptr<const ov::Data>>{cipher_data});
+				}
+
+				// All frame headers of the batch are written to a scratch buffer at once
+				auto scratch = std::make_shared<ov::Data>(header_size);
+				scratch->SetLength(header_size);
+
+				auto header = scratch->GetWritableDataAs<uint8_t>();
+
+				for (const auto &frame : _batch)
+				{
+					auto payload_length = (frame.payload != nullptr) ? frame.payload->GetLength() : 0;
+
+					prot::h2::Http2Frame::WriteHeader(header, payload_length, frame.type, frame.flags, frame.stream_id);
+					header += HTTP2_FRAME_HEADER_SIZE;
+				}
+
+				// The views are made after all headers are written (ov::Data is copied on write when it is shared)
+				std::shared_ptr<const ov::Data> headers = scratch;
+				std::vector<std::shared_ptr<const ov::Data>> data_list;
+				data_list.reserve(_batch.size() * 2);
+
+				off_t offset = 0;
+
+				for (const auto &frame : _batch)
+				{
+					data_list.push_back(headers->Subdata(offset, HTTP2_FRAME_HEADER_SIZE));
+					offset += HTTP2_FRAME_HEADER_SIZE;
+
+					if ((frame.payload != nullptr) && (frame.payload->IsEmpty() == false))
+					{
+						data_list.push_back(frame.payload);
+					}
+				}
+
+				_batch.clear();
+				_batch_bytes = 0;
+
+				return _client_socket->Send(data_list);
+			}
+		}  // namespace h2
+	}  // namespace svr
+}  // namespace http
@@ -0,0 +1,125 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2022 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovcrypto/openssl/tls_server_data.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovsocket/client_socket.h>
+
+#include "../../protocol/http2/frames/http2_frames.h"
+
+namespace http
+{
+	namespace svr
+	{
+		namespace h2
+		{
+			// Writes the frames of all streams of an HTTP/2 connection
+			//
+			// - Frame headers are written to a scratch buffer of the batch, and sent with the payloads (which are not copied) using writev
+			// - DATA frames are sent as much as the flow control windows of the peer allow (RFC 7540 6.9),
+			//   and the rest waits in the queue of the stream until WINDOW_UPDATE is received
+			// - The frames of several streams are sent together in a batch, one DATA frame per stream in turn
+			// - Files are read only while the socket has less than MAX_PENDING_FILE_BYTES to send,
+			//   and the reading is resumed when the socket is drained
+			class Http2FrameWriter : public ov::EnableSharedFromThis<Http2FrameWriter>
+			{
+			public:
+				// https://www.rfc-editor.org/rfc/rfc7540#section-6.9.2
+				static constexpr int64_t DEFAULT_INITIAL_WINDOW_SIZE = 65535;
+				static constexpr int64_t MAX_WINDOW_SIZE = 0x7FFFFFFF;
+				// SETTINGS_MAX_FRAME_SIZE is not advertised by the peer less than this value
+				static constexpr size_t MAX_DATA_FRAME_PAYLOAD_SIZE = 16384;
+				// Limits the size of a batch, since the batch is copied into a buffer to be encrypted for TLS
+				static constexpr size_t MAX_BATCH_FRAME_COUNT = 512;
+				static constexpr size_t MAX_BATCH_BYTES = 1024 * 1024;
+				// Limits the data read from the files waiting in the socket (the windows of the peer can be up to 2 GB)
+				static constexpr size_t MAX_PENDING_FILE_BYTES = 256 * 1024;
+				// https://www.rfc-editor.org/rfc/rfc7540#section-7
+				static constexpr uint32_t INTERNAL_ERROR = 0x2;
+
+				Http2FrameWriter(const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<ov::TlsServerData> &tls_data);
+
+				// Sends the frames which are not subject to flow control (HEADERS, CONTINUATION, SETTINGS, ...) at once,
+				// so the frames are not interleaved with the frames of the other streams
+				bool SendFrames(const std::vector<std::shared_ptr<const prot::h2::Http2Frame>> &frames);
+				bool SendFrame(const std::shared_ptr<const prot::h2::Http2Frame> &frame);
+
+				// Queues the payload of the stream, which is sent as DATA frames when the flow control windows allow
+				bool SendData(uint32_t stream_id, const std::shared_ptr<const ov::Data> &data, bool end_stream);
+				// The file is read piece by piece when the frames are sent, so the whole file is not loaded at once
+				bool SendFile(uint32_t stream_id, const std::shared_ptr<const ov::ReadOnlyFile> &file, bool end_stream);
+
+				// Called when the stream is opened by the peer (HEADERS) or by the server (PUSH_PROMISE)
+				void OpenStream(uint32_t stream_id);
+				// Called when the exchange of the stream is completed,
+				// the stream is removed after the queued DATA frames are sent
+				void ReleaseStream(uint32_t stream_id);
+				// Called when the stream is reset by the peer (RST_STREAM), the queued DATA frames are discarded
+				void ResetStream(uint32_t stream_id);
+
+				// WINDOW_UPDATE - stream_id 0 means the connection
+				bool OnWindowUpdate(uint32_t stream_id, uint32_t increment);
+				// SETTINGS_INITIAL_WINDOW_SIZE
+				bool OnInitialWindowSizeChanged(uint32_t initial_window_size);
+
+				void Close();
+
+			private:
+				struct PendingData
+				{
+					std::shared_ptr<const ov::Data> data;
+					std::shared_ptr<const ov::ReadOnlyFile> file;
+					// Offset of the data or the file to be sent next
+					off_t offset = 0;
+					size_t remaining = 0;
+					bool end_stream = false;
+				};
+
+				struct StreamContext
+				{
+					int64_t window_size = DEFAULT_INITIAL_WINDOW_SIZE;
+					std::deque<PendingData> pending_list;
+					bool released = false;
+				};
+
+				struct Frame
+				{
+					prot::h2::Http2Frame::Type type;
+					uint8_t flags;
+					uint32_t stream_id;
+					std::shared_ptr<const ov::Data> payload;
+				};
+
+				bool QueueData(uint32_t stream_id, PendingData pending_data);
+
+				void AppendToBatch(prot::h2::Http2Frame::Type type, uint8_t flags, uint32_t stream_id, const std::shared_ptr<const ov::Data> &payload);
+				// Moves the DATA frames allowed by the flow control windows to the batch, and sends the batch
+				bool FlushInternal();
+				bool SendBatch();
+				// Called by the socket when the data waiting in the socket goes below MAX_PENDING_FILE_BYTES
+				void OnSocketDrained();
+
+				std::shared_ptr<ov::ClientSocket> _client_socket;
+				std::shared_ptr<ov::TlsServerData> _tls_data;
+
+				std::mutex _mutex;
+
+				int64_t _connection_window_size = DEFAULT_INITIAL_WINDOW_SIZE;
+				int64_t _initial_window_size = DEFAULT_INITIAL_WINDOW_SIZE;
+				std::map<uint32_t, StreamContext> _stream_map;
+
+				std::vector<Frame> _batch;
+				size_t _batch_bytes = 0;
+				bool _closed = false;
+				bool _waiting_for_socket_drained = false;
+			};
+		}  // namespace h2
+	}  // namespace svr
+}  // namespace http
@@ -63,6 +63,26 @@ namespace http
 				return data->GetLength();
 			}
 
+			bool Http2Request::SetHeaderFields(const std::vector<hpack::HeaderField> &header_fields)
+			{
+				if (GetHeaderParingStatus() == StatusCode::OK)
+				{
+					// Already parsed
+					return false;
+				}
+
+				for (const auto &header_field : header_fields)
+				{
+					_headers.emplace(header_field.GetName(), header_field.GetValue());
+				}
+
+				_parse_status = StatusCode::OK;
+
+				PostHeaderParsedProcess();
+
+				return true;
+			}
+
 			StatusCode Http2Request::GetHeaderParingStatus() const
 			{
 				return _parse_status;
@@ -24,7 +24,9 @@ namespace http
 				// Constructor
 				Http2Request(const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<hpack::Decoder> &hpack_decoder);
 
-				
+				// Used for the request of a pushed stream, which is made by the server itself (PUSH_PROMISE)
+				bool SetHeaderFields(const std::vector<hpack::HeaderField> &header_fields);
+
 
 				/////////////////////////////////////
 				// Implementation of HttpRequest
@@ -16,16 +16,17 @@ namespace http
 		namespace h2
 		{
 			// Constructor
-			Http2Response::Http2Response(uint32_t stream_id, const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<hpack::Encoder> &hpack_encoder)
+			Http2Response::Http2Response(uint32_t stream_id, const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<hpack::Encoder> &hpack_encoder, const std::shared_ptr<Http2FrameWriter> &frame_writer)
 				: HttpResponse(client_socket)
 			{
 				_stream_id = stream_id;
 				_hpack_encoder = hpack_encoder;
+				_frame_writer = frame_writer;
 			}
 
 			bool Http2Response::Send(const std::shared_ptr<prot::h2::Http2Frame> &frame)
 			{
-				return HttpResponse::Send(frame->ToData());
+				return _frame_writer->SendFrame(frame);
 			}
 
 			void Http2Response::SetKeepStream(bool keep_stream)
@@ -35,14 +36,19 @@ namespace http
 			
 			bool Http2Response::Send(const std::shared_ptr<prot::h2::Http2DataFrame> &data_frame, bool end_stream)
 			{
-				auto frame = std::make_shared<prot::h2::Http2DataFrame>(_stream_id);
-				frame->SetData(data_frame->GetData());
-				if (end_stream == true)
-				{
-					frame->SetEndStream();
-				}
+				return _frame_writer->SendData(_stream_id, data_frame->GetData(), end_stream);
+			}
 
-				return Send(frame);
+			bool Http2Response::SetStreamingMode()
+			{
+				// END_STREAM is sent by SendEndOfStream()
+				SetKeepStream(true);
+				return true;
+			}
+
+			bool Http2Response::SendEndOfStream()
+			{
+				return _frame_writer->SendData(_stream_id, nullptr, true);
 			}
 
 			int32_t Http2Response::SendHeader()
@@ -81,6 +87,9 @@ namespace http
 					fragmented = false;
 				}
 				
+				// HEADERS and CONTINUATION frames must be sent without being interleaved with the frames of other streams
+				std::vector<std::shared_ptr<const prot::h2::Http2Frame>> frames;
+
 				// Send Headers frame
 				auto headers_frame = std::make_shared<prot::h2::Http2HeadersFrame>(_stream_id);
 				headers_frame->SetHeaderBlockFragment(head_block_fragment);
@@ -96,10 +105,7 @@ namespace http
 					headers_frame->SetEndStream();
 				}
 
-				if (Send(headers_frame) == false)
-				{
-					return -1;
-				}
+				frames.push_back(headers_frame);
 
 				sent_size += head_block_fragment->GetLength();
 
@@ -122,10 +128,7 @@ namespace http
 							continuation_frame->SetEndHeaders();
 						}
 
-						if (Send(continuation_frame) == false)
-						{
-							return -1;
-						}
+						frames.push_back(continuation_frame);
 
 						sent_size += fragment_size;
 						remaining_size -= fragment_size;
@@ -133,6 +136,11 @@ namespace http
 					}
 				}
 
+				if (_frame_writer->SendFrames(frames) == false)
+				{
+					return -1;
+				}
+
 				return sent_size;
 			}
 
@@ -141,52 +149,40 @@ namespace http
 				logtd("Trying to send datas...");
 
 				uint32_t sent_bytes = 0;
+				auto file = GetResponseFile();
+				const auto &data_list = GetResponseDataList();
 
-				for (const auto &data : GetResponseDataList())
+				// The data is split into DATA frames by the frame writer as the flow control windows allow
+				for (const auto &data : data_list)
 				{
-					size_t offset = 0;
-					auto data_fragment = data;
-					while (offset + MAX_HTTP2_DATA_SIZE < data->GetLength())
-					{
-						data_fragment = data->Subdata(offset, MAX_HTTP2_DATA_SIZE);
-
-						auto payload_frame = std::make_shared<prot::h2::Http2DataFrame>(_stream_id);
-						payload_frame->SetData(data_fragment);
-
-						if (Send(payload_frame) == false)
-						{
-							logte("Failed to send payload");
-							ResetResponseData();
-							return -1;
-						}
-
-						offset += MAX_HTTP2_DATA_SIZE;
-					}
-
-					// Last fragment
-					auto payload_frame = std::make_shared<prot::h2::Http2DataFrame>(_stream_id);
-					data_fragment = data->Subdata(offset);
-					payload_frame->SetData(data_fragment);
+					bool end_stream = (_keep_stream == false) && (file == nullptr) && (&data == &data_list.back());
 
-					// End Stream
-					if (_keep_stream == false && (&data == &GetResponseDataList().back()))
+					if (_frame_writer->SendData(_stream_id, data, end_stream) == false)
 					{
-						payload_frame->SetEndStream();
+						logte("Failed to send payload");
+						ResetResponseData();
+						return -1;
 					}
 
-					if (Send(payload_frame) == false)
+					sent_bytes += data->GetLength();
+				}
+
+				if (file != nullptr)
+				{
+					// The file is read piece by piece when the frames are sent
+					if (_frame_writer->SendFile(_stream_id, file, _keep_stream == false) == false)
 					{
 						logte("Failed to send payload");
 						ResetResponseData();
 						return -1;
 					}
 
-					sent_bytes += data->GetLength();
+					sent_bytes += file->GetSize();
 				}
 
 				ResetResponseData();
 
-				logtd("All datas are sent...");
+				logtd("All datas are queued...");
 
 				return sent_bytes;
 			}
@@ -12,6 +12,7 @@
 #include "../http_response.h"
 #include "../../protocol/http2/frames/http2_frames.h"
 #include "../../hpack/encoder.h"
+#include "http2_frame_writer.h"
 
 #define MAX_HTTP2_HEADER_SIZE (1024 * 1024)
 #define MAX_HTTP2_DATA_SIZE (16384)
@@ -26,7 +27,7 @@ namespace http
 			{
 			public:
 				// Constructor
-				Http2Response(uint32_t stream_id, const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<hpack::Encoder> &hpack_encoder);
+				Http2Response(uint32_t stream_id, const std::shared_ptr<ov::ClientSocket> &client_socket, const std::shared_ptr<hpack::Encoder> &hpack_encoder, const std::shared_ptr<Http2FrameWriter> &frame_writer);
 
 				bool Send(const std::shared_ptr<prot::h2::Http2Frame> &frame);
 
@@ -41,9 +42,13 @@ namespace http
 				int32_t SendHeader() override;
 				int32_t SendPayload() override;
 
+				bool SetStreamingMode() override;
+				bool SendEndOfStream() override;
+
 				uint32_t _stream_id = 0;
 				bool _keep_stream = false;
 				std::shared_ptr<hpack::Encoder> _hpack_encoder;
+				std::shared_ptr<Http2FrameWriter> _frame_writer;
 			};
 		}
 	}
@@ -24,7 +24,7 @@ namespace http
 				_request->SetConnectionType(ConnectionType::Http20);
 				_request->SetTlsData(GetConnection()->GetTlsData());
 
-				_response = std::make_shared<Http2Response>(stream_id, GetConnection()->GetSocket(), GetConnection()->GetHpackEncoder());
+				_response = std::make_shared<Http2Response>(stream_id, GetConnection()->GetSocket(), GetConnection()->GetHpackEncoder(), GetConnection()->GetHttp2FrameWriter());
 				_response->SetTlsData(GetConnection()->GetTlsData());
 				_response->SetHeader("server", "OvenMediaEngine");
 				_response->SetHeader("content-type", "text/html");
@@ -94,6 +94,24 @@ namespace http
 				return true;
 			}
 
+			bool HttpStream::OnPushPromised(const std::vector<hpack::HeaderField> &header_fields)
+			{
+				if (_request->SetHeaderFields(header_fields) == false)
+				{
+					return false;
+				}
+
+				GetConnection()->GetHttp2FrameWriter()->OpenStream(_stream_id);
+
+				SetKeepAlive(true);
+				_response->SetMethod(_request->GetMethod());
+
+				// The response will be sent by the server without receiving anything from the client
+				SetStatus(Status::Exchanging);
+
+				return true;
+			}
+
 			bool HttpStream::OnEndStream()
 			{
 				// End of Stream, that means no more data will be sent
@@ -227,6 +245,9 @@ namespace http
 				if (_header_block == nullptr)
 				{
 					_header_block = std::make_shared<ov::Data>();
+
+					// The stream is opened by the first HEADERS frame
+					GetConnection()->GetHttp2FrameWriter()->OpenStream(_stream_id);
 				}
 
 				_header_block->Append(frame->GetHeaderBlockFragment());
@@ -265,6 +286,10 @@ namespace http
 			bool HttpStream::OnRstStreamFrameReceived(const std::shared_ptr<const Http2RstStreamFrame> &frame)
 			{
 				logtd("%s", frame->ToString().CStr());
+
+				// The queued DATA frames of the stream must not be sent anymore
+				GetConnection()->GetHttp2FrameWriter()->ResetStream(_stream_id);
+
 				SetStatus(HttpExchange::Status::Error);
 				return true;
 			}
@@ -280,6 +305,21 @@ namespace http
 						auto hpack_encoder = GetConnection()->GetHpackEncoder();
 						hpack_encoder->UpdateDynamicTableSize(std::min(size, MAX_HEADER_TABLE_SIZE));
 					}
+
+					// https://www.rfc-editor.org/rfc/rfc7540#section-6.5.2
+					// SETTINGS_ENABLE_PUSH : The initial value is 1, which indicates that server push is permitted
+					auto [enable_push_exist, enable_push] = frame->GetParameter(Http2SettingsFrame::Parameters::EnablePush);
+					if (enable_push_exist)
+					{
+						GetConnection()->SetHttp2PushEnabled(enable_push != 0);
+					}
+
+					// SETTINGS_INITIAL_WINDOW_SIZE changes the flow control windows of all streams
+					auto [initial_window_size_exist, initial_window_size] = frame->GetParameter(Http2SettingsFrame::Parameters::InitialWindowSize);
+					if (initial_window_size_exist)
+					{
+						GetConnection()->GetHttp2FrameWriter()->OnInitialWindowSizeChanged(initial_window_size);
+					}
 					
 					// Settings Frame
 					auto settings_frame = std::make_shared<Http2SettingsFrame>();
@@ -312,8 +352,8 @@ namespace http
 
 			bool HttpStream::OnWindowUpdateFrameReceived(const std::shared_ptr<const Http2WindowUpdateFrame> &frame)
 			{
-				// Nothing to do yet, just ignore
-				return true;
+				// The DATA frames waiting for the window are sent
+				return GetConnection()->GetHttp2FrameWriter()->OnWindowUpdate(frame->GetStreamId(), frame->GetWindowSizeIncrement());
 			}
 
 			bool HttpStream::OnGoAwayFrameReceived(const std::shared_ptr<const Http2GoAwayFrame> &frame)
@@ -38,6 +38,10 @@ namespace http
 				uint32_t GetStreamId() const;
 				bool OnFrameReceived(const std::shared_ptr<Http2Frame> &frame);
 
+				// The stream promised by the server (PUSH_PROMISE) has no request from the client,
+				// so the request is made from the header fields of the PUSH_PROMISE frame
+				bool OnPushPromised(const std::vector<hpack::HeaderField> &header_fields);
+
 			private:
 				// Send Settings frame and Window_Update frame
 				bool SendInitialControlMessage();
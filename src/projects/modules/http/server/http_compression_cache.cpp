@@ -0,0 +1,247 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "http_compression_cache.h"
+
+#include <base/ovcrypto/ovcrypto.h>
+#include <base/ovlibrary/zip.h>
+
+#include "config/config_manager.h"
+
+#include "./http_server_private.h"
+
+namespace http
+{
+	namespace svr
+	{
+		const char *StringFromContentEncoding(ContentEncoding encoding)
+		{
+			switch (encoding)
+			{
+				case ContentEncoding::Identity:
+					return "identity";
+
+				case ContentEncoding::Gzip:
+					return "gzip";
+			}
+
+			return "identity";
+		}
+
+		HttpCompressionCache::HttpCompressionCache()
+		{
+			auto compression_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules().GetResponseCompression();
+
+			_max_cached_bytes = static_cast<size_t>(std::max(compression_config.GetCacheSizeMB(), 0)) * 1024 * 1024;
+		}
+
+		ContentEncoding HttpCompressionCache::SelectEncoding(const ov::String &accept_encoding)
+		{
+			// https://www.rfc-editor.org/rfc/rfc9110#section-12.5.3
+			// Accept-Encoding: gzip;q=1.0, identity; q=0.5, *;q=0
+			bool gzip_accepted = false;
+			bool gzip_rejected = false;
+			bool any_accepted = false;
+
+			for (const auto &item : accept_encoding.Split(","))
+			{
+				auto params = item.Split(";");
+				auto coding = params[0].Trim().LowerCaseString();
+				double qvalue = 1.0;
+
+				for (size_t index = 1; index < params.size(); index++)
+				{
+					auto param = params[index].Trim();
+
+					if (param.LowerCaseString().HasPrefix("q="))
+					{
+						qvalue = ov::Converter::ToDouble(param.Substring(2).CStr());
+					}
+				}
+
+				if (coding == "gzip" || coding == "x-gzip")
+				{
+					((qvalue > 0.0) ? gzip_accepted : gzip_rejected) = true;
+				}
+				else if (coding == "*")
+				{
+					any_accepted = (qvalue > 0.0);
+				}
+			}
+
+			if (gzip_accepted || (any_accepted && (gzip_rejected == false)))
+			{
+				return ContentEncoding::Gzip;
+			}
+
+			return ContentEncoding::Identity;
+		}
+
+		bool HttpCompressionCache::IsCompressible(const ov::String &content_type)
+		{
+			// Remove parameters (e.g. application/json;charset=UTF-8)
+			auto mime_type = content_type.Split(";")[0].Trim().LowerCaseString();
+
+			if (mime_type.HasPrefix("text/") || mime_type.HasSuffix("+json") || mime_type.HasSuffix("+xml"))
+			{
+				return true;
+			}
+
+			return (mime_type == "application/json") ||
+				   (mime_type == "application/javascript") ||
+				   (mime_type == "application/xml") ||
+				   (mime_type == "application/vnd.apple.mpegurl") ||
+				   (mime_type == "application/x-mpegurl");
+		}
+
+		ov::String HttpCompressionCache::MakeContentKey(const std::shared_ptr<const ov::Data> &data)
+		{
+			auto md5 = ov::MessageDigest::ComputeDigest(ov::CryptoAlgorithm::Md5, data);
+			if (md5 == nullptr)
+			{
+				return "";
+			}
+
+			return ov::String::FormatString("%s-%zu", md5->ToHexString().CStr(), data->GetLength());
+		}
+
+		std::shared_ptr<const ov::Data> HttpCompressionCache::Compress(ContentEncoding encoding, const ov::String &content_key, const std::shared_ptr<const ov::Data> &data)
+		{
+			if ((encoding == ContentEncoding::Identity) || (data == nullptr))
+			{
+				return data;
+			}
+
+			if (content_key.IsEmpty())
+			{
+				// Cannot be cached
+				return CompressInternal(encoding, data);
+			}
+
+			auto key = ov::String::FormatString("%s:%s", StringFromContentEncoding(encoding), content_key.CStr());
+
+			std::promise<std::shared_ptr<const ov::Data>> promise;
+			std::shared_future<std::shared_ptr<const ov::Data>> compressed_future;
+
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+
+				auto it = _entry_map.find(key);
+				if (it != _entry_map.end())
+				{
+					_hit_count++;
+
+					// Move to the front (most recently used)
+					_lru_list.splice(_lru_list.begin(), _lru_list, it->second);
+
+					compressed_future = it->second->compressed;
+					lock.unlock();
+
+					// Waits if another request is compressing the same content
+					return compressed_future.get();
+				}
+
+				_miss_count++;
+
+				compressed_future = promise.get_future().share();
+
+				_lru_list.push_front({key, compressed_future, 0});
+				_entry_map.emplace(key, _lru_list.begin());
+			}
+
+			// Compress without the lock
+			auto compressed = CompressInternal(encoding, data);
+			promise.set_value(compressed);
+
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				auto it = _entry_map.find(key);
+
+				// The entry may have been evicted (or replaced) while compressing
+				if ((it != _entry_map.end()) && (it->second->size == 0))
+				{
+					if (compressed == nullptr)
+					{
+						// Failures are not cached
+						_lru_list.erase(it->second);
+						_entry_map.erase(it);
+					}
+					else
+					{
+						it->second->size = compressed->GetLength();
+						_cached_bytes += it->second->size;
+
+						EvictIfNeeded();
+					}
+				}
+			}
+
+			return compressed;
+		}
+
+		HttpCompressionCache::Stats HttpCompressionCache::GetStats() const
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+
+			Stats stats;
+
+			stats.hit_count = _hit_count;
+			stats.miss_count = _miss_count;
+			stats.eviction_count = _eviction_count;
+			stats.entry_count = _lru_list.size();
+			stats.cached_bytes = _cached_bytes;
+
+			return stats;
+		}
+
+		std::shared_ptr<const ov::Data> HttpCompressionCache::CompressInternal(ContentEncoding encoding, const std::shared_ptr<const ov::Data> &data)
+		{
+			switch (encoding)
+			{
+				case ContentEncoding::Identity:
+					return data;
+
+				case ContentEncoding::Gzip: {
+					auto compressed = ov::Zip::CompressGzip(data);
+
+					if (compressed == nullptr)
+					{
+						logtw("Could not compress the data using gzip (%zu bytes)", data->GetLength());
+					}
+
+					return compressed;
+				}
+			}
+
+			return nullptr;
+		}
+
+		void HttpCompressionCache::EvictIfNeeded()
+		{
+			auto it = _lru_list.end();
+
+			while ((_cached_bytes > _max_cached_bytes) && (it != _lru_list.begin()))
+			{
+				--it;
+
+				if (it->size == 0)
+				{
+					// Being compressed
+					continue;
+				}
+
+				_cached_bytes -= it->size;
+				_eviction_count++;
+
+				_entry_map.erase(it->key);
+				it = _lru_list.erase(it);
+			}
+		}
+	}  // namespace svr
+}  // namespace http
@@ -0,0 +1,92 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+#include <future>
+#include <list>
+
+namespace http
+{
+	namespace svr
+	{
+		enum class ContentEncoding : uint8_t
+		{
+			Identity,
+			Gzip,
+		};
+
+		const char *StringFromContentEncoding(ContentEncoding encoding);
+
+		// Compressed responses shared by all connections
+		//
+		// The entries are keyed by the encoding and the digest of the content, so the same version of a playlist
+		// is compressed only once regardless of how many clients request it. When several clients request a new version
+		// at the same time, only the first one compresses it and the others wait for the result.
+		// The least recently used entries are evicted when the total size exceeds the limit.
+		class HttpCompressionCache : public ov::Singleton<HttpCompressionCache>
+		{
+		public:
+			struct Stats
+			{
+				uint64_t hit_count = 0;
+				uint64_t miss_count = 0;
+				uint64_t eviction_count = 0;
+				size_t entry_count = 0;
+				size_t cached_bytes = 0;
+			};
+
+			HttpCompressionCache();
+
+			// Selects the encoding supported by the client from Accept-Encoding (Identity if nothing is supported)
+			static ContentEncoding SelectEncoding(const ov::String &accept_encoding);
+			// Only text based contents are compressed (media segments are already compressed)
+			static bool IsCompressible(const ov::String &content_type);
+
+			// Returns the key of the content which can be used for Compress()
+			static ov::String MakeContentKey(const std::shared_ptr<const ov::Data> &data);
+
+			// Returns the compressed data of the content from the cache, or compresses it if it is not cached
+			//
+			// content_key identifies the content (e.g. MakeContentKey(), or a version of the playlist that is unique in the server)
+			// Returns nullptr if the data could not be compressed
+			std::shared_ptr<const ov::Data> Compress(ContentEncoding encoding, const ov::String &content_key, const std::shared_ptr<const ov::Data> &data);
+
+			Stats GetStats() const;
+
+		private:
+			struct Entry
+			{
+				ov::String key;
+				std::shared_future<std::shared_ptr<const ov::Data>> compressed;
+				// 0 while the data is being compressed
+				size_t size = 0;
+			};
+
+			static std::shared_ptr<const ov::Data> CompressInternal(ContentEncoding encoding, const std::shared_ptr<const ov::Data> &data);
+
+			// _mutex must be held
+			void EvictIfNeeded();
+
+			mutable std::mutex _mutex;
+
+			// Most recently used entry is at the front
+			std::list<Entry> _lru_list;
+			std::unordered_map<ov::String, std::list<Entry>::iterator> _entry_map;
+
+			size_t _max_cached_bytes = 0;
+			size_t _cached_bytes = 0;
+
+			uint64_t _hit_count = 0;
+			uint64_t _miss_count = 0;
+			uint64_t _eviction_count = 0;
+		};
+	}  // namespace svr
+}  // namespace http
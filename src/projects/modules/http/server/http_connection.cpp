@@ -122,6 +122,9 @@ namespace http
 				{
 					auto http2_stream = std::static_pointer_cast<h2::HttpStream>(exchange);
 
+					// The DATA frames of the stream may still be waiting for the flow control window
+					_http2_frame_writer->ReleaseStream(http2_stream->GetStreamId());
+
 					// Lock
 					std::unique_lock<std::mutex> lock(_http_stream_map_guard);
 					_http_stream_map.erase(http2_stream->GetStreamId());
@@ -199,6 +202,87 @@ namespace http
 			return _hpack_decoder;
 		}
 
+		std::shared_ptr<h2::Http2FrameWriter> HttpConnection::GetHttp2FrameWriter() const
+		{
+			return _http2_frame_writer;
+		}
+
+		void HttpConnection::SetHttp2PushEnabled(bool enabled)
+		{
+			_http2_push_enabled = enabled;
+		}
+
+		bool HttpConnection::IsHttp2PushEnabled() const
+		{
+			return (_connection_type == ConnectionType::Http20) && _http2_push_enabled;
+		}
+
+		std::shared_ptr<HttpExchange> HttpConnection::PushPromise(const std::shared_ptr<HttpExchange> &exchange, const ov::String &path)
+		{
+			if (IsHttp2PushEnabled() == false)
+			{
+				return nullptr;
+			}
+
+			auto associated_stream = std::dynamic_pointer_cast<h2::HttpStream>(exchange);
+			if (associated_stream == nullptr)
+			{
+				return nullptr;
+			}
+
+			auto request = exchange->GetRequest();
+
+			// https://www.rfc-editor.org/rfc/rfc7540#section-8.2.1
+			// Promised requests MUST be cacheable, MUST be safe and MUST NOT include a request body
+			std::vector<hpack::HeaderField> header_fields = {
+				{":method", "GET"},
+				{":scheme", (_tls_data != nullptr) ? "https" : "http"},
+				{":authority", request->GetHost()},
+				{":path", path}};
+
+			std::lock_guard<std::mutex> push_promise_lock(_push_promise_guard);
+
+			auto promised_stream_id = _next_push_stream_id;
+
+			auto promised_stream = std::make_shared<h2::HttpStream>(GetSharedPtr(), promised_stream_id);
+			if (promised_stream->OnPushPromised(header_fields) == false)
+			{
+				return nullptr;
+			}
+
+			_next_push_stream_id += 2;
+
+			std::unique_lock<std::mutex> lock(_http_stream_map_guard);
+			_http_stream_map.emplace(promised_stream_id, promised_stream);
+			lock.unlock();
+
+			// The header fields are not indexed, so the dynamic table of the encoder is not changed
+			auto header_block = std::make_shared<ov::Data>();
+			for (const auto &header_field : header_fields)
+			{
+				header_block->Append(_hpack_encoder->Encode(header_field, hpack::Encoder::EncodingType::LiteralWithoutIndexing));
+			}
+
+			auto push_promise_frame = std::make_shared<Http2PushPromiseFrame>(associated_stream->GetStreamId());
+			push_promise_frame->SetPromisedStreamId(promised_stream_id);
+			push_promise_frame->SetHeaderBlockFragment(header_block);
+			push_promise_frame->SetEndHeaders();
+
+			auto associated_response = std::static_pointer_cast<h2::Http2Response>(associated_stream->GetResponse());
+			if (associated_response->Send(push_promise_frame) == false)
+			{
+				_http2_frame_writer->ResetStream(promised_stream_id);
+
+				lock.lock();
+				_http_stream_map.erase(promised_stream_id);
+				return nullptr;
+			}
+
+			logtd("%s : Push promised [%u] %s (associated stream : %u)", ToString().CStr(), promised_stream_id, path.CStr(), associated_stream->GetStreamId());
+
+			return promised_stream;
+		}
+
 		// Find Interceptor
 		std::shared_ptr<RequestInterceptor> HttpConnection::FindInterceptor(const std::shared_ptr<HttpExchange> &exchange)
 		{
@@ -271,6 +355,11 @@ namespace http
 				_websocket_session.reset();
 			}
 			
+			if (_http2_frame_writer != nullptr)
+			{
+				_http2_frame_writer->Close();
+			}
+
 			std::unique_lock<std::mutex> map_guard(_http_stream_map_guard);
 			_http_stream_map.clear();
 			map_guard.unlock();
@@ -296,6 +385,25 @@ namespace http
 			auto process_data = data->Clone();
 			while (process_data->GetLength() > 0)
 			{
+				if (_closed == true)
+				{
+					return;
+				}
+
+				if (_waiting_for_file_sent)
+				{
+					// Processed by OnHttp1FileSent()
+					if (_pending_request_data == nullptr)
+					{
+						_pending_request_data = process_data->Clone();
+					}
+					else
+					{
+						_pending_request_data->Append(process_data);
+					}
+					return;
+				}
+
 				ssize_t processed_length = 0;
 
 				switch (_connection_type)
@@ -347,7 +455,28 @@ namespace http
 
 			switch(_http_transaction->GetStatus())
 			{
-				case HttpExchange::Status::Completed:
+				case HttpExchange::Status::Completed: {
+					auto response = _http_transaction->GetResponse();
+
+					if ((response != nullptr) && response->IsSendingFile())
+					{
+						// The connection is closed or the next request is processed after the file is sent
+						std::weak_ptr<HttpConnection> weak_connection = GetSharedPtr();
+						auto keep_alive = _http_transaction->IsKeepAlive();
+
+						_waiting_for_file_sent = true;
+						_http_transaction.reset();
+
+						response->SetFileSentHandler([weak_connection, keep_alive](bool result) {
+							auto connection = weak_connection.lock();
+							if (connection != nullptr)
+							{
+								connection->OnHttp1FileSent(result, keep_alive);
+							}
+						});
+						break;
+					}
+
 					if (_http_transaction->IsKeepAlive() == false)
 					{
 						Close(PhysicalPortDisconnectReason::Disconnect);
@@ -355,6 +484,7 @@ namespace http
 					}
 					_http_transaction.reset();
 					break;
+				}
 
 				case HttpExchange::Status::Upgrade:
 					if (_http_transaction->IsWebSocketUpgradeRequest())
@@ -386,6 +516,38 @@ namespace http
 			return processed_data_length;
 		}
 
+		void HttpConnection::OnHttp1FileSent(bool result, bool keep_alive)
+		{
+			std::lock_guard<std::recursive_mutex> lock(_close_mutex);
+
+			_waiting_for_file_sent = false;
+
+			if (_closed == true)
+			{
+				return;
+			}
+
+			if (result == false)
+			{
+				Close(PhysicalPortDisconnectReason::Error);
+				return;
+			}
+
+			if (keep_alive == false)
+			{
+				Close(PhysicalPortDisconnectReason::Disconnect);
+				return;
+			}
+
+			if (_pending_request_data != nullptr)
+			{
+				auto data = std::move(_pending_request_data);
+				_pending_request_data = nullptr;
+
+				OnDataReceived(data);
+			}
+		}
+
 		ssize_t HttpConnection::OnWebSocketDataReceived(const std::shared_ptr<const ov::Data> &data)
 		{
 			if (_websocket_session == nullptr)
@@ -504,6 +666,7 @@ namespace http
 
 			_hpack_encoder = std::make_shared<hpack::Encoder>();
 			_hpack_decoder = std::make_shared<hpack::Decoder>();
+			_http2_frame_writer = std::make_shared<h2::Http2FrameWriter>(_client_socket, _tls_data);
 
 			// Control Stream (stream id : 0) is always open
 			std::unique_lock<std::mutex> lock(_http_stream_map_guard);
@@ -63,6 +63,17 @@ namespace http
 			// Get HPACK Codec
 			std::shared_ptr<hpack::Encoder> GetHpackEncoder() const;
 			std::shared_ptr<hpack::Decoder> GetHpackDecoder() const;
+			// Get HTTP/2 frame writer
+			std::shared_ptr<h2::Http2FrameWriter> GetHttp2FrameWriter() const;
+
+			// HTTP/2 Server Push
+			//
+			// Promises the resource of the path to the client on the stream of the exchange (PUSH_PROMISE),
+			// and returns the exchange of the promised stream. The response of the resource should be sent through the returned exchange.
+			// Returns nullptr if the connection is not HTTP/2 or the client disabled push (SETTINGS_ENABLE_PUSH = 0).
+			std::shared_ptr<HttpExchange> PushPromise(const std::shared_ptr<HttpExchange> &exchange, const ov::String &path);
+			void SetHttp2PushEnabled(bool enabled);
+			bool IsHttp2PushEnabled() const;
 
 			// To string
 			virtual ov::String ToString() const;
@@ -81,6 +92,8 @@ namespace http
 			ssize_t OnHttp1RequestReceived(const std::shared_ptr<const ov::Data> &data);
 			ssize_t OnHttp2RequestReceived(const std::shared_ptr<const ov::Data> &data);
 			ssize_t OnWebSocketDataReceived(const std::shared_ptr<const ov::Data> &data);
+			// Called when the file of the HTTP/1.1 response has been sent piece by piece
+			void OnHttp1FileSent(bool result, bool keep_alive);
 
 			bool AddStream(const std::shared_ptr<HttpExchange> &exchange);
 			std::shared_ptr<HttpExchange> FindHttpStream(uint32_t stream_id);
@@ -106,6 +119,9 @@ namespace http
 			// For HTTP/1.1
 			///////////////////////
 			std::shared_ptr<h1::HttpTransaction> _http_transaction = nullptr;
+			// While the file of the response is being sent, the next requests are kept so that the responses are not interleaved
+			bool _waiting_for_file_sent = false;
+			std::shared_ptr<ov::Data> _pending_request_data = nullptr;
 
 			///////////////////////
 			// For HTTP/2.0
@@ -122,6 +138,15 @@ namespace http
 			// HTTP/2 HPACK Codec
 			std::shared_ptr<hpack::Encoder> _hpack_encoder = nullptr;
 			std::shared_ptr<hpack::Decoder> _hpack_decoder = nullptr;
+			// Writes the frames of all streams with the flow control of the peer
+			std::shared_ptr<h2::Http2FrameWriter> _http2_frame_writer = nullptr;
+			// Server Push is allowed until the client sends SETTINGS_ENABLE_PUSH = 0
+			std::atomic<bool> _http2_push_enabled{true};
+			// Streams initiated by the server use even-numbered stream identifiers
+			uint32_t _next_push_stream_id = 2;
+			// The promised stream identifiers must be sent in increasing order, so the identifier is allocated
+			// and the PUSH_PROMISE frame is queued under this lock
+			std::mutex _push_promise_guard;
 
 			///////////////////////
 			// For Websocket
@@ -284,6 +284,8 @@ namespace http
 				response->SetIfNoneMatch(if_none_match);
 			}
 
+			response->SetAcceptEncoding(request->GetHeader("Accept-Encoding"));
+
 			return interceptor->OnRequestCompleted(GetSharedPtr());
 		}
 
@@ -30,6 +30,10 @@ namespace http
 
 			auto module_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules();
 			_etag_enabled_by_config = module_config.GetETag().IsEnabled();
+
+			auto &compression_config = module_config.GetResponseCompression();
+			_compression_enabled_by_config = compression_config.IsEnabled();
+			_compression_min_size = static_cast<size_t>(std::max(compression_config.GetMinSize(), 0));
 		}
 
 		HttpResponse::HttpResponse(const std::shared_ptr<HttpResponse> &http_response)
@@ -43,6 +47,7 @@ namespace http
 			_is_header_sent = http_response->_is_header_sent;
 			_response_header = http_response->_response_header;
 			_response_data_list = http_response->_response_data_list;
+			_response_file = http_response->_response_file;
 			_response_data_size = http_response->_response_data_size;
 			_default_value = http_response->_default_value;
 			_created_time = http_response->_created_time;
@@ -88,6 +93,11 @@ namespace http
 			return _if_none_match;
 		}
 
+		void HttpResponse::SetAcceptEncoding(const ov::String &accept_encoding)
+		{
+			_accept_encoding = accept_encoding;
+		}
+
 		StatusCode HttpResponse::GetStatusCode() const
 		{
 			return _status_code;
@@ -177,6 +187,13 @@ namespace http
 				return "";
 			}
 
+			if (_content_encoding != ContentEncoding::Identity)
+			{
+				// https://www.rfc-editor.org/rfc/rfc9110#section-8.8.3
+				// The compressed representation must have a different entity tag from the original one
+				return ov::String::FormatString("%s-%d-%s", _response_hash->ToHexString().CStr(), _response_data_size, StringFromContentEncoding(_content_encoding));
+			}
+
 			return ov::String::FormatString("%s-%d", _response_hash->ToHexString().CStr(), _response_data_size);
 		}
 
@@ -194,22 +211,74 @@ namespace http
 			_response_data_list.push_back(cloned_data);
 			_response_data_size += cloned_data->GetLength();
 
-			if (_etag_enabled_by_config == false)
+			UpdateResponseHash(cloned_data);
+
+			return true;
+		}
+
+		bool HttpResponse::AppendDataList(const std::vector<std::shared_ptr<const ov::Data>> &data_list, const std::shared_ptr<const ov::Data> &md5)
+		{
+			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+
+			for (const auto &data : data_list)
 			{
-				return true;
+				if (data == nullptr)
+				{
+					return false;
+				}
+
+				auto cloned_data = data->Clone();
+
+				_response_data_list.push_back(cloned_data);
+				_response_data_size += cloned_data->GetLength();
 			}
 
-			auto md5 = ov::MessageDigest::ComputeDigest(ov::CryptoAlgorithm::Md5, cloned_data);
+			if ((_etag_enabled_by_config == true) && (_streaming == false))
+			{
+				if (md5 != nullptr)
+				{
+					MergeResponseHash(md5);
+				}
+				else
+				{
+					for (const auto &data : data_list)
+					{
+						UpdateResponseHash(data);
+					}
+				}
+			}
+
+			return true;
+		}
+
+		bool HttpResponse::IsEtagEnabled() const
+		{
+			return _etag_enabled_by_config;
+		}
+
+		void HttpResponse::UpdateResponseHash(const std::shared_ptr<const ov::Data> &data)
+		{
+			// ETag is not used for the streaming response, the data is appended piece by piece as it is produced
+			if ((_etag_enabled_by_config == false) || (_streaming == true))
+			{
+				return;
+			}
+
+			MergeResponseHash(ov::MessageDigest::ComputeDigest(ov::CryptoAlgorithm::Md5, data));
+		}
+
+		void HttpResponse::MergeResponseHash(const std::shared_ptr<const ov::Data> &md5)
+		{
 			if (md5 == nullptr || md5->GetLength() != 16)
 			{
 				// Could not compute MD5
-				OV_ASSERT2(md5->GetLength() == 16);
-				return true;
+				OV_ASSERT2(md5 != nullptr && md5->GetLength() == 16);
+				return;
 			}
 
 			if (_response_hash == nullptr)
 			{
-				_response_hash = md5;
+				_response_hash = md5->Clone();
 			}
 			else
 			{
@@ -220,8 +289,68 @@ namespace http
 					ptr[i] ^= md5->At(i);
 				}
 			}
+		}
 
-			return true;
+		void HttpResponse::CompressPayloadIfNeeded()
+		{
+			if ((_compression_enabled_by_config == false) ||
+				_streaming ||
+				(_response_file != nullptr) ||
+				(GetStatusCode() != StatusCode::OK) ||
+				(_response_data_size < _compression_min_size) ||
+				(GetHeader("Content-Encoding").empty() == false))
+			{
+				// Streaming and file responses are sent as they are, and the payload that is already encoded by the caller is not touched
+				return;
+			}
+
+			auto &content_type = GetHeader("Content-Type");
+			if (content_type.empty() || (HttpCompressionCache::IsCompressible(content_type.front()) == false))
+			{
+				return;
+			}
+
+			// The response depends on Accept-Encoding even if it is not compressed this time
+			AddHeader("Vary", "Accept-Encoding");
+
+			auto encoding = HttpCompressionCache::SelectEncoding(_accept_encoding);
+			if (encoding == ContentEncoding::Identity)
+			{
+				return;
+			}
+
+			std::shared_ptr<const ov::Data> payload;
+
+			if (_response_data_list.size() == 1)
+			{
+				payload = _response_data_list.front();
+			}
+			else
+			{
+				auto merged = std::make_shared<ov::Data>(_response_data_size);
+
+				for (const auto &data : _response_data_list)
+				{
+					merged->Append(data);
+				}
+
+				payload = merged;
+			}
+
+			auto compressed = HttpCompressionCache::GetInstance()->Compress(encoding, HttpCompressionCache::MakeContentKey(payload), payload);
+			if ((compressed == nullptr) || (compressed->GetLength() >= payload->GetLength()))
+			{
+				// Not worth it
+				return;
+			}
+
+			// ETag is still computed from the original payload (with the suffix of the encoding)
+			_response_data_list.clear();
+			_response_data_list.push_back(compressed);
+			_response_data_size = compressed->GetLength();
+			_content_encoding = encoding;
+
+			SetHeader("Content-Encoding", StringFromContentEncoding(encoding));
 		}
 
 		bool HttpResponse::AppendString(const ov::String &string)
@@ -231,8 +360,38 @@ namespace http
 
 		bool HttpResponse::AppendFile(const ov::String &filename)
 		{
-			OV_ASSERT(false, "Not implemented");
-			return false;
+			auto file = ov::ReadOnlyFile::Open(filename);
+			if (file == nullptr)
+			{
+				logte("Could not open file: %s (%s)", filename.CStr(), ov::Error::CreateErrorFromErrno()->What());
+				return false;
+			}
+
+			return AppendFile(file);
+		}
+
+		bool HttpResponse::AppendFile(const std::shared_ptr<const ov::ReadOnlyFile> &file)
+		{
+			if (file == nullptr)
+			{
+				return false;
+			}
+
+			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+
+			if (_response_file != nullptr)
+			{
+				logte("Only one file can be appended to the response: %s", file->GetPath().CStr());
+				return false;
+			}
+
+			_response_file = file;
+			_response_data_size += file->GetSize();
+
+			// The file is not read to compute the ETag, the path, size and modified time are used instead
+			UpdateResponseHash(ov::String::FormatString("%s:%zu:%lld", file->GetPath().CStr(), file->GetSize(), file->GetModifiedTime()).ToData(false));
+
+			return true;
 		}
 
 		bool HttpResponse::IsHeaderSent() const
@@ -258,9 +417,16 @@ namespace http
 			return _response_header;
 		}
 
+		// Get Response File
+		const std::shared_ptr<const ov::ReadOnlyFile> &HttpResponse::GetResponseFile() const
+		{
+			return _response_file;
+		}
+
 		void HttpResponse::ResetResponseData()
 		{
 			_response_data_list.clear();
+			_response_file.reset();
 			_response_data_size = 0ULL;
 		}
 
@@ -298,7 +464,10 @@ namespace http
 				// auto date = ov::Converter::ToRFC7231String(_response_time);
 				// SetHeader("Date", date);
 
-				if (_etag_enabled_by_config == true)
+				CompressPayloadIfNeeded();
+
+				// The payload of the streaming response is not known when the header is sent
+				if (_etag_enabled_by_config == true && _streaming == false)
 				{
 					// IF-NONE-MATCH check
 					auto if_none_match = GetIfNoneMatch();
@@ -369,6 +538,57 @@ namespace http
 			return Send(std::make_shared<ov::Data>(data, length));
 		}
 
+		bool HttpResponse::StartStreaming()
+		{
+			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+
+			if (IsHeaderSent() == true)
+			{
+				return false;
+			}
+
+			if (SetStreamingMode() == false)
+			{
+				return false;
+			}
+
+			_streaming = true;
+
+			return true;
+		}
+
+		bool HttpResponse::EndStreaming()
+		{
+			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+
+			if (_streaming == false)
+			{
+				return false;
+			}
+
+			if (IsHeaderSent() == false && Response() < 0)
+			{
+				return false;
+			}
+
+			return SendEndOfStream();
+		}
+
+		bool HttpResponse::IsStreaming() const
+		{
+			return _streaming;
+		}
+
+		bool HttpResponse::SetStreamingMode()
+		{
+			return false;
+		}
+
+		bool HttpResponse::SendEndOfStream()
+		{
+			return false;
+		}
+
 		bool HttpResponse::Send(const std::shared_ptr<const ov::Data> &data)
 		{
 			if (data == nullptr)
@@ -401,6 +621,143 @@ namespace http
 			return _client_socket->Send(send_data);
 		}
 
+		bool HttpResponse::SendFile(const std::shared_ptr<const ov::ReadOnlyFile> &file, off_t offset, size_t length)
+		{
+			if (file == nullptr)
+			{
+				OV_ASSERT2(file != nullptr);
+				return false;
+			}
+
+			if (_tls_data == nullptr)
+			{
+				// The file is sent from the page cache to the socket directly
+				return _client_socket->SendFile(file, offset, length);
+			}
+
+			// The file has to be encrypted, so it is read piece by piece instead of loading the whole file
+			return SendFileInPieces(file, offset, length);
+		}
+
+		bool HttpResponse::SendFileInPieces(const std::shared_ptr<const ov::ReadOnlyFile> &file, off_t offset, size_t length)
+		{
+			if (file == nullptr)
+			{
+				OV_ASSERT2(file != nullptr);
+				return false;
+			}
+
+			{
+				std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+
+				if (_sending_file != nullptr)
+				{
+					logte("Another file is being sent: %s", _sending_file->GetPath().CStr());
+					return false;
+				}
+
+				_sending_file = file;
+				_sending_file_offset = offset;
+				_sending_file_remaining = length;
+			}
+
+			ContinueSendingFile();
+
+			return true;
+		}
+
+		bool HttpResponse::SendFilePiece(const std::shared_ptr<const ov::Data> &data)
+		{
+			return Send(data);
+		}
+
+		void HttpResponse::ContinueSendingFile()
+		{
+			std::function<void(bool result)> handler;
+			bool result = true;
+
+			{
+				std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+
+				while (true)
+				{
+					if (_sending_file == nullptr)
+					{
+						return;
+					}
+
+					if (_sending_file_remaining == 0)
+					{
+						break;
+					}
+
+					if (_client_socket->GetPendingSendBytes() >= FILE_MAX_PENDING_BYTES)
+					{
+						auto self = GetSharedPtr();
+
+						if (_client_socket->SetSendDrainedCallback(FILE_MAX_PENDING_BYTES, [self]() { self->ContinueSendingFile(); }))
+						{
+							// Wait until the pieces queued in the socket are sent
+							return;
+						}
+
+						// Drained in the meantime
+					}
+
+					auto data = _sending_file->Read(_sending_file_offset, std::min(_sending_file_remaining, FILE_READ_CHUNK_SIZE));
+					if ((data == nullptr) || data->IsEmpty())
+					{
+						logte("Could not read file: %s (offset: %jd)", _sending_file->GetPath().CStr(), static_cast<intmax_t>(_sending_file_offset));
+						result = false;
+						break;
+					}
+
+					if (SendFilePiece(data) == false)
+					{
+						logte("Could not send file: %s (offset: %jd)", _sending_file->GetPath().CStr(), static_cast<intmax_t>(_sending_file_offset));
+						result = false;
+						break;
+					}
+
+					_sending_file_offset += data->GetLength();
+					_sending_file_remaining -= data->GetLength();
+				}
+
+				_sending_file.reset();
+				handler = std::move(_file_sent_handler);
+				_file_sent_handler = nullptr;
+			}
+
+			if (handler != nullptr)
+			{
+				handler(result);
+			}
+		}
+
+		bool HttpResponse::IsSendingFile()
+		{
+			std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+			return _sending_file != nullptr;
+		}
+
+		void HttpResponse::SetFileSentHandler(std::function<void(bool result)> handler)
+		{
+			{
+				std::lock_guard<decltype(_response_mutex)> lock(_response_mutex);
+
+				if (_sending_file != nullptr)
+				{
+					_file_sent_handler = std::move(handler);
+					return;
+				}
+			}
+
+			if (handler != nullptr)
+			{
+				handler(true);
+			}
+		}
+
 		bool HttpResponse::Close()
 		{
 			OV_ASSERT2(_client_socket != nullptr);
@@ -10,6 +10,7 @@
 
 #include <base/ovlibrary/converter.h>
 #include "../http_datastructure.h"
+#include "http_compression_cache.h"
 
 namespace http
 {
@@ -40,6 +41,9 @@ namespace http
 			void SetIfNoneMatch(const ov::String &etag);
 			const ov::String &GetIfNoneMatch() const;
 
+			// Accept-Encoding of the request, the response is compressed if the client supports it
+			void SetAcceptEncoding(const ov::String &accept_encoding);
+
 			// reason = default
 			void SetStatusCode(StatusCode status_code);
 			// custom reason
@@ -55,11 +59,26 @@ namespace http
 			// Enqueue the data into the queue (This data will be sent when SendResponse() is called)
 			// Can be used for response with content-length
 			bool AppendData(const std::shared_ptr<const ov::Data> &data);
+			// md5 is the digest of the whole list computed in advance (e.g. cached with the media segment),
+			// which is used for ETag instead of computing the digest of each data
+			bool AppendDataList(const std::vector<std::shared_ptr<const ov::Data>> &data_list, const std::shared_ptr<const ov::Data> &md5);
+			// Whether ETag is enabled, the digest of the data is needed only if it is enabled
+			bool IsEtagEnabled() const;
 			bool AppendString(const ov::String &string);
+			// The file is sent after the data appended by AppendData() without loading it into the memory
+			// (sendfile(2) for plain HTTP/1.1, pread() + Send() for HTTPS and HTTP/2)
 			bool AppendFile(const ov::String &filename);
+			bool AppendFile(const std::shared_ptr<const ov::ReadOnlyFile> &file);
 
 			int32_t Response();
 
+			// Streaming response, the length of the payload is not known in advance
+			// (Transfer-Encoding: chunked for HTTP/1.1, DATA frames without END_STREAM for HTTP/2)
+			// Response() can be called repeatedly to send the data appended since the last call, and EndStreaming() finishes the response.
+			bool StartStreaming();
+			bool EndStreaming();
+			bool IsStreaming() const;
+
 			// Get Created Time
 			std::chrono::system_clock::time_point GetCreatedTime() const;
 			// Get Response Time
@@ -73,11 +92,19 @@ namespace http
 
 			bool Close();
 
+			// Whether the pieces of the file are still being sent (see SendFileInPieces())
+			bool IsSendingFile();
+			// The handler is called once when the file has been sent (result is false if it could not be sent),
+			// it is called immediately if no file is being sent
+			void SetFileSentHandler(std::function<void(bool result)> handler);
+
 		protected:
 			bool IsHeaderSent() const;
 			
 			// Get Response Data List
 			const std::vector<std::shared_ptr<const ov::Data>> &GetResponseDataList() const;
+			// Get Response File (nullptr if there is no file)
+			const std::shared_ptr<const ov::ReadOnlyFile> &GetResponseFile() const;
 			// Get Response Header
 			const std::unordered_map<ov::String, std::vector<ov::String>, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> &GetResponseHeaderList() const;
 			void ResetResponseData();
@@ -90,12 +117,38 @@ namespace http
 			}
 			virtual bool Send(const void *data, size_t length);
 			virtual bool Send(const std::shared_ptr<const ov::Data> &data);
+			// Sends the range of the file as is (sendfile(2) if possible)
+			bool SendFile(const std::shared_ptr<const ov::ReadOnlyFile> &file, off_t offset, size_t length);
+
+			// Sends the range of the file piece by piece when sendfile(2) cannot be used (HTTPS, chunked transfer).
+			// The pieces are queued until the socket has FILE_MAX_PENDING_BYTES to send,
+			// and the rest is sent when the socket is drained, so this returns before the file is sent.
+			bool SendFileInPieces(const std::shared_ptr<const ov::ReadOnlyFile> &file, off_t offset, size_t length);
+			// Sends a piece read by SendFileInPieces()
+			virtual bool SendFilePiece(const std::shared_ptr<const ov::Data> &data);
+
+			// The size of the piece read from the file when sendfile(2) cannot be used
+			static constexpr size_t FILE_READ_CHUNK_SIZE = 64 * 1024;
+			// The maximum bytes of the pieces of the file waiting in the socket
+			static constexpr size_t FILE_MAX_PENDING_BYTES = 4 * FILE_READ_CHUNK_SIZE;
 			
 		private:
 			virtual int32_t SendHeader();
 			virtual int32_t SendPayload();
 
+			// Not supported by default
+			virtual bool SetStreamingMode();
+			virtual bool SendEndOfStream();
+
 			ov::String GetEtag();
+			void UpdateResponseHash(const std::shared_ptr<const ov::Data> &data);
+			void MergeResponseHash(const std::shared_ptr<const ov::Data> &md5);
+
+			// Replaces the payload with the compressed one (from HttpCompressionCache) if the response can be compressed
+			void CompressPayloadIfNeeded();
+
+			// Sends the pieces of the file until the socket has FILE_MAX_PENDING_BYTES to send
+			void ContinueSendingFile();
 
 			std::shared_ptr<ov::ClientSocket> _client_socket;
 			std::shared_ptr<ov::TlsServerData> _tls_data;
@@ -104,6 +157,7 @@ namespace http
 			ov::String _reason = StringFromStatusCode(StatusCode::OK);
 
 			bool _is_header_sent = false;
+			bool _streaming = false;
 			
 			// FIXME(dimiden): It is supposed to be synchronized whenever a packet is sent, but performance needs to be improved
 			std::recursive_mutex _response_mutex;
@@ -122,6 +176,7 @@ namespace http
 			// So _response_header is a map of case insentitive header key and value
 			std::unordered_map<ov::String, std::vector<ov::String>, ov::CaseInsensitiveHash, ov::CaseInsensitiveEqual> _response_header;
 			std::vector<std::shared_ptr<const ov::Data>> _response_data_list;
+			std::shared_ptr<const ov::ReadOnlyFile> _response_file;
 			size_t _response_data_size = 0;
 
 			std::vector<ov::String> _default_value{};
@@ -137,6 +192,18 @@ namespace http
 			bool _etag_enabled_by_config = false;
 			ov::String _if_none_match = "";
 			std::shared_ptr<ov::Data> _response_hash = nullptr;
+
+			bool _compression_enabled_by_config = false;
+			size_t _compression_min_size = 0;
+			ov::String _accept_encoding;
+			// Content-Encoding applied by CompressPayloadIfNeeded()
+			ContentEncoding _content_encoding = ContentEncoding::Identity;
+
+			// The file being sent by SendFileInPieces()
+			std::shared_ptr<const ov::ReadOnlyFile> _sending_file;
+			off_t _sending_file_offset = 0;
+			size_t _sending_file_remaining = 0;
+			std::function<void(bool result)> _file_sent_handler;
 		};
 	}  // namespace svr
 }  // namespace http
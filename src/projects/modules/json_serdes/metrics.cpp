@@ -95,4 +95,74 @@ namespace serdes
 
 		return value;
 	}
+
+	Json::Value JsonFromWorkerMetrics(const std::shared_ptr<const mon::WorkerMetrics> &metrics)
+	{
+		if (metrics == nullptr)
+		{
+			return Json::nullValue;
+		}
+
+		Json::Value value;
+
+		SetInt64(value, "id", metrics->GetId());
+		SetString(value, "type", metrics->GetTypeString(), Optional::False);
+		SetString(value, "name", metrics->GetName(), Optional::False);
+		SetInt64(value, "queueSize", metrics->GetQueueSize());
+		SetInt64(value, "executionCount", metrics->GetExecutionCount());
+		SetInt64(value, "cpuTime", metrics->GetCpuTimeUs());
+		SetInt64(value, "stealCount", metrics->GetStealCount());
+
+		return value;
+	}
+
+	static Json::Value JsonFromHistogram(const ov::SocketBatchStats::Histogram &histogram)
+	{
+		Json::Value value(Json::ValueType::objectValue);
+
+		for (size_t index = 0; index < histogram.size(); index++)
+		{
+			SetInt64(value, ov::SocketBatchStats::GetBucketLabel(index).CStr(), histogram[index]);
+		}
+
+		return value;
+	}
+
+	Json::Value JsonFromSocketBatchStats(const ov::SocketBatchStats *stats)
+	{
+		if (stats == nullptr)
+		{
+			return Json::nullValue;
+		}
+
+		Json::Value value;
+
+		SetInt64(value, "batchCount", stats->GetBatchCount());
+		SetInt64(value, "datagramCount", stats->GetDatagramCount());
+		value["batchSizes"] = JsonFromHistogram(stats->GetBatchHistogram());
+		SetInt64(value, "gsoCount", stats->GetGsoCount());
+		SetInt64(value, "gsoSegmentCount", stats->GetGsoSegmentCount());
+		value["gsoSegments"] = JsonFromHistogram(stats->GetGsoHistogram());
+		SetInt64(value, "gsoDisabledCount", stats->GetGsoDisabledCount());
+
+		return value;
+	}
+
+	Json::Value JsonFromSocketStreamBatchStats(const ov::SocketBatchStats *stats)
+	{
+		if (stats == nullptr)
+		{
+			return Json::nullValue;
+		}
+
+		Json::Value value;
+
+		SetInt64(value, "batchCount", stats->GetStreamBatchCount());
+		SetInt64(value, "commandCount", stats->GetStreamCommandCount());
+		SetInt64(value, "bufferCount", stats->GetStreamBufferCount());
+		value["batchSizes"] = JsonFromHistogram(stats->GetStreamBatchHistogram());
+		value["bufferSizes"] = JsonFromHistogram(stats->GetStreamBufferHistogram());
+
+		return value;
+	}
 }  // namespace serdes
\ No newline at end of file
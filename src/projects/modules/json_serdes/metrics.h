@@ -15,4 +15,7 @@ namespace serdes
 	Json::Value JsonFromMetrics(const std::shared_ptr<const mon::CommonMetrics> &metrics);
 	Json::Value JsonFromStreamMetrics(const std::shared_ptr<const mon::StreamMetrics> &metrics);
 	Json::Value JsonFromQueueMetrics(const std::shared_ptr<const mon::QueueMetrics> &metrics);
+	Json::Value JsonFromWorkerMetrics(const std::shared_ptr<const mon::WorkerMetrics> &metrics);
+	Json::Value JsonFromSocketBatchStats(const ov::SocketBatchStats *stats);
+	Json::Value JsonFromSocketStreamBatchStats(const ov::SocketBatchStats *stats);
 }  // namespace serdes
\ No newline at end of file
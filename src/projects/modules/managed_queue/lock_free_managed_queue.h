@@ -0,0 +1,671 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Keukhan Kwon
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+
+#pragma once
+
+#include <deque>
+
+#include "managed_queue.h"
+
+// The number of cells of the ring buffer. Must be a power of 2
+#define LOCK_FREE_MANAGED_QUEUE_DEFAULT_CAPACITY 1024
+// The number of cells of the ring buffer for urgent messages. Must be a power of 2
+#define LOCK_FREE_MANAGED_QUEUE_URGENT_CAPACITY 64
+// The enqueued time is recorded for one of N messages to calculate the waiting time
+#define LOCK_FREE_MANAGED_QUEUE_TIME_SAMPLING_INTERVAL 16
+// Metrics are updated once every N operations
+#define LOCK_FREE_MANAGED_QUEUE_METRICS_UPDATE_OPERATIONS 32
+
+namespace ov
+{
+	enum class LockFreeQueueProducer : uint8_t
+	{
+		// Only one thread enqueues (SPSC), the position of the producer is updated without CAS
+		Single,
+		// Any thread can enqueue (MPSC)
+		Multiple
+	};
+
+	// Bounded ring buffer which is safe for multiple producers and multiple consumers without locks.
+	// Each cell has a sequence number that tells whether the cell is ready to be written or read (D. Vyukov's bounded MPMC queue).
+	template <typename T>
+	class LockFreeRing
+	{
+	public:
+		using TimePoint = std::chrono::steady_clock::time_point;
+
+		LockFreeRing(size_t capacity, LockFreeQueueProducer producer)
+			: _single_producer(producer == LockFreeQueueProducer::Single),
+			  _mask(capacity - 1),
+			  _cells(new Cell[capacity])
+		{
+			OV_ASSERT(((capacity > 0) && ((capacity & (capacity - 1)) == 0)), "Capacity must be a power of 2: %zu", capacity);
+
+			for (size_t index = 0; index < capacity; index++)
+			{
+				_cells[index].sequence.store(index, std::memory_order_relaxed);
+			}
+		}
+
+		size_t GetCapacity() const
+		{
+			return _mask + 1;
+		}
+
+		// Returns false if the ring is full
+		template <typename U>
+		bool Push(U &&value, const TimePoint &enqueued_time)
+		{
+			Cell *cell = nullptr;
+			auto position = _enqueue_position.load(std::memory_order_relaxed);
+
+			if (_single_producer)
+			{
+				cell = &_cells[position & _mask];
+
+				if (cell->sequence.load(std::memory_order_acquire) != position)
+				{
+					// Full
+					return false;
+				}
+
+				_enqueue_position.store(position + 1, std::memory_order_relaxed);
+			}
+			else
+			{
+				while (true)
+				{
+					cell = &_cells[position & _mask];
+
+					auto sequence = cell->sequence.load(std::memory_order_acquire);
+					auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+					if (diff == 0)
+					{
+						if (_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+						{
+							break;
+						}
+					}
+					else if (diff < 0)
+					{
+						// Full
+						return false;
+					}
+					else
+					{
+						// Another producer took this cell
+						position = _enqueue_position.load(std::memory_order_relaxed);
+					}
+				}
+			}
+
+			cell->data = std::forward<U>(value);
+			cell->enqueued_time = enqueued_time;
+			cell->sequence.store(position + 1, std::memory_order_release);
+
+			return true;
+		}
+
+		// Returns false if the ring is empty
+		bool Pop(T &value, TimePoint *enqueued_time)
+		{
+			Cell *cell = nullptr;
+			auto position = _dequeue_position.load(std::memory_order_relaxed);
+
+			while (true)
+			{
+				cell = &_cells[position & _mask];
+
+				auto sequence = cell->sequence.load(std::memory_order_acquire);
+				auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+				if (diff == 0)
+				{
+					if (_dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (diff < 0)
+				{
+					// Empty
+					return false;
+				}
+				else
+				{
+					position = _dequeue_position.load(std::memory_order_relaxed);
+				}
+			}
+
+			value = std::move(cell->data);
+			// Release the reference kept in the cell
+			cell->data = T();
+
+			if (enqueued_time != nullptr)
+			{
+				*enqueued_time = cell->enqueued_time;
+			}
+
+			cell->sequence.store(position + _mask + 1, std::memory_order_release);
+
+			return true;
+		}
+
+	private:
+		struct Cell
+		{
+			std::atomic<size_t> sequence;
+			T data;
+			TimePoint enqueued_time;
+		};
+
+		// Producers and consumers are placed on different cache lines
+		alignas(64) std::atomic<size_t> _enqueue_position{0};
+		alignas(64) std::atomic<size_t> _dequeue_position{0};
+
+		bool _single_producer;
+		size_t _mask;
+		std::unique_ptr<Cell[]> _cells;
+	};
+
+	// Lock-free version of ov::ManagedQueue for media hot paths
+	//
+	// - A single consumer, with a single producer (SPSC) or multiple producers (MPSC) selected per queue.
+	//   Enqueue() doesn't take any lock unless exceed-and-wait is enabled or the ring is full.
+	// - Like ov::ManagedQueue, messages are not dropped when the queue grows: If the ring is full, the messages are
+	//   kept in an overflow list (with a lock) until the consumer catches up.
+	// - Urgent messages are stored in a separate ring and dequeued before the normal messages.
+	// - Front()/Back() and buffering delay are not supported. Use ov::ManagedQueue for those.
+	// - The mutex is used only to sleep/wake up the consumer waiting for a message (and the producers waiting for space).
+	template <typename T>
+	class LockFreeManagedQueue : public info::ManagedQueue
+	{
+	private:
+		const char *LOG_TAG = "ManagedQueue";
+
+		using Ring = LockFreeRing<T>;
+		using TimePoint = typename Ring::TimePoint;
+
+	public:
+		LockFreeManagedQueue()
+			: LockFreeManagedQueue(nullptr) {}
+
+		LockFreeManagedQueue(std::shared_ptr<info::ManagedQueue::URN> urn, size_t threshold = 0, int log_interval_in_msec = MANAGED_QUEUE_LOG_INTERVAL_IN_MSEC,
+							 LockFreeQueueProducer producer = LockFreeQueueProducer::Multiple, size_t capacity = LOCK_FREE_MANAGED_QUEUE_DEFAULT_CAPACITY)
+			: info::ManagedQueue(threshold),
+			  _stats_metric_interval(MANAGED_QUEUE_METRICS_UPDATE_INTERVAL_IN_MSEC),
+			  _log_interval(log_interval_in_msec),
+			  _ring(GetRingCapacity(threshold, capacity), producer),
+			  _urgent_ring(LOCK_FREE_MANAGED_QUEUE_URGENT_CAPACITY, producer)
+		{
+			info::ManagedQueue::SetUrn(urn, Demangle(typeid(T).name()).CStr());
+
+			// Register to the server metrics
+			// If the Unique id is duplicated or memory allocation failed, retry
+			while (true)
+			{
+				SetId(IssueUniqueQueueId());
+
+				if (MonitorInstance->GetServerMetrics()->OnQueueCreated(*this) == true)
+				{
+					break;
+				}
+			}
+		}
+
+		~LockFreeManagedQueue()
+		{
+			Clear();
+
+			// Unregister to the server metrics
+			MonitorInstance->GetServerMetrics()->OnQueueDeleted(*this);
+		}
+
+		void SetUrn(std::shared_ptr<info::ManagedQueue::URN> urn)
+		{
+			info::ManagedQueue::SetUrn(urn, Demangle(typeid(T).name()).CStr());
+
+			MonitorInstance->GetServerMetrics()->OnQueueUpdated(*this, true);
+		}
+
+		// Urgent item will be dequeued before the other items
+		void Enqueue(const T &item, bool urgent = false, int timeout = Infinite)
+		{
+			EnqueueInternal(item, urgent, timeout);
+		}
+
+		// Urgent item will be dequeued before the other items
+		void Enqueue(T &&item, bool urgent = false, int timeout = Infinite)
+		{
+			EnqueueInternal(std::move(item), urgent, timeout);
+		}
+
+		std::optional<T> Dequeue(int timeout = Infinite)
+		{
+			if (_stop)
+			{
+				return {};	// Stop is requested
+			}
+
+			T value;
+			TimePoint enqueued_time;
+
+			if (Pop(value, &enqueued_time) == false)
+			{
+				if ((timeout == 0) || (WaitForItem(timeout, value, &enqueued_time) == false))
+				{
+					return {};	// timed out / Stop is requested
+				}
+			}
+
+			_count.fetch_sub(1);
+
+			// Update statistics of output message count
+			_output_count++;
+
+			// Update statistics of waiting time (microseconds)
+			if (enqueued_time != TimePoint::min())
+			{
+				auto current = std::chrono::steady_clock::now();
+				_waiting_time_in_us = _waiting_time_in_us * 0.9 + std::chrono::duration_cast<std::chrono::microseconds>(current - enqueued_time).count() * 0.1;
+			}
+
+			UpdateMetricsIfNeeded();
+
+			if (_exceed_threshold_and_wait_enabled)
+			{
+				Notify(_producer_waiting_count, _space_condition);
+			}
+
+			return value;
+		}
+
+		bool IsEmpty() const
+		{
+			return (_count == 0);
+		}
+
+		// Cleared all items in the queue
+		void Clear()
+		{
+			T value;
+
+			while (Pop(value, nullptr))
+			{
+				_count.fetch_sub(1);
+			}
+
+			ClearMetrics();
+		}
+
+		size_t Size() const
+		{
+			return _count;
+		}
+
+		// Hides info::ManagedQueue::GetSize() which is updated only when the metrics are updated
+		size_t GetSize() const
+		{
+			return _count;
+		}
+
+		bool IsThresholdExceeded() const
+		{
+			return _count > _threshold;
+		}
+
+		void Stop()
+		{
+			_stop = true;
+
+			ClearMetrics();
+
+			std::lock_guard lock_guard(_mutex);
+			_condition.notify_all();
+			_space_condition.notify_all();
+		}
+
+		bool IsStopped() const
+		{
+			return _stop;
+		}
+
+		// Skip message for performance failure recovery (Deactivated as it is no longer used, same as ov::ManagedQueue)
+		void SetSkipMessageEnable(bool enable)
+		{
+			_skip_message_enabled = enable;
+		}
+
+		void SetExceedWaitEnable(bool enable)
+		{
+			_exceed_threshold_and_wait_enabled = enable;
+		}
+
+		bool IsExceedWaitEnable()
+		{
+			return _exceed_threshold_and_wait_enabled;
+		}
+
+	private:
+		template <typename U>
+		void EnqueueInternal(U &&item, bool urgent, int timeout)
+		{
+			// Update statistics of input message count
+			auto input_count = _input_count++;
+
+#if SKIP_MESSAGE_ENABLED
+			if ((_skip_message_enabled == true) && (IsThresholdExceeded() == true))
+			{
+				_drop_count++;
+				return;
+			}
+#endif	// SKIP_MESSAGE_ENABLED
+
+			// Wait until the queue size is less than threshold
+			if (_exceed_threshold_and_wait_enabled == true)
+			{
+				if (WaitForSpace(timeout) == false)
+				{
+					loge(LOG_TAG, "[%s] queue is full. q.size(%zu), q.threshold(%zu)", ToString().CStr(), Size(), _threshold);
+					_drop_count++;
+					return;
+				}
+			}
+
+			// Calling now() for each message is expensive, so the enqueued time is sampled
+			auto enqueued_time = ((input_count % LOCK_FREE_MANAGED_QUEUE_TIME_SAMPLING_INTERVAL) == 0) ? std::chrono::steady_clock::now() : TimePoint::min();
+
+			// The count is increased before the item becomes visible to the consumer,
+			// otherwise the consumer may decrease it first and it wraps around
+			_count.fetch_add(1);
+
+			// If the urgent ring is full, the item is pushed to the normal ring.
+			// While the overflow list has items, new items are appended to it to keep the order.
+			bool pushed = urgent && _urgent_ring.Push(std::forward<U>(item), enqueued_time);
+
+			if ((pushed == false) && (_overflow_count == 0))
+			{
+				pushed = _ring.Push(std::forward<U>(item), enqueued_time);
+			}
+
+			if (pushed == false)
+			{
+				PushOverflow(std::forward<U>(item), enqueued_time);
+			}
+
+			Notify(_consumer_waiting_count, _condition);
+
+			UpdateMetricsIfNeeded();
+		}
+
+		static size_t GetRingCapacity(size_t threshold, size_t capacity)
+		{
+			// Keep enough room above the threshold so that the overflow list is rarely used
+			while (capacity < threshold * 2)
+			{
+				capacity <<= 1;
+			}
+
+			return capacity;
+		}
+
+		template <typename U>
+		void PushOverflow(U &&item, const TimePoint &enqueued_time)
+		{
+			std::lock_guard lock_guard(_overflow_mutex);
+
+			_overflow_list.emplace_back(std::forward<U>(item), enqueued_time);
+			_overflow_count++;
+
+			if (_full_log_timer.IsElapsed(_log_interval) && _full_log_timer.Update())
+			{
+				logw(LOG_TAG, "[%u] %s is full. The messages are kept in the overflow list. capacity: %zu, overflow: %zu", GetId(), ToString().CStr(), _ring.GetCapacity(), _overflow_list.size());
+			}
+		}
+
+		bool PopOverflow(T &value, TimePoint *enqueued_time)
+		{
+			if (_overflow_count == 0)
+			{
+				return false;
+			}
+
+			std::lock_guard lock_guard(_overflow_mutex);
+
+			if (_overflow_list.empty())
+			{
+				return false;
+			}
+
+			auto &front = _overflow_list.front();
+
+			value = std::move(front.first);
+
+			if (enqueued_time != nullptr)
+			{
+				*enqueued_time = front.second;
+			}
+
+			_overflow_list.pop_front();
+			_overflow_count--;
+
+			return true;
+		}
+
+		// The items in the ring were enqueued before the items in the overflow list
+		bool Pop(T &value, TimePoint *enqueued_time)
+		{
+			return _urgent_ring.Pop(value, enqueued_time) || _ring.Pop(value, enqueued_time) || PopOverflow(value, enqueued_time);
+		}
+
+		// Wakes up the threads waiting for the condition only if there is a waiting thread
+		void Notify(const std::atomic<int> &waiting_count, std::condition_variable &condition)
+		{
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			if (waiting_count > 0)
+			{
+				std::lock_guard lock_guard(_mutex);
+				condition.notify_all();
+			}
+		}
+
+		bool WaitForItem(int timeout, T &value, TimePoint *enqueued_time)
+		{
+			auto expire = (timeout == Infinite) ? std::chrono::system_clock::time_point::max() : std::chrono::system_clock::now() + std::chrono::milliseconds(timeout);
+
+			std::unique_lock unique_lock(_mutex);
+
+			_consumer_waiting_count++;
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			bool popped = false;
+
+			while (_stop == false)
+			{
+				// Check again after announcing the waiting, to avoid missing the notification
+				if (Pop(value, enqueued_time))
+				{
+					popped = true;
+					break;
+				}
+
+				if (_condition.wait_until(unique_lock, expire) == std::cv_status::timeout)
+				{
+					popped = (_stop == false) && Pop(value, enqueued_time);
+					break;
+				}
+			}
+
+			_consumer_waiting_count--;
+
+			return popped;
+		}
+
+		bool WaitForSpace(int timeout)
+		{
+			if (_count < _threshold)
+			{
+				return true;
+			}
+
+			auto expire = (timeout == Infinite) ? std::chrono::system_clock::time_point::max() : std::chrono::system_clock::now() + std::chrono::milliseconds(timeout);
+
+			std::unique_lock unique_lock(_mutex);
+
+			_producer_waiting_count++;
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			auto result = _space_condition.wait_until(unique_lock, expire, [this]() -> bool {
+				return (_count < _threshold) || _stop;
+			});
+
+			_producer_waiting_count--;
+
+			return result && (_stop == false);
+		}
+
+		void UpdateMetricsIfNeeded()
+		{
+			if (((++_operation_count % LOCK_FREE_MANAGED_QUEUE_METRICS_UPDATE_OPERATIONS) != 0) && (_count > 1))
+			{
+				return;
+			}
+
+			// Metrics are updated by only one thread at a time
+			std::unique_lock lock(_metrics_mutex, std::try_to_lock);
+
+			if (lock.owns_lock())
+			{
+				UpdateMetrics();
+			}
+		}
+
+		// Update statistical metrics and send data to monitoring module.
+		void UpdateMetrics()
+		{
+			_size = _count;
+			_input_message_count = _input_count;
+			_output_message_count = _output_count;
+			_drop_message_count = _drop_count;
+
+			// Update the peak statistics
+			if (_peak < _size)
+			{
+				_peak = _size;
+			}
+
+			if (_timer.IsStart() == false)
+			{
+				_timer.Start();
+			}
+
+			if (_timer.IsElapsed(_stats_metric_interval))
+			{
+				int elapsed_time = _timer.Elapsed();
+				_timer.Update();
+
+				// Update statistics of message per second
+				_input_message_per_second = (double)(_input_message_count - _last_input_message_count) * (1000.0 / (double)elapsed_time);
+				_output_message_per_second = (double)(_output_message_count - _last_output_message_count) * (1000.0 / (double)elapsed_time);
+				_last_input_message_count = _input_message_count;
+				_last_output_message_count = _output_message_count;
+
+				if ((_threshold > 0) && (_size >= _threshold))
+				{
+					_threshold_exceeded_time_in_us += _stats_metric_interval;
+
+					// Logging
+					_last_logging_time += _stats_metric_interval;
+					if ((_last_logging_time >= _log_interval) && (_last_logged_peak < _peak))
+					{
+						_last_logging_time = 0;
+
+						auto shared_lock = std::shared_lock(_name_mutex);
+						logw(LOG_TAG, "[%u] %s has exceeded the threshold and increased peak. size: %zu, threshold: %zu, peak: %zu", GetId(), ToString().CStr(), _size, _threshold, _peak);
+
+						_last_logged_peak = _peak;
+					}
+				}
+				else
+				{
+					_threshold_exceeded_time_in_us = 0;
+				}
+
+				MonitorInstance->GetServerMetrics()->OnQueueUpdated(*this);
+			}
+		}
+
+		void ClearMetrics()
+		{
+			std::lock_guard lock(_metrics_mutex);
+
+			_peak = 0;
+			_size = _count;
+			_input_message_per_second = 0;
+			_output_message_per_second = 0;
+			_input_count = 0;
+			_output_count = 0;
+			_input_message_count = 0;
+			_output_message_count = 0;
+			_last_input_message_count = 0;
+			_last_output_message_count = 0;
+			_threshold_exceeded_time_in_us = 0;
+
+			MonitorInstance->GetServerMetrics()->OnQueueUpdated(*this);
+		}
+
+	private:
+		StopWatch _timer;
+		StopWatch _full_log_timer;
+
+		int _stats_metric_interval = 0;
+
+		int _log_interval = 0;
+		int64_t _last_logging_time = 0;
+
+		// Use to print logs when the peak value of the queue is increased.
+		size_t _last_logged_peak = 0;
+
+		Ring _ring;
+		Ring _urgent_ring;
+
+		// Used only when the ring is full
+		std::mutex _overflow_mutex;
+		std::deque<std::pair<T, TimePoint>> _overflow_list;
+		std::atomic<size_t> _overflow_count{0};
+
+		std::atomic<size_t> _count{0};
+
+		// Counters updated by producers/consumer. They are copied to the fields of info::ManagedQueue when the metrics are updated
+		std::atomic<int64_t> _input_count{0};
+		std::atomic<int64_t> _output_count{0};
+		std::atomic<uint64_t> _drop_count{0};
+		std::atomic<uint32_t> _operation_count{0};
+		std::mutex _metrics_mutex;
+
+		// Used only to sleep when there is nothing to do
+		std::mutex _mutex;
+		// For the consumer waiting for an item
+		std::condition_variable _condition;
+		std::atomic<int> _consumer_waiting_count{0};
+		// For the producers waiting for the queue to fall below the threshold
+		std::condition_variable _space_condition;
+		std::atomic<int> _producer_waiting_count{0};
+
+		std::atomic<bool> _stop{false};
+
+		bool _skip_message_enabled = false;
+
+		// Prevent exceed threshold. If true, the queue will not exceed the threshold
+		// Wait until the queue falls below the threshold
+		std::atomic<bool> _exceed_threshold_and_wait_enabled{false};
+	};
+}  // namespace ov
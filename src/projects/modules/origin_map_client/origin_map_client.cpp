@@ -24,28 +24,75 @@ OriginMapClient::OriginMapClient(const ov::String &redis_host, const ov::String
 	_redis_port = ov::Converter::ToUInt16(ip_port[1]);
 	_redis_password = redis_password;
 
+	_redis_client = std::make_shared<RedisAsyncClient>(_redis_ip, _redis_port, _redis_password);
+	if (_redis_client->Start() == false)
+	{
+		logte("Failed to start redis client : %s:%d", _redis_ip.CStr(), _redis_port);
+	}
+
 	_update_timer.Push(
 		[this](void *paramter) -> ov::DelayQueueAction {
 			RetryRegister();
 			NofifyStreamsAlive();
+			RemoveExpiredCache();
 			return ov::DelayQueueAction::Repeat;
 		},
 		2500);
 	_update_timer.Start();
 }
 
+OriginMapClient::~OriginMapClient()
+{
+	_update_timer.Stop();
+
+	if (_redis_client != nullptr)
+	{
+		_redis_client->Stop();
+	}
+}
+
+RedisReply OriginMapClient::WaitForReply(const std::shared_future<RedisReply> &future)
+{
+	if (future.wait_for(std::chrono::milliseconds(ORIGIN_MAP_REDIS_TIMEOUT_MSEC)) != std::future_status::ready)
+	{
+		logte("Timed out waiting for a reply from redis : %s:%d", _redis_ip.CStr(), _redis_port);
+		return RedisReply();
+	}
+
+	return future.get();
+}
+
 bool OriginMapClient::NofifyStreamsAlive()
 {
+	if (_redis_client == nullptr)
+	{
+		return false;
+	}
+
 	std::unique_lock<std::mutex> lock(_origin_map_mutex);
 	auto origin_map = _origin_map;
 	lock.unlock();
 
+	// All streams are updated with a single round trip (pipelined)
+	// XX option or EXPIRE cmd are not used because if redis server is restarted, update() can restore the origin stream info.
+	std::vector<std::pair<ov::String, std::shared_future<RedisReply>>> futures;
 	for (auto &[key, value] : origin_map)
 	{
-		Update(key, value);
+		futures.emplace_back(key, _redis_client->Command({"SET", key, value, "EX", ov::Converter::ToString(ORIGIN_MAP_STORE_KEY_EXPIRE_TIME)}));
 	}
 
-	return true;
+	bool result = true;
+	for (auto &[key, future] : futures)
+	{
+		auto reply = WaitForReply(future);
+		if (reply.IsError())
+		{
+			logte("Failed to set origin host of <%s> to redis : %s:%d (err:%s)", key.CStr(), _redis_ip.CStr(), _redis_port, reply.str.CStr());
+			result = false;
+		}
+	}
+
+	return result;
 }
 
 bool OriginMapClient::RetryRegister()
@@ -82,38 +129,33 @@ bool OriginMapClient::RetryRegister()
 
 bool OriginMapClient::Register(const ov::String &app_stream_name, const ov::String &origin_host)
 {
-	if (ConnectRedis() == false)
+	if (_redis_client == nullptr)
 	{
-		logte("Failed to connect redis server : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, _redis_context!=nullptr?_redis_context->errstr:"nil");
 		return false;
 	}
 
-	std::unique_lock<std::mutex> lock(_redis_context_mutex);
-
 	bool is_already_registered = false;
 
 	// Check if the app/stream is already registered with same origin host
-	redisReply *reply = (redisReply *)redisCommand(_redis_context, "GET %s", app_stream_name.CStr());
-	if (reply == nullptr || reply->type == REDIS_REPLY_ERROR)
+	auto reply = WaitForReply(_redis_client->Command({"GET", app_stream_name}));
+	if (reply.IsError())
 	{
-		logte("Failed to get origin host from redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply!=nullptr?reply->str:"nil");
+		logte("Failed to get origin host from redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply.str.CStr());
 		return false;
 	}
-	else if (reply->type == REDIS_REPLY_NIL)
+	else if (reply.type == RedisReply::Type::Nil)
 	{
 		// Not exist, keep going
 	}
-	else if (reply->type == REDIS_REPLY_STRING)
+	else if (reply.type == RedisReply::Type::String)
 	{
-		if (origin_host == reply->str)
+		if (origin_host == reply.str)
 		{
 			is_already_registered = true;
 		}
 		else
 		{
-			logte("<%s> stream is already registered with different origin host (%s)", app_stream_name.CStr(), reply->str);
-			freeReplyObject(reply);
-			lock.unlock();
+			logte("<%s> stream is already registered with different origin host (%s)", app_stream_name.CStr(), reply.str.CStr());
 
 			std::lock_guard<std::mutex> origin_map_lock(_origin_map_mutex);
 			_origin_map_candidates[app_stream_name] = origin_host;
@@ -121,34 +163,29 @@ bool OriginMapClient::Register(const ov::String &app_stream_name, const ov::Stri
 			return false;
 		}
 	}
-	freeReplyObject(reply);
 
 	if (is_already_registered == false)
 	{
 		// Set origin host to redis
 		// The EXPIRE option is to prevent locking the app/stream when OvenMediaEngine unexpectedly stops.
 		// So _update_timer updates the expire time once every 2.5 seconds.
-		redisReply *reply = (redisReply *)redisCommand(_redis_context, "SET %s %s EX %d NX", app_stream_name.CStr(), origin_host.CStr(), ORIGIN_MAP_STORE_KEY_EXPIRE_TIME);
-		if (reply == nullptr || reply->type == REDIS_REPLY_ERROR)
+		auto reply = WaitForReply(_redis_client->Command({"SET", app_stream_name, origin_host, "EX", ov::Converter::ToString(ORIGIN_MAP_STORE_KEY_EXPIRE_TIME), "NX"}));
+		if (reply.IsError())
 		{
-			logte("Failed to set origin host to redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply!=nullptr?reply->str:"nil");
+			logte("Failed to set origin host to redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply.str.CStr());
 			return false;
 		}
-		else if (reply->type == REDIS_REPLY_NIL)
+		else if (reply.type == RedisReply::Type::Nil)
 		{
 			logte("<%s> stream is already registered.", app_stream_name.CStr());
-			freeReplyObject(reply);
-			lock.unlock();
 
 			std::lock_guard<std::mutex> origin_map_lock(_origin_map_mutex);
 			_origin_map_candidates[app_stream_name] = origin_host;
 			return false;
 		}
-
-		freeReplyObject(reply);
 	}
 
-	lock.unlock();
+	InvalidateCache(app_stream_name);
 
 	std::lock_guard<std::mutex> origin_map_lock(_origin_map_mutex);
 	_origin_map[app_stream_name] = origin_host;
@@ -160,47 +197,43 @@ bool OriginMapClient::Register(const ov::String &app_stream_name, const ov::Stri
 
 bool OriginMapClient::Update(const ov::String &app_stream_name, const ov::String &origin_host)
 {
-	if (ConnectRedis() == false)
+	if (_redis_client == nullptr)
 	{
-		logte("Failed to connect redis server : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, _redis_context!=nullptr?_redis_context->errstr:"nil");
 		return false;
 	}
 
-	std::lock_guard<std::mutex> lock(_redis_context_mutex);
-
 	// Set origin host to redis
 	// XX option or EXPIRE cmd are not used because if redis server is restarted, update() can restore the origin stream info.
-	redisReply *reply = (redisReply *)redisCommand(_redis_context, "SET %s %s EX %d", app_stream_name.CStr(), origin_host.CStr(), ORIGIN_MAP_STORE_KEY_EXPIRE_TIME);
-	if (reply == nullptr || reply->type == REDIS_REPLY_ERROR)
+	auto reply = WaitForReply(_redis_client->Command({"SET", app_stream_name, origin_host, "EX", ov::Converter::ToString(ORIGIN_MAP_STORE_KEY_EXPIRE_TIME)}));
+	if (reply.IsError())
 	{
-		logte("Failed to set origin host to redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply!=nullptr?reply->str:"nil");
+		logte("Failed to set origin host to redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply.str.CStr());
 		return false;
 	}
-	else if (reply->type == REDIS_REPLY_NIL)
+	else if (reply.type == RedisReply::Type::Nil)
 	{
 		// Not exist
 		return false;
 	}
 
-	freeReplyObject(reply);
-
 	return true;
 }
 
 bool OriginMapClient::Unregister(const ov::String &app_stream_name)
 {
-	if (ConnectRedis() == false)
+	if (_redis_client == nullptr)
 	{
-		logte("Failed to connect redis server : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, _redis_context!=nullptr?_redis_context->errstr:"nil");
 		return false;
 	}
 
-	std::unique_lock<std::mutex> lock(_redis_context_mutex);
-
-	redisReply *reply = (redisReply *)redisCommand(_redis_context, "DEL %s", app_stream_name.CStr());
-	freeReplyObject(reply);
+	auto reply = WaitForReply(_redis_client->Command({"DEL", app_stream_name}));
+	if (reply.IsError())
+	{
+		logte("Failed to delete origin host from redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply.str.CStr());
+		return false;
+	}
 
-	lock.unlock();
+	InvalidateCache(app_stream_name);
 
 	std::lock_guard<std::mutex> origin_map_lock(_origin_map_mutex);
 	_origin_map.erase(app_stream_name);
@@ -212,87 +245,113 @@ bool OriginMapClient::Unregister(const ov::String &app_stream_name)
 
 CommonErrorCode OriginMapClient::GetOrigin(const ov::String &app_stream_name, ov::String &origin_host)
 {
-	if (ConnectRedis() == false)
+	if (_redis_client == nullptr)
 	{
-		logte("Failed to connect redis server : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, _redis_context!=nullptr?_redis_context->errstr:"nil");
 		return CommonErrorCode::ERROR;
 	}
 
-	std::lock_guard<std::mutex> lock(_redis_context_mutex);
+	std::promise<LookupResult> promise;
+	std::shared_future<LookupResult> lookup_future;
+	uint64_t lookup_id = 0;
 
-	redisReply *reply = (redisReply *)redisCommand(_redis_context, "GET %s", app_stream_name.CStr());
-	if (reply == nullptr || reply->type == REDIS_REPLY_ERROR)
-	{
-		logte("Failed to get origin host from redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply!=nullptr?reply->str:"nil");
-		return CommonErrorCode::ERROR;
-	}
-	else if (reply->type == REDIS_REPLY_NIL)
 	{
-		return CommonErrorCode::NOT_FOUND;
-	}
-
-	origin_host = reply->str;
-	freeReplyObject(reply);
-
-	return CommonErrorCode::SUCCESS;
-}
+		std::unique_lock<std::mutex> lock(_origin_cache_mutex);
 
-bool OriginMapClient::ConnectRedis()
-{
-	std::lock_guard<std::mutex> lock(_redis_context_mutex);
+		auto cache_item = _origin_cache.find(app_stream_name);
+		if (cache_item != _origin_cache.end())
+		{
+			if (static_cast<int64_t>(ov::Clock::NowMSec()) < cache_item->second.expire_time_msec)
+			{
+				origin_host = cache_item->second.result.second;
+				return cache_item->second.result.first;
+			}
 
-	if (CheckConnection() == true)
-	{
-		return true;
-	}
+			_origin_cache.erase(cache_item);
+		}
 
-	// connect to redis server
-	_redis_context = redisConnect(_redis_ip.CStr(), _redis_port);
-	if (_redis_context == nullptr || _redis_context->err)
-	{
-		if (_redis_context == nullptr)
+		auto inflight_item = _inflight_lookups.find(app_stream_name);
+		if (inflight_item != _inflight_lookups.end())
 		{
-			redisFree(_redis_context);
-			_redis_context = nullptr;
+			// Another thread is querying the same stream
+			lookup_future = inflight_item->second.future;
+			lock.unlock();
+
+			auto result = lookup_future.get();
+			origin_host = result.second;
+			return result.first;
 		}
 
-		logte("Failed to connect to redis server. ip: %s, port: %d, err: %s", _redis_ip.CStr(), _redis_port, _redis_context->errstr);
-		return false;
+		lookup_future = promise.get_future().share();
+		lookup_id = ++_last_lookup_id;
+		_inflight_lookups[app_stream_name] = {lookup_id, lookup_future};
 	}
 
-	// Auth
-	if (_redis_password.IsEmpty() == false)
+	auto result = LookupOrigin(app_stream_name);
+	promise.set_value(result);
+
 	{
-		redisReply *reply = (redisReply *)redisCommand(_redis_context, "AUTH %s", _redis_password.CStr());
-		if (reply == nullptr || reply->type == REDIS_REPLY_ERROR)
+		std::lock_guard<std::mutex> lock(_origin_cache_mutex);
+
+		auto inflight_item = _inflight_lookups.find(app_stream_name);
+
+		// If the stream is registered/unregistered during the lookup, the result may be stale, so it is not cached
+		if ((inflight_item != _inflight_lookups.end()) && (inflight_item->second.id == lookup_id))
 		{
-			logte("Failed to auth to redis server. ip: %s, port: %d, err: %s", _redis_ip.CStr(), _redis_port, reply!=nullptr?reply->str:"nil");
+			_inflight_lookups.erase(inflight_item);
 
-			if (reply != nullptr)
+			// Errors are not cached so that the next lookup queries redis again
+			if (result.first != CommonErrorCode::ERROR)
 			{
-				freeReplyObject(reply);
+				auto ttl = (result.first == CommonErrorCode::SUCCESS) ? ORIGIN_MAP_CACHE_TTL_MSEC : ORIGIN_MAP_NEGATIVE_CACHE_TTL_MSEC;
+				_origin_cache[app_stream_name] = {result, static_cast<int64_t>(ov::Clock::NowMSec()) + ttl};
 			}
-			
-			return false;
 		}
 	}
 
-	return true;
+	origin_host = result.second;
+	return result.first;
 }
 
-bool OriginMapClient::CheckConnection()
+OriginMapClient::LookupResult OriginMapClient::LookupOrigin(const ov::String &app_stream_name)
 {
-	if (_redis_context == nullptr)
+	auto reply = WaitForReply(_redis_client->Command({"GET", app_stream_name}));
+	if (reply.IsError())
 	{
-		return false;
+		logte("Failed to get origin host from redis : %s:%d (err:%s)", _redis_ip.CStr(), _redis_port, reply.str.CStr());
+		return {CommonErrorCode::ERROR, ""};
 	}
-
-	// Test with PING command
-	redisReply *reply = (redisReply *)redisCommand(_redis_context, "PING");
-	if (reply == nullptr)
+	else if (reply.type == RedisReply::Type::Nil)
 	{
-		return false;
+		return {CommonErrorCode::NOT_FOUND, ""};
 	}
 
-	return true;
+	return {CommonErrorCode::SUCCESS, reply.str};
+}
+
+void OriginMapClient::InvalidateCache(const ov::String &app_stream_name)
+{
+	std::lock_guard<std::mutex> lock(_origin_cache_mutex);
+
+	_origin_cache.erase(app_stream_name);
+	// The lookup in progress is not cached when it completes
+	_inflight_lookups.erase(app_stream_name);
+}
+
+void OriginMapClient::RemoveExpiredCache()
+{
+	std::lock_guard<std::mutex> lock(_origin_cache_mutex);
+
+	auto now = static_cast<int64_t>(ov::Clock::NowMSec());
+
+	for (auto it = _origin_cache.begin(); it != _origin_cache.end();)
+	{
+		if (it->second.expire_time_msec <= now)
+		{
+			it = _origin_cache.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
 }
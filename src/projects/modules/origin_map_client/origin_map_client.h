@@ -11,10 +11,17 @@
 #include <base/common_types.h>
 #include <base/ovlibrary/ovlibrary.h>
 #include <base/ovlibrary/delay_queue.h>
-#include <hiredis/hiredis.h>
+
+#include "redis_async_client.h"
 
 // redis key expire time (sec)
 #define ORIGIN_MAP_STORE_KEY_EXPIRE_TIME 10
+// Maximum time to wait for a reply from redis
+#define ORIGIN_MAP_REDIS_TIMEOUT_MSEC 3000
+// How long the result of GetOrigin() is reused without querying redis
+#define ORIGIN_MAP_CACHE_TTL_MSEC 1000
+// How long "not found" result of GetOrigin() is reused, kept short so that a newly registered stream is found soon
+#define ORIGIN_MAP_NEGATIVE_CACHE_TTL_MSEC 500
 
 // If Origins-Edges cluster uses OriginMapStore, app/stream must be unique in the cluster.
 class OriginMapClient
@@ -23,6 +30,7 @@ public:
 	// redis_host: redis server host (ex: 192.168.0.160:6379)
 	// redis_password: redis server password (ex: password!@#)
 	OriginMapClient(const ov::String &redis_host, const ov::String &redis_password);
+	~OriginMapClient();
 
 	// if return false, it means that the app_stream_name is already registered from other origin server
 	// app_stream_name : app/stream name (ex: app/stream)
@@ -31,11 +39,30 @@ public:
 	bool Update(const ov::String &app_stream_name, const ov::String &origin_host);
 	bool Unregister(const ov::String &app_stream_name);
 
+	// The result is cached for a short time, and concurrent lookups of the same stream share a single query
 	CommonErrorCode GetOrigin(const ov::String &app_stream_name, ov::String &origin_host);
 
 private:
-	bool CheckConnection();
-	bool ConnectRedis();
+	using LookupResult = std::pair<CommonErrorCode, ov::String>;
+
+	struct CachedOrigin
+	{
+		LookupResult result;
+		int64_t expire_time_msec = 0;
+	};
+
+	struct InflightLookup
+	{
+		uint64_t id = 0;
+		std::shared_future<LookupResult> future;
+	};
+
+	// Returns a reply of Type::Disconnected if the reply is not received within ORIGIN_MAP_REDIS_TIMEOUT_MSEC
+	RedisReply WaitForReply(const std::shared_future<RedisReply> &future);
+
+	LookupResult LookupOrigin(const ov::String &app_stream_name);
+	void InvalidateCache(const ov::String &app_stream_name);
+	void RemoveExpiredCache();
 
 	bool NofifyStreamsAlive();
 	bool RetryRegister();
@@ -50,6 +77,11 @@ private:
 	std::map<ov::String, ov::String> _origin_map_candidates;
 	std::mutex _origin_map_mutex;
 
-	redisContext *_redis_context = nullptr;
-	std::mutex _redis_context_mutex;
-};
\ No newline at end of file
+	std::shared_ptr<RedisAsyncClient> _redis_client;
+
+	std::map<ov::String, CachedOrigin> _origin_cache;
+	// Lookups in progress, the callers of GetOrigin() for the same stream wait for the same result
+	std::map<ov::String, InflightLookup> _inflight_lookups;
+	uint64_t _last_lookup_id = 0;
+	std::mutex _origin_cache_mutex;
+};
@@ -0,0 +1,448 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "redis_async_client.h"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+#define OV_LOG_TAG "RedisAsyncClient"
+
+#define REDIS_ASYNC_CLIENT_MAX_EPOLL_EVENTS 8
+#define REDIS_ASYNC_CLIENT_EPOLL_TIMEOUT_MSEC 500
+
+RedisAsyncClient::RedisAsyncClient(const ov::String &ip, uint16_t port, const ov::String &password)
+	: _ip(ip),
+	  _port(port),
+	  _password(password)
+{
+}
+
+RedisAsyncClient::~RedisAsyncClient()
+{
+	Stop();
+}
+
+bool RedisAsyncClient::Start()
+{
+	_epoll_fd = epoll_create1(0);
+	if (_epoll_fd == -1)
+	{
+		logte("Could not create epoll (errno : %d)", errno);
+		return false;
+	}
+
+	_wakeup_fd = eventfd(0, EFD_NONBLOCK);
+	if (_wakeup_fd == -1)
+	{
+		logte("Could not create eventfd (errno : %d)", errno);
+		::close(_epoll_fd);
+		_epoll_fd = -1;
+		return false;
+	}
+
+	struct epoll_event event = {};
+	event.events = EPOLLIN;
+	event.data.fd = _wakeup_fd;
+	epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, _wakeup_fd, &event);
+
+	_stop_thread_flag = false;
+	_loop_thread = std::thread(&RedisAsyncClient::LoopThread, this);
+	pthread_setname_np(_loop_thread.native_handle(), "RedisAsync");
+
+	return true;
+}
+
+void RedisAsyncClient::Stop()
+{
+	if (_loop_thread.joinable())
+	{
+		_stop_thread_flag = true;
+		Wakeup();
+
+		_loop_thread.join();
+	}
+
+	if (_wakeup_fd != -1)
+	{
+		::close(_wakeup_fd);
+		_wakeup_fd = -1;
+	}
+
+	if (_epoll_fd != -1)
+	{
+		::close(_epoll_fd);
+		_epoll_fd = -1;
+	}
+}
+
+std::shared_future<RedisReply> RedisAsyncClient::Command(const std::vector<ov::String> &args)
+{
+	auto command = std::make_unique<PendingCommand>();
+	command->args = args;
+
+	auto future = command->promise.get_future().share();
+
+	if (_loop_thread.joinable() == false)
+	{
+		command->promise.set_value(RedisReply());
+		return future;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_pending_command_mutex);
+		_pending_command_list.push_back(std::move(command));
+	}
+
+	Wakeup();
+
+	return future;
+}
+
+void RedisAsyncClient::Wakeup()
+{
+	uint64_t value = 1;
+	[[maybe_unused]] auto result = ::write(_wakeup_fd, &value, sizeof(value));
+}
+
+void RedisAsyncClient::LoopThread()
+{
+	struct epoll_event events[REDIS_ASYNC_CLIENT_MAX_EPOLL_EVENTS];
+
+	while (_stop_thread_flag == false)
+	{
+		int event_count = epoll_wait(_epoll_fd, events, REDIS_ASYNC_CLIENT_MAX_EPOLL_EVENTS, REDIS_ASYNC_CLIENT_EPOLL_TIMEOUT_MSEC);
+
+		if (event_count < 0)
+		{
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			logtc("RedisAsyncClient terminated : epoll_wait error (errno : %d)", errno);
+			break;
+		}
+
+		for (int index = 0; index < event_count; index++)
+		{
+			auto &event = events[index];
+
+			if (event.data.fd == _wakeup_fd)
+			{
+				uint64_t value;
+				while (::read(_wakeup_fd, &value, sizeof(value)) > 0)
+				{
+				}
+
+				continue;
+			}
+
+			// The context may be freed while handling the previous event
+			if ((_context == nullptr) || (event.data.fd != _context_fd))
+			{
+				continue;
+			}
+
+			if (event.events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+			{
+				redisAsyncHandleRead(_context);
+			}
+
+			if ((_context != nullptr) && (event.events & EPOLLOUT))
+			{
+				redisAsyncHandleWrite(_context);
+			}
+		}
+
+		// Commands requested while handling the events are also written at once
+		IssuePendingCommands();
+	}
+
+	if (_context != nullptr)
+	{
+		// Pending callbacks are called with nullptr reply
+		redisAsyncFree(_context);
+		_context = nullptr;
+	}
+
+	FailPendingCommands();
+}
+
+bool RedisAsyncClient::ConnectIfNeeded()
+{
+	if (_context != nullptr)
+	{
+		return true;
+	}
+
+	auto now = static_cast<int64_t>(ov::Clock::NowMSec());
+	if ((now - _last_connect_failure_msec) < RECONNECT_INTERVAL_MSEC)
+	{
+		return false;
+	}
+
+	auto context = redisAsyncConnect(_ip.CStr(), _port);
+	if ((context == nullptr) || context->err)
+	{
+		logte("Failed to connect to redis server. ip: %s, port: %d, err: %s", _ip.CStr(), _port, (context != nullptr) ? context->errstr : "nil");
+
+		if (context != nullptr)
+		{
+			redisAsyncFree(context);
+		}
+
+		_last_connect_failure_msec = now;
+		return false;
+	}
+
+	_context = context;
+	_context_fd = context->c.fd;
+	_context_events = 0;
+
+	context->data = this;
+	context->ev.data = this;
+	context->ev.addRead = AddRead;
+	context->ev.delRead = DelRead;
+	context->ev.addWrite = AddWrite;
+	context->ev.delWrite = DelWrite;
+	context->ev.cleanup = Cleanup;
+
+	redisAsyncSetConnectCallback(context, OnConnected);
+	redisAsyncSetDisconnectCallback(context, OnDisconnected);
+
+	// AUTH is pipelined in front of the commands
+	if (_password.IsEmpty() == false)
+	{
+		const char *argv[] = {"AUTH", _password.CStr()};
+		const size_t argv_length[] = {4, _password.GetLength()};
+
+		redisAsyncCommandArgv(context, OnAuthReply, this, 2, argv, argv_length);
+	}
+
+	return true;
+}
+
+void RedisAsyncClient::IssuePendingCommands()
+{
+	std::vector<std::unique_ptr<PendingCommand>> command_list;
+
+	{
+		std::lock_guard<std::mutex> lock(_pending_command_mutex);
+		command_list = std::move(_pending_command_list);
+		_pending_command_list.clear();
+	}
+
+	if (command_list.empty())
+	{
+		return;
+	}
+
+	bool connected = ConnectIfNeeded();
+
+	for (auto &command : command_list)
+	{
+		if (connected)
+		{
+			connected = IssueCommand(std::move(command));
+		}
+		else
+		{
+			command->promise.set_value(RedisReply());
+		}
+	}
+}
+
+bool RedisAsyncClient::IssueCommand(std::unique_ptr<PendingCommand> command)
+{
+	std::vector<const char *> argv;
+	std::vector<size_t> argv_length;
+
+	for (const auto &arg : command->args)
+	{
+		argv.push_back(arg.CStr());
+		argv_length.push_back(arg.GetLength());
+	}
+
+	// The command is released in OnReply()
+	auto raw_command = command.release();
+
+	if (redisAsyncCommandArgv(_context, OnReply, raw_command, static_cast<int>(argv.size()), argv.data(), argv_length.data()) != REDIS_OK)
+	{
+		raw_command->promise.set_value(RedisReply());
+		delete raw_command;
+
+		return false;
+	}
+
+	return true;
+}
+
+void RedisAsyncClient::FailPendingCommands()
+{
+	std::lock_guard<std::mutex> lock(_pending_command_mutex);
+
+	for (auto &command : _pending_command_list)
+	{
+		command->promise.set_value(RedisReply());
+	}
+
+	_pending_command_list.clear();
+}
+
+void RedisAsyncClient::UpdateEvents(uint32_t events)
+{
+	if ((_context_fd == -1) || (events == _context_events))
+	{
+		return;
+	}
+
+	struct epoll_event event = {};
+	event.events = events;
+	event.data.fd = _context_fd;
+
+	if (_context_events == 0)
+	{
+		epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, _context_fd, &event);
+	}
+	else if (events == 0)
+	{
+		epoll_ctl(_epoll_fd, EPOLL_CTL_DEL, _context_fd, nullptr);
+	}
+	else
+	{
+		epoll_ctl(_epoll_fd, EPOLL_CTL_MOD, _context_fd, &event);
+	}
+
+	_context_events = events;
+}
+
+RedisReply RedisAsyncClient::ConvertReply(const redisReply *reply)
+{
+	RedisReply result;
+
+	if (reply == nullptr)
+	{
+		return result;
+	}
+
+	switch (reply->type)
+	{
+		case REDIS_REPLY_ERROR:
+			result.type = RedisReply::Type::Error;
+			result.str = ov::String(reply->str, reply->len);
+			break;
+
+		case REDIS_REPLY_NIL:
+			result.type = RedisReply::Type::Nil;
+			break;
+
+		case REDIS_REPLY_STRING:
+			result.type = RedisReply::Type::String;
+			result.str = ov::String(reply->str, reply->len);
+			break;
+
+		case REDIS_REPLY_STATUS:
+			result.type = RedisReply::Type::Status;
+			result.str = ov::String(reply->str, reply->len);
+			break;
+
+		case REDIS_REPLY_INTEGER:
+			result.type = RedisReply::Type::Integer;
+			result.integer = reply->integer;
+			break;
+
+		default:
+			result.type = RedisReply::Type::Array;
+			break;
+	}
+
+	return result;
+}
+
+void RedisAsyncClient::OnConnected(const redisAsyncContext *context, int status)
+{
+	auto client = static_cast<RedisAsyncClient *>(context->data);
+
+	if (status != REDIS_OK)
+	{
+		logte("Failed to connect to redis server. ip: %s, port: %d, err: %s", client->_ip.CStr(), client->_port, context->errstr);
+
+		// hiredis frees the context after this callback
+		client->_context = nullptr;
+		client->_last_connect_failure_msec = static_cast<int64_t>(ov::Clock::NowMSec());
+		return;
+	}
+
+	logti("Connected to redis server : %s:%d", client->_ip.CStr(), client->_port);
+}
+
+void RedisAsyncClient::OnDisconnected(const redisAsyncContext *context, int status)
+{
+	auto client = static_cast<RedisAsyncClient *>(context->data);
+
+	if (status != REDIS_OK)
+	{
+		logtw("Disconnected from redis server : %s:%d (err:%s)", client->_ip.CStr(), client->_port, context->errstr);
+	}
+
+	// hiredis frees the context after this callback, it will be connected again with the next command
+	client->_context = nullptr;
+}
+
+void RedisAsyncClient::OnReply(redisAsyncContext *context, void *reply, void *privdata)
+{
+	auto command = static_cast<PendingCommand *>(privdata);
+
+	command->promise.set_value(ConvertReply(static_cast<redisReply *>(reply)));
+
+	delete command;
+}
+
+void RedisAsyncClient::OnAuthReply(redisAsyncContext *context, void *reply, void *privdata)
+{
+	auto client = static_cast<RedisAsyncClient *>(privdata);
+	auto result = ConvertReply(static_cast<redisReply *>(reply));
+
+	if (result.type == RedisReply::Type::Error)
+	{
+		logte("Failed to auth to redis server. ip: %s, port: %d, err: %s", client->_ip.CStr(), client->_port, result.str.CStr());
+	}
+}
+
+void RedisAsyncClient::AddRead(void *privdata)
+{
+	auto client = static_cast<RedisAsyncClient *>(privdata);
+	client->UpdateEvents(client->_context_events | EPOLLIN);
+}
+
+void RedisAsyncClient::DelRead(void *privdata)
+{
+	auto client = static_cast<RedisAsyncClient *>(privdata);
+	client->UpdateEvents(client->_context_events & ~static_cast<uint32_t>(EPOLLIN));
+}
+
+void RedisAsyncClient::AddWrite(void *privdata)
+{
+	auto client = static_cast<RedisAsyncClient *>(privdata);
+	client->UpdateEvents(client->_context_events | EPOLLOUT);
+}
+
+void RedisAsyncClient::DelWrite(void *privdata)
+{
+	auto client = static_cast<RedisAsyncClient *>(privdata);
+	client->UpdateEvents(client->_context_events & ~static_cast<uint32_t>(EPOLLOUT));
+}
+
+void RedisAsyncClient::Cleanup(void *privdata)
+{
+	auto client = static_cast<RedisAsyncClient *>(privdata);
+
+	client->UpdateEvents(0);
+	client->_context_fd = -1;
+}
@@ -0,0 +1,110 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <hiredis/async.h>
+#include <hiredis/hiredis.h>
+
+#include <future>
+
+struct RedisReply
+{
+	enum class Type : uint8_t
+	{
+		// The command could not be sent or the connection was lost before the reply
+		Disconnected,
+		Error,
+		Nil,
+		String,
+		Status,
+		Integer,
+		Array
+	};
+
+	Type type = Type::Disconnected;
+	ov::String str;
+	long long integer = 0;
+
+	bool IsError() const
+	{
+		return (type == Type::Disconnected) || (type == Type::Error);
+	}
+};
+
+// Redis client using the async API of hiredis on its own epoll loop
+//
+// - Commands can be requested from any thread, they are written to the connection by the loop thread
+// - Commands requested at the same time are pipelined (sent together without waiting for the replies)
+// - The connection is established on demand, and re-established when the next command is requested after it is lost
+class RedisAsyncClient
+{
+public:
+	// The connection is not retried within this interval after it failed, the commands fail immediately
+	static constexpr int64_t RECONNECT_INTERVAL_MSEC = 1000;
+
+	RedisAsyncClient(const ov::String &ip, uint16_t port, const ov::String &password);
+	~RedisAsyncClient();
+
+	bool Start();
+	void Stop();
+
+	std::shared_future<RedisReply> Command(const std::vector<ov::String> &args);
+
+private:
+	struct PendingCommand
+	{
+		std::vector<ov::String> args;
+		std::promise<RedisReply> promise;
+	};
+
+	void LoopThread();
+	void Wakeup();
+
+	bool ConnectIfNeeded();
+	void IssuePendingCommands();
+	bool IssueCommand(std::unique_ptr<PendingCommand> command);
+	void FailPendingCommands();
+
+	void UpdateEvents(uint32_t events);
+
+	static RedisReply ConvertReply(const redisReply *reply);
+
+	// hiredis callbacks
+	static void OnConnected(const redisAsyncContext *context, int status);
+	static void OnDisconnected(const redisAsyncContext *context, int status);
+	static void OnReply(redisAsyncContext *context, void *reply, void *privdata);
+	static void OnAuthReply(redisAsyncContext *context, void *reply, void *privdata);
+
+	// hiredis event hooks
+	static void AddRead(void *privdata);
+	static void DelRead(void *privdata);
+	static void AddWrite(void *privdata);
+	static void DelWrite(void *privdata);
+	static void Cleanup(void *privdata);
+
+	ov::String _ip;
+	uint16_t _port;
+	ov::String _password;
+
+	int _epoll_fd = -1;
+	int _wakeup_fd = -1;
+
+	std::thread _loop_thread;
+	std::atomic<bool> _stop_thread_flag{false};
+
+	std::mutex _pending_command_mutex;
+	std::vector<std::unique_ptr<PendingCommand>> _pending_command_list;
+
+	// Only accessed by the loop thread
+	redisAsyncContext *_context = nullptr;
+	int _context_fd = -1;
+	uint32_t _context_events = 0;
+	int64_t _last_connect_failure_msec = 0;
+};
@@ -5,6 +5,7 @@ OvtPacket::OvtPacket()
 {
 	_version = OVT_VERSION;
 	_marker = 0;
+	_keyframe = 0;
 	_payload_type = 0;
 	_timestamp = 0;
 	_sequence_number = 0;
@@ -28,6 +29,7 @@ OvtPacket::OvtPacket(OvtPacket &src)
 {
 	_version = OVT_VERSION;
 	_marker = src._marker;
+	_keyframe = src._keyframe;
 	_payload_type = src._payload_type;
 	_timestamp = src._timestamp;
 	_sequence_number = src._sequence_number;
@@ -73,6 +75,7 @@ bool OvtPacket::LoadHeader(const ov::Data &data)
 
 	// Read header
 	SetMarker(buffer[0] & 0x20);
+	SetKeyframe(buffer[0] & 0x10);
 	SetPayloadType(ByteReader<uint8_t>::ReadBigEndian(&buffer[1]));
 	SetSequenceNumber(ByteReader<uint16_t>::ReadBigEndian(&buffer[2]));
 	SetTimestamp(ByteReader<uint64_t>::ReadBigEndian(&buffer[4]));
@@ -155,6 +158,11 @@ uint32_t OvtPacket::SessionId() const
 	return _session_id;
 }
 
+bool OvtPacket::Keyframe() const
+{
+	return _keyframe;
+}
+
 uint32_t OvtPacket::PacketLength() const
 {
 	return OVT_FIXED_HEADER_SIZE + _payload_length;
@@ -199,6 +207,20 @@ void OvtPacket::SetMarker(bool marker_bit)
 	}
 }
 
+void OvtPacket::SetKeyframe(bool keyframe_bit)
+{
+	_keyframe = keyframe_bit;
+
+	if(_keyframe)
+	{
+		_buffer[0] = _buffer[0] | 0x10;
+	}
+	else
+	{
+		_buffer[0] = _buffer[0] & 0xEF;
+	}
+}
+
 void OvtPacket::SetPayloadType(uint8_t payload_type)
 {
 	_payload_type = payload_type;
@@ -16,7 +16,7 @@
 //  0                   1                   2                   3
 //  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
 // +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
-// |V=1|M|Reserved-| Payload Type  |       Sequence Number         |
+// |V=1|M|K|Reserv-| Payload Type  |       Sequence Number         |
 // +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
 // |                           Timestamp                           |
 // |                              ...                              |
@@ -28,6 +28,13 @@
 
 // [SessionID] - Reserved
 // Designed for the purpose of classifying each session when two or more sessions are connected with the same 5tuple in the future. Currently not used because the client connects to the server using a different port.
+// Since OVT_PROTOCOL_REVISION_CONNECTION_BOUND_SESSION (see ovt_signaling.h), the session ID is bound to the connection and SI of MEDIA packets is ignored.
+// Since OVT_PROTOCOL_REVISION_MULTIPLEXED, SI of MEDIA packets is the channel ID of the stream (responded with PLAY),
+// which classifies the streams multiplexed in a connection.
+
+// [K] - Keyframe
+// Set on all packets of a media packet which can be decoded independently (keyframe, audio, data).
+// The other media packets may be dropped by the origin when the connection is congested (until the next keyframe).
 
 /***********************************************
  * Protocol Specification
@@ -108,7 +115,8 @@
  		{
  			"id": 3921932,
 			"application" : "play", "stop",
- 			"target": "ovt://host:port/app/stream"
+ 			"target": "ovt://host:port/app/stream",
+			"revision" : 2 // PLAY only, optional (default 1)
  		}
 
  		<! Later version can be extended to specify tracks or add other options. >
@@ -125,13 +133,17 @@
 			"application" : "play" | "stop",
 			"code" : 200 | 404 | 500,
 			"message" : "ok" | "app/stream not found" | "Internal Server Error",
+			"contents" : // PLAY only
+			{
+				"revision" : 1 | 2
+			}
 		}
 
 		while(STOP or DISCONNECTED)
 		{
 			M  : 0 or 1
 			PT : MEDIA (30)
-			SI : 11992
+			SI : 11992 (revision 1) | ignored (revision 2) | channel ID (revision 3)
 			SN : 1 ~ rolling
 			TS : Unix timestamp
 			Payload :
@@ -173,6 +185,7 @@ public:
 	uint16_t 	SequenceNumber() const;
 	uint64_t 	Timestamp() const;
 	uint32_t 	SessionId() const;
+	bool 		Keyframe() const;
 	uint32_t	PacketLength() const;
 	uint16_t 	PayloadLength() const;
 	const uint8_t*	Payload() const;
@@ -183,6 +196,7 @@ public:
 	void 		SetTimestampNow();
 	void 		SetTimestamp(uint64_t timestamp);
 	void 		SetSessionId(uint32_t session_id);
+	void 		SetKeyframe(bool keyframe_bit);
 
 	bool 		SetPayload(const uint8_t *payload, size_t payload_size);
 
@@ -197,6 +211,7 @@ private:
 
 	uint8_t		_version;
 	uint8_t 	_marker;
+	uint8_t 	_keyframe;
 	uint8_t 	_payload_type;
 	uint16_t 	_sequence_number;
 	uint64_t 	_timestamp;
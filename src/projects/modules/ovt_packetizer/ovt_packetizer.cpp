@@ -125,14 +125,18 @@ bool OvtPacketizer::PacketizeMediaPacket(uint64_t timestamp, const std::shared_p
 	size_t remain_payload_len = payload.GetLength();
 	size_t offset = 0;
 
+	// Only the video frames which depend on the other frames can be dropped
+	bool keyframe = (media_packet->GetMediaType() != cmn::MediaType::Video) || (media_packet->GetFlag() == MediaPacketFlag::Key);
+
 	while(remain_payload_len != 0)
 	{
 		// Serialize
 		auto packet = std::make_shared<OvtPacket>();
-		// Session ID should be set in Session Level
-		packet->SetSessionId(0);
+		// Session ID should be set in Session Level (OVT_PROTOCOL_REVISION_LEGACY)
+		packet->SetSessionId(_session_id);
 		packet->SetPayloadType(OVT_PAYLOAD_TYPE_MEDIA_PACKET);
 		packet->SetMarker(false);
+		packet->SetKeyframe(keyframe);
 		packet->SetTimestamp(timestamp);
 
 		if(remain_payload_len > max_payload_size)
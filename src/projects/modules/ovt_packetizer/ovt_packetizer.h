@@ -20,6 +20,12 @@ public:
 	bool IsAvailablePackets();
 	std::shared_ptr<OvtPacket> PopPacket();
 
+	// SI of the media packets (channel ID of the stream since OVT_PROTOCOL_REVISION_MULTIPLEXED)
+	void SetSessionId(uint32_t session_id)
+	{
+		_session_id = session_id;
+	}
+
 	void Release()
 	{
 		_stream.reset();
@@ -27,6 +33,7 @@ public:
 
 private:
 	uint16_t 									_sequence_number;
+	uint32_t 									_session_id = 0;
 	std::shared_ptr<OvtPacketizerInterface> 	_stream = nullptr;
 	
 	std::queue<std::shared_ptr<OvtPacket>>		_ovt_packets;
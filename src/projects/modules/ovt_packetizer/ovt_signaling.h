@@ -2,6 +2,56 @@
 
 #define OVT_SIGNALING_VERSION 0x12
 
+// Revision of the OVT framing, negotiated with PLAY
+//
+// The edge sends the highest revision it supports in the PLAY request ("revision"),
+// and the origin responds with the revision it will use for the session (contents.revision).
+// A peer which does not know "revision" uses OVT_PROTOCOL_REVISION_LEGACY.
+//
+// - OVT_PROTOCOL_REVISION_LEGACY : The session ID is stamped into the header of each media packet
+// - OVT_PROTOCOL_REVISION_CONNECTION_BOUND_SESSION : The session ID is bound to the connection (responded with PLAY),
+//   and the SI of the media packets is ignored, so the origin sends the same packets to all edges without copying them
+// - OVT_PROTOCOL_REVISION_MULTIPLEXED : Several streams are played over one connection.
+//   The SI of the media packets is the channel ID of the stream (contents.channelId of PLAY).
+//   The connection is negotiated with MULTIPLEX before any other request (see below).
+#define OVT_PROTOCOL_REVISION_LEGACY 1
+#define OVT_PROTOCOL_REVISION_CONNECTION_BOUND_SESSION 2
+#define OVT_PROTOCOL_REVISION_MULTIPLEXED 3
+#define OVT_PROTOCOL_REVISION OVT_PROTOCOL_REVISION_MULTIPLEXED
+
+/*
+	MULTIPLEX (OVT_PROTOCOL_REVISION_MULTIPLEXED)
+
+	<C->S> The first request of a connection which will be shared by several streams
+		{
+			"id": 1,
+			"application" : "multiplex",
+			"target": "ovt://host:port/app/stream", // Any stream of the origin
+			"revision" : 3
+		}
+	<S->C>
+		{
+			"id": 1,
+			"application" : "multiplex",
+			"code" : 200, // An origin that does not support it responds 404 (Unknown application)
+			"message" : "ok",
+			"contents" : { "revision" : 3 }
+		}
+
+	After that, DESCRIBE/PLAY/STOP of any stream can be requested over the connection (the "id" is unique in the connection),
+	and the media packets of each stream are classified by the channel ID (SI).
+
+	When the stream of the origin is stopped, the origin notifies it instead of closing the connection:
+	<S->C>
+		{
+			"id": 0,
+			"application" : "stop",
+			"code" : 200,
+			"message" : "stream has been stopped",
+			"contents" : { "channelId" : 3921 }
+		}
+*/
+
 /*
 	"version": 0x12,
 	"stream" :
@@ -23,6 +23,8 @@ namespace modules::rtmp
 		uint32_t chunk_stream_id = 0;
 		MessageTypeID type_id = MessageTypeID::Unknown;
 		uint32_t stream_id = 0;
+		// Timestamp of the message (in milliseconds). Extended timestamp is used if it is greater than 0xFFFFFF
+		uint32_t timestamp = 0;
 
 		std::shared_ptr<ov::Data> payload;
 
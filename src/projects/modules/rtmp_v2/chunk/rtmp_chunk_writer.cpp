@@ -271,11 +271,17 @@ namespace modules::rtmp
 
 		chunk_header->basic_header.format_type = MessageHeaderType::T0;
 		chunk_header->basic_header.chunk_stream_id = chunk_write_info->chunk_stream_id;
-		chunk_header->message_header.type_0.timestamp = 0;
+		chunk_header->message_header.type_0.timestamp = chunk_write_info->timestamp;
 		chunk_header->message_header.type_0.length = payload_length;
 		chunk_header->message_header.type_0.type_id = chunk_write_info->type_id;
 		chunk_header->message_header.type_0.stream_id = chunk_write_info->stream_id;
 
+		if (chunk_write_info->timestamp >= EXTENDED_TIMESTAMP_VALUE)
+		{
+			chunk_header->is_extended_timestamp = true;
+			chunk_header->extended_timestamp = chunk_write_info->timestamp;
+		}
+
 		const auto expected_length = CalculateDataLength(chunk_header, payload_length);
 		ov::ByteStream byte_stream(expected_length);
 
@@ -103,6 +103,13 @@ bool RtpRtcp::Stop()
 }
 
 bool RtpRtcp::SendRtpPacket(const std::shared_ptr<RtpPacket> &rtp_packet)
+{
+	_last_sent_rtp_packet = rtp_packet;
+
+	return SendRtpPacket(rtp_packet, rtp_packet->GetData());
+}
+
+bool RtpRtcp::SendRtpPacket(const std::shared_ptr<const RtpPacket> &rtp_packet, const std::shared_ptr<ov::Data> &data)
 {
 	std::shared_lock<std::shared_mutex> lock(_state_lock);
 	// nothing to do before node start
@@ -157,8 +164,7 @@ bool RtpRtcp::SendRtpPacket(const std::shared_ptr<RtpPacket> &rtp_packet)
 	}
 
 	// Send RTP
-	_last_sent_rtp_packet = rtp_packet;
-	return SendDataToNextNode(NodeType::Rtp, rtp_packet->GetData());
+	return SendDataToNextNode(NodeType::Rtp, data);
 }
 
 bool RtpRtcp::SendPLI(uint32_t track_id)
@@ -62,6 +62,9 @@ public:
 	bool Stop() override;
 
 	bool SendRtpPacket(const std::shared_ptr<RtpPacket> &packet);
+	// Sends |data| which is the serialized form of |packet| with a rewritten header (sequence number, header extensions).
+	// |packet| is only referenced for the sender report, so it can be shared by several sessions.
+	bool SendRtpPacket(const std::shared_ptr<const RtpPacket> &packet, const std::shared_ptr<ov::Data> &data);
 	bool SendPLI(uint32_t track_id);
 	bool SendFIR(uint32_t track_id);
 
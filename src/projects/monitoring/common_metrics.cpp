@@ -3,16 +3,31 @@
 //
 #include "common_metrics.h"
 
+#include <time.h>
+
 #include "monitoring_private.h"
 
 namespace mon
 {
 #define THROUGHPUT_MEASURE_INTERVAL 1
 
+	static int64_t GetCoarseTimeMSec()
+	{
+#if IS_MACOS
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+#else	// IS_MACOS
+		struct timespec ts;
+
+		// CLOCK_REALTIME_COARSE is much cheaper than CLOCK_REALTIME, and its resolution (1 tick) is enough for the statistics
+		::clock_gettime(CLOCK_REALTIME_COARSE, &ts);
+
+		return (static_cast<int64_t>(ts.tv_sec) * 1000LL) + (ts.tv_nsec / 1000000LL);
+#endif	// IS_MACOS
+	}
+
 	CommonMetrics::CommonMetrics()
 	{
 		_total_bytes_in = 0;
-		_total_bytes_out = 0;
 		_total_connections = 0;
 		_max_total_connections = 0;
 
@@ -30,11 +45,10 @@ namespace mon
 
 		_max_total_connection_time = std::chrono::system_clock::now();
 		_last_recv_time = std::chrono::system_clock::now();
-		_last_sent_time = std::chrono::system_clock::now();
+		_last_sent_time_msec = GetCoarseTimeMSec();
 
 		for (int i = 0; i < static_cast<int8_t>(PublisherType::NumberOfPublishers); i++)
 		{
-			_publisher_metrics[i]._bytes_out = 0;
 			_publisher_metrics[i]._connections = 0;
 		}
 		_created_time = std::chrono::system_clock::now();
@@ -91,9 +105,10 @@ namespace mon
 		return _created_time;
 	}
 
-	const std::chrono::system_clock::time_point& CommonMetrics::GetLastUpdatedTime() const
+	std::chrono::system_clock::time_point CommonMetrics::GetLastUpdatedTime() const
 	{
-		return _last_updated_time;
+		// Sending data doesn't renew _last_updated_time (see UpdateLastSentTime())
+		return std::max(_last_updated_time, GetLastSentTime());
 	}
 
 	uint64_t CommonMetrics::GetTotalBytesIn() const
@@ -102,7 +117,7 @@ namespace mon
 	}
 	uint64_t CommonMetrics::GetTotalBytesOut() const
 	{
-		return _total_bytes_out;
+		return _bytes_out.LoadAll();
 	}
 
 	uint64_t CommonMetrics::GetAvgThroughputIn() const
@@ -156,12 +171,12 @@ namespace mon
 
 	std::chrono::system_clock::time_point CommonMetrics::GetLastSentTime() const
 	{
-		return _last_sent_time;
+		return std::chrono::system_clock::time_point(std::chrono::milliseconds(_last_sent_time_msec.load(std::memory_order_relaxed)));
 	}
 
 	uint64_t CommonMetrics::GetBytesOut(PublisherType type) const
 	{
-		return _publisher_metrics[static_cast<int8_t>(type)]._bytes_out;
+		return _bytes_out.Load(static_cast<size_t>(type));
 	}
 	uint64_t CommonMetrics::GetConnections(PublisherType type) const
 	{
@@ -187,11 +202,9 @@ namespace mon
 			return;
 		}
 
-		_publisher_metrics[static_cast<int8_t>(type)]._bytes_out += value;
-		_total_bytes_out += value;
-		_last_sent_time = std::chrono::system_clock::now();
+		_bytes_out.Add(static_cast<size_t>(type), value);
 
-		UpdateDate();
+		UpdateLastSentTime();
 	}
 
 	void CommonMetrics::OnSessionConnected(PublisherType type)
@@ -229,6 +242,17 @@ namespace mon
 		_last_updated_time = std::chrono::system_clock::now();
 	}
 
+	void CommonMetrics::UpdateLastSentTime()
+	{
+		auto now = GetCoarseTimeMSec();
+
+		// Avoid writing to the shared cache line if the time has not changed
+		if (_last_sent_time_msec.load(std::memory_order_relaxed) != now)
+		{
+			_last_sent_time_msec.store(now, std::memory_order_relaxed);
+		}
+	}
+
 	void CommonMetrics::UpdateThroughput()
 	{
 		auto throughput_measure_time = std::chrono::system_clock::now();
@@ -248,15 +272,16 @@ namespace mon
 			_last_total_bytes_in.store(_total_bytes_in);
 
 			// Calculate last second throughput of publisher
-			_last_throughtput_out = (_total_bytes_out.load() - _last_total_bytes_out.load());
+			auto total_bytes_out = GetTotalBytesOut();
+			_last_throughtput_out = (total_bytes_out - _last_total_bytes_out.load());
 
 			// Calculate average throughput of publisher
-			_avg_throughtput_out = (_total_bytes_out.load() - _last_total_bytes_out.load()) * 8 / THROUGHPUT_MEASURE_INTERVAL;
+			_avg_throughtput_out = (total_bytes_out - _last_total_bytes_out.load()) * 8 / THROUGHPUT_MEASURE_INTERVAL;
 			if (_avg_throughtput_out.load() > _max_throughtput_out.load())
 			{
 				_max_throughtput_out.store(_avg_throughtput_out);
 			}
-			_last_total_bytes_out.store(_total_bytes_out);
+			_last_total_bytes_out.store(total_bytes_out);
 		}
 	}
 }  // namespace mon
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "base/common_types.h"
 #include "base/info/info.h"
 #include "base/info/stream.h"
+#include "sharded_counter.h"
 
 namespace mon
 {
@@ -18,7 +19,7 @@ namespace mon
 
 		uint32_t GetUnusedTimeSec() const;
 		const std::chrono::system_clock::time_point& GetCreatedTime() const;
-		const std::chrono::system_clock::time_point& GetLastUpdatedTime() const;
+		std::chrono::system_clock::time_point GetLastUpdatedTime() const;
 		
 		virtual uint64_t GetTotalBytesIn() const;
 		virtual uint64_t GetTotalBytesOut() const;
@@ -48,6 +49,8 @@ namespace mon
 
 		// Renew last updated time
 		void UpdateDate();
+		// Renew last sent time. Called for every packet, so it uses a coarse clock and writes only when the time is changed.
+		void UpdateLastSentTime();
 		void UpdateThroughput();
 
 		std::chrono::system_clock::time_point _created_time;
@@ -56,16 +59,14 @@ namespace mon
 		// From Provider
 		std::atomic<uint64_t> _total_bytes_in;
 
-		// From Publishers
-		std::atomic<uint64_t> _total_bytes_out;
-
 		std::atomic<uint32_t> _total_connections;
 		std::atomic<uint32_t> _max_total_connections;
 		// Time to reach maximum number of connections. 
 		// TODO(Getroot): Does it need mutex? Check!
 		std::chrono::system_clock::time_point	_max_total_connection_time;
 		std::chrono::system_clock::time_point	_last_recv_time;
-		std::chrono::system_clock::time_point	_last_sent_time;
+		// Milliseconds since epoch
+		std::atomic<int64_t> _last_sent_time_msec;
 
 		// Throughput from Provider
 		std::atomic<uint64_t> _avg_throughtput_in;
@@ -87,10 +88,12 @@ namespace mon
 		class PublisherMetrics
 		{
 		public:
-			std::atomic<uint64_t> _bytes_out;
 			std::atomic<uint32_t> _connections;
 		};
 
 		PublisherMetrics _publisher_metrics[static_cast<int8_t>(PublisherType::NumberOfPublishers)];
+
+		// Bytes sent by publishers (indexed by PublisherType). Total bytes out is the sum of them.
+		ShardedCounters<static_cast<size_t>(PublisherType::NumberOfPublishers)> _bytes_out;
 	};
 }  // namespace mon
\ No newline at end of file
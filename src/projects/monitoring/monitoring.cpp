@@ -59,6 +59,43 @@ namespace mon
 		return stream_metric;
 	}
 
+	std::shared_ptr<StreamMetricsHandle> Monitoring::GetStreamMetricsHandle(const info::Stream &stream_info)
+	{
+		auto host_metric = _server_metric->GetHostMetrics(stream_info.GetApplicationInfo().GetHostInfo());
+		if (host_metric == nullptr)
+		{
+			return nullptr;
+		}
+		auto app_metric = host_metric->GetApplicationMetrics(stream_info.GetApplicationInfo());
+		if (app_metric == nullptr)
+		{
+			return nullptr;
+		}
+		auto stream_metric = app_metric->GetStreamMetrics(stream_info);
+		if (stream_metric == nullptr)
+		{
+			return nullptr;
+		}
+
+		std::vector<std::shared_ptr<CommonMetrics>> metrics_list{_server_metric, host_metric, app_metric, stream_metric};
+
+		// Same as StreamMetrics::IncreaseBytesOut(), the bytes are also counted to the linked input streams
+		auto input_stream_info = stream_metric->GetLinkedInputStream();
+		while (input_stream_info != nullptr)
+		{
+			auto input_stream_metric = app_metric->GetStreamMetrics(*input_stream_info);
+			if (input_stream_metric == nullptr)
+			{
+				break;
+			}
+
+			metrics_list.push_back(input_stream_metric);
+			input_stream_info = input_stream_metric->GetLinkedInputStream();
+		}
+
+		return std::make_shared<StreamMetricsHandle>(std::move(metrics_list));
+	}
+
 	void Monitoring::SetLogPath(const ov::String &log_path)
 	{
 		_logger.SetLogPath(log_path);
@@ -7,6 +7,7 @@
 #include "base/ovlibrary/delay_queue.h"
 #include "base/info/info.h"
 #include "server_metrics.h"
+#include "stream_metrics_handle.h"
 #include "event_logger.h"
 #include "event_forwarder.h"
 #include "./alert/alert.h"
@@ -41,6 +42,8 @@ namespace mon
 		std::shared_ptr<HostMetrics> GetHostMetrics(const info::Host &host_info);
         std::shared_ptr<ApplicationMetrics> GetApplicationMetrics(const info::Application &app_info);
         std::shared_ptr<StreamMetrics>  GetStreamMetrics(const info::Stream &stream_info);
+		// Returns nullptr if the metrics of the stream are not created yet
+		std::shared_ptr<StreamMetricsHandle> GetStreamMetricsHandle(const info::Stream &stream_info);
 
 		// Events
 		void OnServerStarted(const std::shared_ptr<const cfg::Server> &server_config);
@@ -213,4 +213,44 @@ namespace mon
 
 		return _queues[queue_info.GetId()];
 	}
+
+	std::shared_ptr<WorkerMetrics> ServerMetrics::OnWorkerCreated(WorkerMetrics::Type type, const ov::String &name)
+	{
+		std::unique_lock<std::shared_mutex> lock(_worker_map_guard);
+
+		auto id = _last_worker_id++;
+		auto worker_metrics = std::make_shared<WorkerMetrics>(id, type, name);
+
+		_workers[id] = worker_metrics;
+
+		return worker_metrics;
+	}
+
+	bool ServerMetrics::OnWorkerDeleted(const std::shared_ptr<WorkerMetrics> &worker_metrics)
+	{
+		if (worker_metrics == nullptr)
+		{
+			return false;
+		}
+
+		std::unique_lock<std::shared_mutex> lock(_worker_map_guard);
+
+		auto it = _workers.find(worker_metrics->GetId());
+		if (it == _workers.end())
+		{
+			logtw("Cannot find WorkerMetrics(%u/%s) for deleting", worker_metrics->GetId(), worker_metrics->GetName().CStr());
+			return false;
+		}
+
+		_workers.erase(it);
+
+		return true;
+	}
+
+	std::map<uint32_t, std::shared_ptr<WorkerMetrics>> ServerMetrics::GetWorkerMetricsList()
+	{
+		std::shared_lock<std::shared_mutex> lock(_worker_map_guard);
+
+		return _workers;
+	}
 }  // namespace mon
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include "base/info/managed_queue.h"
 #include "host_metrics.h"
 #include "queue_metrics.h"
+#include "worker_metrics.h"
 
 namespace mon
 {
@@ -45,5 +46,16 @@ namespace mon
 	protected:
 		std::shared_mutex _queue_map_guard;
 		std::map<uint32_t, std::shared_ptr<QueueMetrics>> _queues;
+
+	// Worker metrics
+	public:
+		std::shared_ptr<WorkerMetrics> OnWorkerCreated(WorkerMetrics::Type type, const ov::String &name);
+		bool OnWorkerDeleted(const std::shared_ptr<WorkerMetrics> &worker_metrics);
+		std::map<uint32_t, std::shared_ptr<WorkerMetrics>> GetWorkerMetricsList();
+
+	protected:
+		std::shared_mutex _worker_map_guard;
+		std::map<uint32_t, std::shared_ptr<WorkerMetrics>> _workers;
+		uint32_t _last_worker_id = 0;
 	};
 }
\ No newline at end of file
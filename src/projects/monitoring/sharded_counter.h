@@ -0,0 +1,75 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <array>
+#include <atomic>
+
+namespace mon
+{
+	// Set of counters which are increased by many threads at the same time (e.g. bytes sent by sessions)
+	//
+	// The counters are split into cache line aligned shards. Each thread increases the counters of its own shard,
+	// so the threads don't contend for the same cache line. The shards are summed up only when the counter is read.
+	template <size_t COUNTER_COUNT>
+	class ShardedCounters
+	{
+	public:
+		static constexpr size_t SHARD_COUNT = 8;
+
+		void Add(size_t index, uint64_t value)
+		{
+			_shards[GetShardIndex()].counters[index].fetch_add(value, std::memory_order_relaxed);
+		}
+
+		uint64_t Load(size_t index) const
+		{
+			uint64_t sum = 0;
+
+			for (const auto &shard : _shards)
+			{
+				sum += shard.counters[index].load(std::memory_order_relaxed);
+			}
+
+			return sum;
+		}
+
+		uint64_t LoadAll() const
+		{
+			uint64_t sum = 0;
+
+			for (const auto &shard : _shards)
+			{
+				for (const auto &counter : shard.counters)
+				{
+					sum += counter.load(std::memory_order_relaxed);
+				}
+			}
+
+			return sum;
+		}
+
+	private:
+		// The shard is assigned to each thread in a round-robin manner when the thread increases a counter for the first time
+		static size_t GetShardIndex()
+		{
+			static std::atomic<size_t> next_shard_index{0};
+			thread_local size_t shard_index = next_shard_index.fetch_add(1, std::memory_order_relaxed) % SHARD_COUNT;
+
+			return shard_index;
+		}
+
+		struct alignas(64) Shard
+		{
+			std::array<std::atomic<uint64_t>, COUNTER_COUNT> counters{};
+		};
+
+		std::array<Shard, SHARD_COUNT> _shards;
+	};
+}  // namespace mon
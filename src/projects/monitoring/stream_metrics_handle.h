@@ -0,0 +1,41 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include "common_metrics.h"
+
+namespace mon
+{
+	// Pre-resolved metrics of a stream for the hot paths (e.g. sending packets per session)
+	//
+	// Monitoring::IncreaseBytesOut() looks up the host/application/stream metrics for every call.
+	// The handle resolves them (and the metrics of the linked input stream) once, and then only increases the sharded counters.
+	class StreamMetricsHandle
+	{
+	public:
+		// metrics_list: metrics of server, host, application, stream and linked input streams
+		explicit StreamMetricsHandle(std::vector<std::shared_ptr<CommonMetrics>> metrics_list)
+			: _metrics_list(std::move(metrics_list))
+		{
+		}
+
+		void IncreaseBytesOut(PublisherType type, uint64_t value)
+		{
+			for (const auto &metrics : _metrics_list)
+			{
+				// StreamMetrics::IncreaseBytesOut() propagates the value to the linked input stream by looking up the map again,
+				// but it is already included in the list, so call the CommonMetrics version directly
+				metrics->CommonMetrics::IncreaseBytesOut(type, value);
+			}
+		}
+
+	private:
+		std::vector<std::shared_ptr<CommonMetrics>> _metrics_list;
+	};
+}  // namespace mon
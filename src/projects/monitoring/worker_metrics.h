@@ -0,0 +1,101 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Keukhan Kwon
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+
+namespace mon
+{
+	// Metrics of the shared worker threads and the tasks scheduled on them
+	class WorkerMetrics
+	{
+	public:
+		enum class Type : uint8_t
+		{
+			Worker,
+			Task
+		};
+
+		WorkerMetrics(uint32_t id, Type type, const ov::String &name)
+			: _id(id),
+			  _type(type),
+			  _name(name)
+		{
+		}
+
+		uint32_t GetId() const
+		{
+			return _id;
+		}
+
+		Type GetType() const
+		{
+			return _type;
+		}
+
+		const char *GetTypeString() const
+		{
+			return (_type == Type::Worker) ? "worker" : "task";
+		}
+
+		const ov::String &GetName() const
+		{
+			return _name;
+		}
+
+		// Number of tasks waiting to be executed by the worker
+		void SetQueueSize(size_t size)
+		{
+			_queue_size = size;
+		}
+
+		size_t GetQueueSize() const
+		{
+			return _queue_size;
+		}
+
+		// Number of executions and consumed cpu time(microseconds)
+		void OnExecuted(int64_t cpu_time_us)
+		{
+			_execution_count++;
+			_cpu_time_us += cpu_time_us;
+		}
+
+		uint64_t GetExecutionCount() const
+		{
+			return _execution_count;
+		}
+
+		int64_t GetCpuTimeUs() const
+		{
+			return _cpu_time_us;
+		}
+
+		// Number of tasks stolen from other workers
+		void IncreaseStealCount()
+		{
+			_steal_count++;
+		}
+
+		uint64_t GetStealCount() const
+		{
+			return _steal_count;
+		}
+
+	private:
+		uint32_t _id;
+		Type _type;
+		ov::String _name;
+
+		std::atomic<size_t> _queue_size{0};
+		std::atomic<uint64_t> _execution_count{0};
+		std::atomic<int64_t> _cpu_time_us{0};
+		std::atomic<uint64_t> _steal_count{0};
+	};
+}  // namespace mon
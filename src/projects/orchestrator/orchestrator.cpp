@@ -438,10 +438,77 @@ namespace ocst
 		return resolved;
 	}
 
+	bool Orchestrator::CoalescePullRequest(const ov::String &pull_key, const std::function<bool()> &pull_function)
+	{
+		std::promise<bool> promise;
+
+		{
+			std::unique_lock<std::mutex> lock(_pending_pull_mutex);
+
+			auto item = _pending_pull_map.find(pull_key);
+			if (item != _pending_pull_map.end())
+			{
+				auto pending_pull = item->second;
+				_pull_request_stats.coalesced_waiter_count++;
+				lock.unlock();
+
+				logtd("Waiting for the pull in progress: %s", pull_key.CStr());
+				return pending_pull.get();
+			}
+
+			_pending_pull_map.emplace(pull_key, promise.get_future().share());
+			_pull_request_stats.pull_count++;
+		}
+
+		auto start_time = ov::Clock::NowMSec();
+
+		auto result = pull_function();
+
+		auto setup_time = ov::Clock::NowMSec() - start_time;
+
+		{
+			std::lock_guard<std::mutex> lock(_pending_pull_mutex);
+
+			// Requests from now on start a new pull
+			_pending_pull_map.erase(pull_key);
+
+			_pull_request_stats.total_setup_time_msec += setup_time;
+			_pull_request_stats.max_setup_time_msec = std::max(_pull_request_stats.max_setup_time_msec, setup_time);
+		}
+
+		promise.set_value(result);
+
+		logtd("The pull has been completed: %s (result: %s, setup time: %" PRIu64 " ms)", pull_key.CStr(), result ? "true" : "false", setup_time);
+
+		return result;
+	}
+
+	Orchestrator::PullRequestStats Orchestrator::GetPullRequestStats() const
+	{
+		std::lock_guard<std::mutex> lock(_pending_pull_mutex);
+
+		auto stats = _pull_request_stats;
+		stats.pending_pull_count = _pending_pull_map.size();
+
+		return stats;
+	}
+
 	bool Orchestrator::RequestPullStreamWithUrls(
 		const std::shared_ptr<const ov::Url> &request_from,
 		const info::VHostAppName &vhost_app_name, const ov::String &stream_name,
 		const std::vector<ov::String> &url_list, off_t offset, const std::shared_ptr<pvd::PullStreamProperties> &properties)
+	{
+		auto pull_key = ov::String::FormatString("urls#%s#%s#%jd", vhost_app_name.CStr(), stream_name.CStr(), static_cast<intmax_t>(offset));
+
+		return CoalescePullRequest(pull_key, [&]() -> bool {
+			return RequestPullStreamWithUrlsInternal(request_from, vhost_app_name, stream_name, url_list, offset, properties);
+		});
+	}
+
+	bool Orchestrator::RequestPullStreamWithUrlsInternal(
+		const std::shared_ptr<const ov::Url> &request_from,
+		const info::VHostAppName &vhost_app_name, const ov::String &stream_name,
+		const std::vector<ov::String> &url_list, off_t offset, const std::shared_ptr<pvd::PullStreamProperties> &properties)
 	{
 		if (url_list.empty() == true)
 		{
@@ -528,11 +595,25 @@ namespace ocst
 		return true;
 	}
 
-	// Pull a stream using Origin map
 	bool Orchestrator::RequestPullStreamWithOriginMap(
 		const std::shared_ptr<const ov::Url> &request_from,
 		const info::VHostAppName &vhost_app_name, const ov::String &stream_name,
 		off_t offset)
+	{
+		// The pulls using the origin map are not coalesced with the pulls using URLs,
+		// since the caller falls back to the origin map store when it fails
+		auto pull_key = ov::String::FormatString("map#%s#%s#%jd", vhost_app_name.CStr(), stream_name.CStr(), static_cast<intmax_t>(offset));
+
+		return CoalescePullRequest(pull_key, [&]() -> bool {
+			return RequestPullStreamWithOriginMapInternal(request_from, vhost_app_name, stream_name, offset);
+		});
+	}
+
+	// Pull a stream using Origin map
+	bool Orchestrator::RequestPullStreamWithOriginMapInternal(
+		const std::shared_ptr<const ov::Url> &request_from,
+		const info::VHostAppName &vhost_app_name, const ov::String &stream_name,
+		off_t offset)
 	{
 		std::shared_ptr<PullProviderModuleInterface> provider_module;
 		auto app_info = info::Application::GetInvalidApplication();
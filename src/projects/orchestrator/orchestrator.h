@@ -12,6 +12,8 @@
 #include <base/provider/provider.h>
 #include <base/publisher/publisher.h>
 
+#include <future>
+
 #include "virtual_host.h"
 #include "module.h"
 
@@ -155,6 +157,21 @@ namespace ocst
 			return RequestPullStreamWithOriginMap(request_from, vhost_app_name, stream_name, 0);
 		}
 		
+		struct PullRequestStats
+		{
+			// Number of pulls actually requested to the providers
+			uint64_t pull_count = 0;
+			// Number of requests that waited for the result of the pull already in progress
+			uint64_t coalesced_waiter_count = 0;
+			// Time taken from the request to the result of the pull (pull setup time)
+			uint64_t total_setup_time_msec = 0;
+			uint64_t max_setup_time_msec = 0;
+			// Number of pulls in progress
+			size_t pending_pull_count = 0;
+		};
+
+		PullRequestStats GetPullRequestStats() const;
+
 		/// Release Pulled Stream
 		CommonErrorCode TerminateStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
 
@@ -208,6 +225,20 @@ namespace ocst
 
 		bool GetUrlListForLocation(const info::VHostAppName &vhost_app_name, const ov::String &host_name, const ov::String &stream_name, Origin &matched_origin, std::vector<ov::String> &url_list);
 
+		bool RequestPullStreamWithUrlsInternal(
+			const std::shared_ptr<const ov::Url> &request_from,
+			const info::VHostAppName &vhost_app_name, const ov::String &stream_name,
+			const std::vector<ov::String> &url_list, off_t offset,
+			const std::shared_ptr<pvd::PullStreamProperties> &properties);
+		bool RequestPullStreamWithOriginMapInternal(
+			const std::shared_ptr<const ov::Url> &request_from,
+			const info::VHostAppName &vhost_app_name, const ov::String &stream_name,
+			off_t offset);
+
+		// Only the first request for the key calls pull_function, the concurrent requests for the same key wait for its result
+		// instead of entering the provider again
+		bool CoalescePullRequest(const ov::String &pull_key, const std::function<bool()> &pull_function);
+
 		// Server Info
 		std::shared_ptr<const cfg::Server> 	_server_config;
 
@@ -227,6 +258,12 @@ namespace ocst
 
 		std::shared_ptr<pvd::Stream> GetProviderStream(const info::VHostAppName &vhost_app_name, const ov::String &stream_name);
 
+		// Pulls in progress
+		// key: <type>#<vhost_app_name>#<stream_name>#<offset>
+		std::map<ov::String, std::shared_future<bool>> _pending_pull_map;
+		PullRequestStats _pull_request_stats;
+		mutable std::mutex _pending_pull_mutex;
+
 		// Module Timer : It is called periodically by the timer
 		ov::DelayQueue _timer{"Orchestrator"};
 	};
@@ -0,0 +1,469 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "ovt_connection.h"
+
+#include <base/ovlibrary/url.h>
+#include <modules/ovt_packetizer/ovt_packetizer.h>
+
+#define OV_LOG_TAG "OvtConnection"
+
+// The receiving thread checks the stop flag at this interval
+#define OVT_CONNECTION_RECV_TIMEOUT_MSEC 500
+#define OVT_CONNECTION_CONNECT_TIMEOUT_MSEC 1500
+#define OVT_CONNECTION_RESPONSE_TIMEOUT_MSEC 3000
+
+namespace pvd
+{
+	std::shared_ptr<OvtConnection> OvtConnection::Create(const std::shared_ptr<ov::SocketPool> &pool, const std::shared_ptr<const ov::Url> &url, bool *is_rejected)
+	{
+		if (is_rejected != nullptr)
+		{
+			*is_rejected = false;
+		}
+
+		if ((pool == nullptr) || (url == nullptr))
+		{
+			return nullptr;
+		}
+
+		auto address = ov::SocketAddress::CreateAndGetFirst(url->Host(), url->Port());
+		auto connection = std::make_shared<OvtConnection>(address);
+
+		connection->_socket = pool->AllocSocket(address.GetFamily());
+
+		if (connection->_socket == nullptr)
+		{
+			logte("Could not create a socket for %s", address.ToString().CStr());
+			return nullptr;
+		}
+
+		if (connection->Connect(OVT_CONNECTION_CONNECT_TIMEOUT_MSEC) == false)
+		{
+			connection->Close();
+			return nullptr;
+		}
+
+		if (connection->RequestMultiplex(url, is_rejected) == false)
+		{
+			connection->Close();
+			return nullptr;
+		}
+
+		logti("A multiplexed connection to the origin has been established : %s", address.ToString().CStr());
+
+		return connection;
+	}
+
+	OvtConnection::OvtConnection(const ov::SocketAddress &address)
+		: _address(address)
+	{
+		_packet_buffer = std::make_shared<ov::Data>(INIT_PACKET_BUFFER_SIZE);
+	}
+
+	OvtConnection::~OvtConnection()
+	{
+		Close();
+	}
+
+	bool OvtConnection::Connect(int timeout_msec)
+	{
+		_socket->SetSockOpt<int>(IPPROTO_TCP, TCP_NODELAY, 1);
+		_socket->SetSockOpt<int>(IPPROTO_TCP, TCP_QUICKACK, 1);
+		_socket->MakeBlocking();
+
+		struct timeval tv = {0, OVT_CONNECTION_RECV_TIMEOUT_MSEC * 1000};
+		_socket->SetRecvTimeout(tv);
+
+		auto error = _socket->Connect(_address, timeout_msec);
+		if (error != nullptr)
+		{
+			logte("Cannot connect to origin server (%s) : (%s)", error->GetMessage().CStr(), _address.ToString().CStr());
+			return false;
+		}
+
+		_connected = true;
+
+		_receive_thread = std::thread(&OvtConnection::ReceiveThread, this);
+		pthread_setname_np(_receive_thread.native_handle(), "OvtConnection");
+
+		return true;
+	}
+
+	bool OvtConnection::RequestMultiplex(const std::shared_ptr<const ov::Url> &url, bool *is_rejected)
+	{
+		auto request_id = IssueRequestId();
+
+		Json::Value root;
+		root["id"] = request_id;
+		root["application"] = "multiplex";
+		root["target"] = url->Source().CStr();
+		root["revision"] = OVT_PROTOCOL_REVISION;
+
+		RegisterRequest(request_id);
+
+		OvtPacketizer packetizer;
+		if (packetizer.PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_REQUEST, ov::Clock::NowMSec(), ov::Json::Stringify(root).ToData(false)) == false)
+		{
+			return false;
+		}
+
+		while (packetizer.IsAvailablePackets())
+		{
+			if (SendPacket(packetizer.PopPacket()) == false)
+			{
+				return false;
+			}
+		}
+
+		auto message = WaitForResponse(request_id, OVT_CONNECTION_RESPONSE_TIMEOUT_MSEC);
+		if (message == nullptr)
+		{
+			logte("Could not receive the response of MULTIPLEX from %s", _address.ToString().CStr());
+			return false;
+		}
+
+		ov::String payload(message->GetDataAs<char>(), message->GetLength());
+		ov::JsonObject object = ov::Json::Parse(payload);
+
+		if (object.IsNull())
+		{
+			logte("An invalid response : Json format");
+			return false;
+		}
+
+		Json::Value &json_code = object.GetJsonValue()["code"];
+		Json::Value &json_revision = object.GetJsonValue()["contents"]["revision"];
+
+		if ((json_code.isUInt() == false) || (json_code.asUInt() != 200) ||
+			(json_revision.isUInt() == false) || (json_revision.asUInt() < OVT_PROTOCOL_REVISION_MULTIPLEXED))
+		{
+			// Legacy origin responds "Unknown application"
+			logti("The origin does not support the multiplexing : %s", _address.ToString().CStr());
+
+			if (is_rejected != nullptr)
+			{
+				*is_rejected = true;
+			}
+
+			return false;
+		}
+
+		return true;
+	}
+
+	uint32_t OvtConnection::IssueRequestId()
+	{
+		return ++_last_request_id;
+	}
+
+	void OvtConnection::RegisterRequest(uint32_t request_id, const std::shared_ptr<ChannelObserver> &observer)
+	{
+		std::lock_guard<std::mutex> lock(_request_mutex);
+		_pending_request_map[request_id] = PendingRequest{observer, nullptr};
+	}
+
+	bool OvtConnection::SendPacket(const std::shared_ptr<OvtPacket> &packet)
+	{
+		if (_connected == false)
+		{
+			return false;
+		}
+
+		return _socket->Send(packet->GetData());
+	}
+
+	std::shared_ptr<ov::Data> OvtConnection::WaitForResponse(uint32_t request_id, int timeout_msec)
+	{
+		std::unique_lock<std::mutex> lock(_request_mutex);
+
+		auto item = _pending_request_map.find(request_id);
+		if (item == _pending_request_map.end())
+		{
+			return nullptr;
+		}
+
+		_response_condition.wait_for(lock, std::chrono::milliseconds(timeout_msec), [&]() {
+			return (item->second.response != nullptr) || (_connected == false);
+		});
+
+		auto response = item->second.response;
+		_pending_request_map.erase(item);
+
+		return response;
+	}
+
+	void OvtConnection::Unsubscribe(uint32_t channel_id)
+	{
+		std::lock_guard<std::mutex> lock(_channel_mutex);
+		_channel_map.erase(channel_id);
+	}
+
+	size_t OvtConnection::GetChannelCount() const
+	{
+		std::lock_guard<std::mutex> lock(_channel_mutex);
+		return _channel_map.size();
+	}
+
+	bool OvtConnection::IsConnected() const
+	{
+		return _connected;
+	}
+
+	const ov::SocketAddress &OvtConnection::GetAddress() const
+	{
+		return _address;
+	}
+
+	void OvtConnection::Close()
+	{
+		_stop_thread_flag = true;
+
+		if (_socket != nullptr)
+		{
+			_socket->Close();
+		}
+
+		if (_receive_thread.joinable() && (_receive_thread.get_id() != std::this_thread::get_id()))
+		{
+			_receive_thread.join();
+		}
+
+		if (_connected.exchange(false))
+		{
+			CloseAllChannels();
+		}
+	}
+
+	void OvtConnection::ReceiveThread()
+	{
+		uint8_t buffer[65535];
+
+		while (_stop_thread_flag == false)
+		{
+			size_t read_bytes = 0ULL;
+
+			auto error = _socket->Recv(buffer, sizeof(buffer), &read_bytes);
+			if (read_bytes == 0)
+			{
+				if (error == nullptr)
+				{
+					// Timed out
+					continue;
+				}
+
+				if (_stop_thread_flag == false)
+				{
+					logte("An error occurred while receiving packet from %s: %s", _address.ToString().CStr(), error->What());
+				}
+
+				break;
+			}
+
+			_packet_buffer->Append(buffer, read_bytes);
+
+			if (ParsePackets() == false)
+			{
+				logte("An error occurred while parsing packet from %s: Invalid packet", _address.ToString().CStr());
+				break;
+			}
+		}
+
+		if (_connected.exchange(false))
+		{
+			CloseAllChannels();
+		}
+	}
+
+	bool OvtConnection::ParsePackets()
+	{
+		while (_packet_buffer->GetLength() >= OVT_FIXED_HEADER_SIZE)
+		{
+			auto packet = std::make_shared<OvtPacket>();
+
+			if (packet->Load(*_packet_buffer) == false)
+			{
+				// Not enough data to parse yet if the header is available
+				return packet->IsHeaderAvailable();
+			}
+
+			if (_packet_buffer->GetLength() == packet->PacketLength())
+			{
+				_packet_buffer->Clear();
+			}
+			else
+			{
+				_packet_buffer = _packet_buffer->Subdata(packet->PacketLength());
+			}
+
+			switch (packet->PayloadType())
+			{
+				case OVT_PAYLOAD_TYPE_MESSAGE_REQUEST:
+				case OVT_PAYLOAD_TYPE_MESSAGE_RESPONSE:
+					if (_message_depacketizer.AppendPacket(packet->GetData()) == false)
+					{
+						return false;
+					}
+
+					while (_message_depacketizer.IsAvailableMessage())
+					{
+						HandleMessage(_message_depacketizer.PopMessage());
+					}
+					break;
+
+				case OVT_PAYLOAD_TYPE_MEDIA_PACKET:
+					HandleMediaPacket(packet);
+					break;
+
+				default:
+					break;
+			}
+		}
+
+		return true;
+	}
+
+	void OvtConnection::HandleMessage(const std::shared_ptr<ov::Data> &message)
+	{
+		ov::String payload(message->GetDataAs<char>(), message->GetLength());
+		ov::JsonObject object = ov::Json::Parse(payload);
+
+		if (object.IsNull())
+		{
+			logtw("An invalid message : Json format");
+			return;
+		}
+
+		auto &json_root = object.GetJsonValue();
+		auto &json_id = json_root["id"];
+		auto &json_application = json_root["application"];
+		auto &json_channel_id = json_root["contents"]["channelId"];
+
+		if ((json_id.isUInt() == false) || (json_application.isString() == false))
+		{
+			logtw("An invalid message : There are no required keys");
+			return;
+		}
+
+		ov::String application = json_application.asString().c_str();
+		auto request_id = json_id.asUInt();
+
+		if (request_id == 0)
+		{
+			// Notification from the origin
+			if ((application.UpperCaseString() == "STOP") && json_channel_id.isUInt())
+			{
+				std::shared_ptr<ChannelObserver> observer;
+
+				{
+					std::lock_guard<std::mutex> lock(_channel_mutex);
+					auto item = _channel_map.find(json_channel_id.asUInt());
+					if (item != _channel_map.end())
+					{
+						observer = item->second.observer.lock();
+						_channel_map.erase(item);
+					}
+				}
+
+				if (observer != nullptr)
+				{
+					observer->OnChannelClosed();
+				}
+			}
+
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(_request_mutex);
+
+		auto item = _pending_request_map.find(request_id);
+		if (item == _pending_request_map.end())
+		{
+			// The request has been timed out
+			logtd("The response of the request (%u) is not expected", request_id);
+			return;
+		}
+
+		auto &pending_request = item->second;
+
+		// The channel must be subscribed before the next packet is parsed, since the media packets of the channel follow the response
+		if ((pending_request.observer != nullptr) && (application.UpperCaseString() == "PLAY") &&
+			json_root["code"].isUInt() && (json_root["code"].asUInt() == 200) && json_channel_id.isUInt())
+		{
+			std::lock_guard<std::mutex> channel_lock(_channel_mutex);
+			_channel_map[json_channel_id.asUInt()] = Channel{pending_request.observer, std::make_shared<OvtDepacketizer>()};
+		}
+
+		pending_request.response = message;
+		_response_condition.notify_all();
+	}
+
+	void OvtConnection::HandleMediaPacket(const std::shared_ptr<OvtPacket> &packet)
+	{
+		std::shared_ptr<ChannelObserver> observer;
+		std::shared_ptr<OvtDepacketizer> depacketizer;
+
+		{
+			std::lock_guard<std::mutex> lock(_channel_mutex);
+			auto item = _channel_map.find(packet->SessionId());
+			if (item == _channel_map.end())
+			{
+				// Unsubscribed
+				return;
+			}
+
+			observer = item->second.observer.lock();
+			depacketizer = item->second.depacketizer;
+		}
+
+		if (observer == nullptr)
+		{
+			return;
+		}
+
+		if (depacketizer->AppendPacket(packet->GetData()) == false)
+		{
+			logte("An error occurred while parsing the media packet of the channel (%u)", packet->SessionId());
+
+			Unsubscribe(packet->SessionId());
+			observer->OnChannelClosed();
+			return;
+		}
+
+		while (depacketizer->IsAvailableMediaPacket())
+		{
+			observer->OnChannelMediaPacket(depacketizer->PopMediaPacket());
+		}
+	}
+
+	void OvtConnection::CloseAllChannels()
+	{
+		{
+			// Wakes up the requesters
+			std::lock_guard<std::mutex> lock(_request_mutex);
+			_response_condition.notify_all();
+		}
+
+		std::map<uint32_t, Channel> channel_map;
+
+		{
+			std::lock_guard<std::mutex> lock(_channel_mutex);
+			channel_map = std::move(_channel_map);
+			_channel_map.clear();
+		}
+
+		for (auto &[channel_id, channel] : channel_map)
+		{
+			auto observer = channel.observer.lock();
+			if (observer != nullptr)
+			{
+				observer->OnChannelClosed();
+			}
+		}
+	}
+}  // namespace pvd
@@ -0,0 +1,104 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Getroot
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/mediarouter/media_buffer.h>
+#include <base/ovlibrary/ovlibrary.h>
+#include <base/ovsocket/ovsocket.h>
+#include <modules/ovt_packetizer/ovt_depacketizer.h>
+#include <modules/ovt_packetizer/ovt_packet.h>
+#include <modules/ovt_packetizer/ovt_signaling.h>
+
+namespace pvd
+{
+	// A connection to an origin which is shared by the OvtStreams pulling from the origin (OVT_PROTOCOL_REVISION_MULTIPLEXED)
+	//
+	// - The requests of the streams are identified by the request ID issued by the connection
+	// - The media packets are classified by the channel ID (SI) responded with PLAY, and delivered to the observer of the channel
+	//   from the receiving thread of the connection
+	class OvtConnection
+	{
+	public:
+		class ChannelObserver
+		{
+		public:
+			virtual void OnChannelMediaPacket(const std::shared_ptr<MediaPacket> &media_packet) = 0;
+			// The stream has been stopped by the origin, or the connection has been lost
+			virtual void OnChannelClosed() = 0;
+		};
+
+		// Connects to the origin and negotiates the multiplexing (MULTIPLEX)
+		// Returns nullptr if the origin could not be connected or does not support the multiplexing
+		// is_rejected is set to true only if the origin has responded that it does not support the multiplexing
+		static std::shared_ptr<OvtConnection> Create(const std::shared_ptr<ov::SocketPool> &pool, const std::shared_ptr<const ov::Url> &url, bool *is_rejected = nullptr);
+
+		OvtConnection(const ov::SocketAddress &address);
+		~OvtConnection();
+
+		uint32_t IssueRequestId();
+
+		// Keeps the response of the request to be received by WaitForResponse()
+		// If the observer is set, the channel in the response of PLAY is subscribed by the observer
+		void RegisterRequest(uint32_t request_id, const std::shared_ptr<ChannelObserver> &observer = nullptr);
+		bool SendPacket(const std::shared_ptr<OvtPacket> &packet);
+		// Returns nullptr if the response is not received within the timeout
+		std::shared_ptr<ov::Data> WaitForResponse(uint32_t request_id, int timeout_msec);
+
+		void Unsubscribe(uint32_t channel_id);
+		size_t GetChannelCount() const;
+
+		bool IsConnected() const;
+		const ov::SocketAddress &GetAddress() const;
+
+		void Close();
+
+	private:
+		struct PendingRequest
+		{
+			std::shared_ptr<ChannelObserver> observer;
+			std::shared_ptr<ov::Data> response;
+		};
+
+		struct Channel
+		{
+			std::weak_ptr<ChannelObserver> observer;
+			std::shared_ptr<OvtDepacketizer> depacketizer;
+		};
+
+		bool Connect(int timeout_msec);
+		bool RequestMultiplex(const std::shared_ptr<const ov::Url> &url, bool *is_rejected);
+
+		void ReceiveThread();
+		bool ParsePackets();
+		void HandleMessage(const std::shared_ptr<ov::Data> &message);
+		void HandleMediaPacket(const std::shared_ptr<OvtPacket> &packet);
+		// Notifies all channels that the connection has been lost
+		void CloseAllChannels();
+
+		ov::SocketAddress _address;
+		std::shared_ptr<ov::Socket> _socket;
+
+		std::atomic<bool> _connected{false};
+		std::atomic<bool> _stop_thread_flag{false};
+		std::thread _receive_thread;
+
+		std::atomic<uint32_t> _last_request_id{0};
+
+		mutable std::mutex _request_mutex;
+		std::condition_variable _response_condition;
+		std::map<uint32_t, PendingRequest> _pending_request_map;
+
+		mutable std::mutex _channel_mutex;
+		std::map<uint32_t, Channel> _channel_map;
+
+		// Only accessed by the receiving thread
+		std::shared_ptr<ov::Data> _packet_buffer;
+		OvtDepacketizer _message_depacketizer;
+	};
+}  // namespace pvd
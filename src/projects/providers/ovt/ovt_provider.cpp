@@ -59,6 +59,121 @@ namespace pvd
 		return _client_socket_pool;
 	}
 
+	std::shared_ptr<OvtConnection> OvtProvider::AcquireMultiplexedConnection(const std::shared_ptr<const ov::Url> &url)
+	{
+		auto pool = GetClientSocketPool();
+		if (pool == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto key = ov::String::FormatString("%s:%u", url->Host().CStr(), url->Port());
+
+		while (true)
+		{
+			std::unique_lock<std::mutex> lock(_multiplexed_connection_map_lock);
+			auto now = static_cast<int64_t>(ov::Clock::NowMSec());
+
+			auto legacy_item = _legacy_origin_map.find(key);
+			if (legacy_item != _legacy_origin_map.end())
+			{
+				if ((now - legacy_item->second) < LEGACY_ORIGIN_RECHECK_INTERVAL_MSEC)
+				{
+					return nullptr;
+				}
+
+				_legacy_origin_map.erase(legacy_item);
+			}
+
+			auto item = _multiplexed_connection_map.find(key);
+			if (item != _multiplexed_connection_map.end())
+			{
+				if (item->second.connection->IsConnected())
+				{
+					item->second.ref_count++;
+					return item->second.connection;
+				}
+
+				// The connection has been lost, the streams using it will release it
+				_multiplexed_connection_map.erase(item);
+			}
+
+			auto pending_item = _pending_connection_map.find(key);
+			if (pending_item != _pending_connection_map.end())
+			{
+				// Another stream is connecting to the origin
+				auto pending_connection = pending_item->second;
+				lock.unlock();
+
+				if (pending_connection.get() == nullptr)
+				{
+					return nullptr;
+				}
+
+				// Takes a reference of the established connection
+				continue;
+			}
+
+			std::promise<std::shared_ptr<OvtConnection>> promise;
+			_pending_connection_map[key] = promise.get_future().share();
+			lock.unlock();
+
+			// Connecting may take a few seconds, so it is done without the lock
+			bool is_rejected = false;
+			auto connection = OvtConnection::Create(pool, url, &is_rejected);
+
+			lock.lock();
+			_pending_connection_map.erase(key);
+
+			if (connection != nullptr)
+			{
+				_multiplexed_connection_map[key] = MultiplexedConnection{connection, 1};
+			}
+			else if (is_rejected)
+			{
+				// Only the origin which has responded that it does not support the multiplexing is regarded as legacy.
+				// If it could not be connected or did not respond in time, it is asked again by the next stream
+				_legacy_origin_map[key] = static_cast<int64_t>(ov::Clock::NowMSec());
+			}
+
+			lock.unlock();
+
+			promise.set_value(connection);
+
+			return connection;
+		}
+	}
+
+	void OvtProvider::ReleaseMultiplexedConnection(const std::shared_ptr<OvtConnection> &connection)
+	{
+		std::shared_ptr<OvtConnection> connection_to_close;
+
+		{
+			std::lock_guard<std::mutex> lock(_multiplexed_connection_map_lock);
+
+			auto item = std::find_if(_multiplexed_connection_map.begin(), _multiplexed_connection_map.end(), [&](const auto &pair) {
+				return pair.second.connection == connection;
+			});
+
+			if (item == _multiplexed_connection_map.end())
+			{
+				// Already removed from the map since the connection has been lost
+				connection_to_close = connection;
+			}
+			else if (--item->second.ref_count == 0)
+			{
+				connection_to_close = connection;
+				_multiplexed_connection_map.erase(item);
+			}
+		}
+
+		if ((connection_to_close != nullptr) && connection_to_close->IsConnected() && (connection_to_close->GetChannelCount() == 0))
+		{
+			logti("The multiplexed connection to the origin is closed : %s", connection_to_close->GetAddress().ToString().CStr());
+			connection_to_close->Close();
+		}
+	}
+
 	bool OvtProvider::OnCreateHost(const info::Host &host_info)
 	{
 		return true;
@@ -10,6 +10,10 @@
 #include <base/provider/pull_provider/provider.h>
 #include <orchestrator/orchestrator.h>
 
+#include <future>
+
+#include "ovt_connection.h"
+
 /*
  * OvtProvider
  * 		: Create PhysicalPort, OvtApplication
@@ -24,6 +28,9 @@
  * 				: Send packets by OvtProvider::PhysicalPort
  * 				: Receive packets from OvtProvider -> OvtApplication -> OvtStream -> Queue
  *
+ * OvtConnection
+ * 		: One connection per origin shared by the OvtStreams (if the origin supports OVT_PROTOCOL_REVISION_MULTIPLEXED)
+ *
  */
 
 namespace pvd
@@ -53,6 +60,12 @@ namespace pvd
 
 		std::shared_ptr<ov::SocketPool> GetClientSocketPool();
 
+		// Returns the multiplexed connection to the origin of the url (creates it if there is no connection)
+		// Returns nullptr if the origin does not support the multiplexing, then the stream uses its own connection
+		std::shared_ptr<OvtConnection> AcquireMultiplexedConnection(const std::shared_ptr<const ov::Url> &url);
+		// The connection is closed when it is released by all streams
+		void ReleaseMultiplexedConnection(const std::shared_ptr<OvtConnection> &connection);
+
 	protected:
 		bool OnCreateHost(const info::Host &host_info) override;
 		bool OnDeleteHost(const info::Host &host_info) override;
@@ -61,5 +74,25 @@ namespace pvd
 
 		std::shared_ptr<ov::SocketPool> _client_socket_pool = nullptr;
 		int _worker_count = 1;
+
+	private:
+		// The origins which do not support the multiplexing are not asked again for a while
+		static constexpr int64_t LEGACY_ORIGIN_RECHECK_INTERVAL_MSEC = 60 * 1000;
+
+		struct MultiplexedConnection
+		{
+			std::shared_ptr<OvtConnection> connection;
+			// The number of the streams using the connection
+			size_t ref_count = 0;
+		};
+
+		std::mutex _multiplexed_connection_map_lock;
+		// key : host:port of the origin
+		std::map<ov::String, MultiplexedConnection> _multiplexed_connection_map;
+		// key : host:port of the origin, value : the connection being established without the lock
+		// The streams of the same origin wait for it instead of connecting by themselves
+		std::map<ov::String, std::shared_future<std::shared_ptr<OvtConnection>>> _pending_connection_map;
+		// key : host:port of the origin, value : the time (msec) the origin is found not to support the multiplexing
+		std::map<ov::String, int64_t> _legacy_origin_map;
 	};
 }  // namespace pvd
\ No newline at end of file
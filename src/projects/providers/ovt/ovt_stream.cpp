@@ -65,6 +65,19 @@ namespace pvd
 			_packetizer->Release();
 			_packetizer.reset();
 		}
+
+		if (_connection != nullptr)
+		{
+			if (_channel_id.has_value())
+			{
+				_connection->Unsubscribe(_channel_id.value());
+				_channel_id.reset();
+			}
+
+			// The connection is closed if no other stream uses it
+			GetOvtProvider()->ReleaseMultiplexedConnection(_connection);
+			_connection.reset();
+		}
 	}
 
 	bool OvtStream::StartStream(const std::shared_ptr<const ov::Url> &url)
@@ -82,6 +95,13 @@ namespace pvd
 			_packetizer = std::make_shared<OvtPacketizer>(OvtPacketizerInterface::GetSharedPtr());
 		}
 
+		_channel_closed = false;
+		{
+			std::lock_guard<std::mutex> lock(_channel_media_packet_lock);
+			_channel_media_packet_queue = {};
+			_channel_media_packet_direct = false;
+		}
+
 		ov::StopWatch stop_watch;
 
 		// For statistics
@@ -105,6 +125,7 @@ namespace pvd
 		if (!RequestPlay())
 		{
 			SetState(Stream::State::ERROR);
+			Release();
 			return false;
 		}
 		_origin_response_time_msec = stop_watch.Elapsed();
@@ -182,6 +203,17 @@ namespace pvd
 			return false;
 		}
 
+		// Shares the connection with the other streams if the origin supports the multiplexing
+		_connection = GetOvtProvider()->AcquireMultiplexedConnection(_curr_url);
+		_multiplexed = (_connection != nullptr);
+
+		if (_connection != nullptr)
+		{
+			logti("%s/%s(%u) - Uses the multiplexed connection to %s", GetApplicationInfo().GetVHostAppName().CStr(), GetName().CStr(), GetId(), _connection->GetAddress().ToString().CStr());
+			SetState(State::CONNECTED);
+			return true;
+		}
+
 		auto socket_address = ov::SocketAddress::CreateAndGetFirst(_curr_url->Host(), _curr_url->Port());
 
 		_client_socket = pool->AllocSocket(socket_address.GetFamily());
@@ -224,13 +256,18 @@ namespace pvd
 
 		Json::Value root;
 
-		_last_request_id++;
+		_last_request_id = IssueRequestId();
 		root["id"] = _last_request_id;
 		root["application"] = "describe";
 		root["target"] = _curr_url->Source().CStr();
 
 		auto message = ov::Json::Stringify(root).ToData(false);
 
+		if (_connection != nullptr)
+		{
+			_connection->RegisterRequest(_last_request_id);
+		}
+
 		std::shared_lock<std::shared_mutex> lock(_packetizer_lock);
 		if (_packetizer->PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_REQUEST, ov::Clock::NowMSec(), message) == false)
 		{
@@ -504,13 +541,20 @@ namespace pvd
 		}
 
 		Json::Value root;
-		_last_request_id++;
+		_last_request_id = IssueRequestId();
 		root["id"] = _last_request_id;
 		root["application"] = "play";
 		root["target"] = _curr_url->Source().CStr();
+		root["revision"] = OVT_PROTOCOL_REVISION;
 
 		auto message = ov::Json::Stringify(root).ToData(false);
 
+		if (_connection != nullptr)
+		{
+			// The channel is subscribed by the connection as soon as the response is received
+			_connection->RegisterRequest(_last_request_id, OvtPacketizerInterface::GetSharedPtrAs<OvtConnection::ChannelObserver>());
+		}
+
 		std::shared_lock<std::shared_mutex> lock(_packetizer_lock);
 		if (_packetizer->PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_REQUEST, ov::Clock::NowMSec(), message) == false)
 		{
@@ -528,6 +572,14 @@ namespace pvd
 		{
 			logte("%s/%s(%u) - Could not receive message", GetApplicationInfo().GetVHostAppName().CStr(), GetName().CStr(), GetId());
 			SetState(State::ERROR);
+
+			if (_connection != nullptr)
+			{
+				// The origin may have added the session to the shared connection after the timeout,
+				// so it is stopped before the connection is released
+				SendStopRequest();
+			}
+
 			return false;
 		}
 
@@ -577,6 +629,25 @@ namespace pvd
 			return false;
 		}
 
+		// Origins which do not know the revision do not respond it
+		auto &json_revision = object.GetJsonValue()["contents"]["revision"];
+		_protocol_revision = json_revision.isUInt() ? json_revision.asUInt() : OVT_PROTOCOL_REVISION_LEGACY;
+
+		if (_connection != nullptr)
+		{
+			auto &json_channel_id = object.GetJsonValue()["contents"]["channelId"];
+			if (json_channel_id.isUInt() == false)
+			{
+				SetState(State::ERROR);
+				logte("An invalid response : There is no channel ID in the multiplexed connection");
+				return false;
+			}
+
+			_channel_id = json_channel_id.asUInt();
+		}
+
+		logtd("%s/%s(%u) - OVT protocol revision : %u", GetApplicationInfo().GetVHostAppName().CStr(), GetName().CStr(), GetId(), _protocol_revision);
+
 		SetState(State::PLAYING);
 		return true;
 	}
@@ -588,8 +659,13 @@ namespace pvd
 			return false;
 		}
 
+		return SendStopRequest();
+	}
+
+	bool OvtStream::SendStopRequest()
+	{
 		Json::Value root;
-		_last_request_id++;
+		_last_request_id = IssueRequestId();
 		root["id"] = _last_request_id;
 		root["application"] = "stop";
 		root["target"] = _curr_url->Source().CStr();
@@ -607,7 +683,9 @@ namespace pvd
 
 	bool OvtStream::OnOvtPacketized(std::shared_ptr<OvtPacket> &packet)
 	{
-		if (_client_socket->Send(packet->GetData()) == false)
+		auto result = (_connection != nullptr) ? _connection->SendPacket(packet) : _client_socket->Send(packet->GetData());
+
+		if (result == false)
 		{
 			SetState(State::ERROR);
 			logte("Could not send message");
@@ -617,8 +695,45 @@ namespace pvd
 		return true;
 	}
 
+	uint32_t OvtStream::IssueRequestId()
+	{
+		// The request ID must be unique in the multiplexed connection
+		return (_connection != nullptr) ? _connection->IssueRequestId() : (_last_request_id + 1);
+	}
+
+	void OvtStream::OnChannelMediaPacket(const std::shared_ptr<MediaPacket> &media_packet)
+	{
+		std::lock_guard<std::mutex> lock(_channel_media_packet_lock);
+
+		if (_channel_media_packet_direct == false)
+		{
+			_channel_media_packet_queue.push(media_packet);
+			return;
+		}
+
+		DeliverMediaPacket(media_packet);
+	}
+
+	void OvtStream::OnChannelClosed()
+	{
+		logti("%s/%s(%u) - The channel of the multiplexed connection has been closed", GetApplicationInfo().GetVHostAppName().CStr(), GetName().CStr(), GetId());
+		_channel_closed = true;
+	}
+
 	std::shared_ptr<ov::Data> OvtStream::ReceiveMessage()
 	{
+		if (_connection != nullptr)
+		{
+			auto message = _connection->WaitForResponse(_last_request_id, OVT_TIMEOUT_MSEC);
+			if (message == nullptr)
+			{
+				logte("%s/%s(%u) - Could not receive the response (%u)", GetApplicationInfo().GetVHostAppName().CStr(), GetName().CStr(), GetId(), _last_request_id);
+				SetState(State::ERROR);
+			}
+
+			return message;
+		}
+
 		while (true)
 		{
 			auto result = ReceivePacket();
@@ -680,11 +795,56 @@ namespace pvd
 
 	int OvtStream::GetFileDescriptorForDetectingEvent()
 	{
-		return _client_socket->GetNativeHandle();
+		return (_client_socket != nullptr) ? _client_socket->GetNativeHandle() : -1;
+	}
+
+	void OvtStream::DeliverMediaPacket(const std::shared_ptr<MediaPacket> &media_packet)
+	{
+		media_packet->SetMsid(GetMsid());
+		media_packet->SetPacketType(cmn::PacketType::OVT);
+
+		int64_t pts = media_packet->GetPts();
+		int64_t dts = media_packet->GetDts();
+		int64_t duration = media_packet->GetDuration();
+
+		AdjustTimestampByBase(media_packet->GetTrackId(), pts, dts, std::numeric_limits<int64_t>::max(), duration);
+		[[maybe_unused]] auto old_pts = media_packet->GetPts();
+		[[maybe_unused]] auto old_dts = media_packet->GetDts();
+
+		media_packet->SetPts(pts);
+		media_packet->SetDts(dts);
+		media_packet->SetDuration(-1); // Duration should be set by MediaRouter again due to the AdjustTimestampByBase
+
+		logtd("[%s/%s(%u)] ProcessMediaPacket : TrackId(%d) ORI_PTS(%lld) PTS(%lld) ORI_DTS(%lld) DTS(%lld) Size(%zu) MSID(%u)",
+			  GetApplicationInfo().GetVHostAppName().CStr(), GetName().CStr(), GetId(),
+			  media_packet->GetTrackId(), old_pts, media_packet->GetPts(), old_dts, media_packet->GetDts(), media_packet->GetDataLength(), GetMsid());
+
+		SendFrame(media_packet);
 	}
 
 	PullStream::ProcessMediaResult OvtStream::ProcessMediaPacket()
 	{
+		if (_multiplexed)
+		{
+			if (_channel_closed)
+			{
+				return PullStream::ProcessMediaResult::PROCESS_MEDIA_FINISH;
+			}
+
+			// From now on, the packets are delivered by the receiving thread of the connection
+			std::lock_guard<std::mutex> lock(_channel_media_packet_lock);
+
+			while (_channel_media_packet_queue.empty() == false)
+			{
+				DeliverMediaPacket(_channel_media_packet_queue.front());
+				_channel_media_packet_queue.pop();
+			}
+
+			_channel_media_packet_direct = true;
+
+			return PullStream::ProcessMediaResult::PROCESS_MEDIA_TRY_AGAIN;
+		}
+
 		// Non block
 		auto result = ReceivePacket(true);
 		if (result == false)
@@ -698,28 +858,7 @@ namespace pvd
 		{
 			if (_depacketizer.IsAvailableMediaPacket()) 
 			{
-				auto media_packet = _depacketizer.PopMediaPacket();
-
-				media_packet->SetMsid(GetMsid());
-				media_packet->SetPacketType(cmn::PacketType::OVT);
-
-				int64_t pts = media_packet->GetPts();
-				int64_t dts = media_packet->GetDts();
-				int64_t duration = media_packet->GetDuration();
-
-				AdjustTimestampByBase(media_packet->GetTrackId(), pts, dts, std::numeric_limits<int64_t>::max(), duration);
-				[[maybe_unused]] auto old_pts = media_packet->GetPts();
-				[[maybe_unused]] auto old_dts = media_packet->GetDts();
-
-				media_packet->SetPts(pts);
-				media_packet->SetDts(dts);
-				media_packet->SetDuration(-1); // Duration should be set by MediaRouter again due to the AdjustTimestampByBase
-
-				logtd("[%s/%s(%u)] ProcessMediaPacket : TrackId(%d) ORI_PTS(%lld) PTS(%lld) ORI_DTS(%lld) DTS(%lld) Size(%zu) MSID(%u)",
-					  GetApplicationInfo().GetVHostAppName().CStr(), GetName().CStr(), GetId(),
-					  media_packet->GetTrackId(), old_pts, media_packet->GetPts(), old_dts, media_packet->GetDts(), media_packet->GetDataLength(), GetMsid());
-
-				SendFrame(media_packet);
+				DeliverMediaPacket(_depacketizer.PopMediaPacket());
 
 				if (_depacketizer.IsAvailableMediaPacket() || _depacketizer.IsAvailableMessage())
 				{
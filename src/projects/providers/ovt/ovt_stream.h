@@ -10,18 +10,21 @@
 #include <modules/ovt_packetizer/ovt_packet.h>
 #include <modules/ovt_packetizer/ovt_packetizer.h>
 #include <modules/ovt_packetizer/ovt_depacketizer.h>
+#include <modules/ovt_packetizer/ovt_signaling.h>
 #include <monitoring/monitoring.h>
 
 #include <base/provider/pull_provider/application.h>
 #include <base/provider/pull_provider/stream.h>
 
+#include "ovt_connection.h"
+
 #define OVT_TIMEOUT_MSEC		3000
 
 namespace pvd
 {
 	class OvtProvider;
 
-	class OvtStream : public pvd::PullStream, public OvtPacketizerInterface
+	class OvtStream : public pvd::PullStream, public OvtPacketizerInterface, public OvtConnection::ChannelObserver
 	{
 	public:
 		static std::shared_ptr<OvtStream> Create(const std::shared_ptr<pvd::PullApplication> &application, const uint32_t stream_id, const ov::String &stream_name,	const std::vector<ov::String> &url_list, const std::shared_ptr<pvd::PullStreamProperties> &properties);
@@ -31,8 +34,13 @@ namespace pvd
 
 		bool OnOvtPacketized(std::shared_ptr<OvtPacket> &packet) override;
 
+		// OvtConnection::ChannelObserver
+		void OnChannelMediaPacket(const std::shared_ptr<MediaPacket> &media_packet) override;
+		void OnChannelClosed() override;
+
 		ProcessMediaEventTrigger GetProcessMediaEventTriggerMode() override {
-			return ProcessMediaEventTrigger::TRIGGER_EPOLL;
+			// The packets of the multiplexed connection are delivered by the receiving thread of the connection
+			return _multiplexed ? ProcessMediaEventTrigger::TRIGGER_INTERVAL : ProcessMediaEventTrigger::TRIGGER_EPOLL;
 		}
 
 		int GetFileDescriptorForDetectingEvent() override;
@@ -65,17 +73,36 @@ namespace pvd
 		bool RequestPlay();
 		bool ReceivePlay(uint32_t request_id);
 		bool RequestStop();
+		// Sends STOP regardless of the state
+		bool SendStopRequest();
 		bool ReceiveStop(uint32_t request_id, const std::shared_ptr<OvtPacket> &packet);
 		
 		bool ReceivePacket(bool non_block = false);
 		std::shared_ptr<ov::Data> ReceiveMessage();
 
+		uint32_t IssueRequestId();
+		// Adjusts the timestamp of the media packet received from the origin and sends it to the MediaRouter
+		void DeliverMediaPacket(const std::shared_ptr<MediaPacket> &media_packet);
+
 		void Release();
 
 		std::shared_ptr<ov::Socket> _client_socket = nullptr;
 		std::shared_ptr<const ov::Url> _curr_url = nullptr;
 
+		// Multiplexed connection shared with the other streams of the origin (instead of _client_socket)
+		std::shared_ptr<OvtConnection> _connection = nullptr;
+		std::atomic<bool> _multiplexed{false};
+		std::optional<uint32_t> _channel_id;
+		std::atomic<bool> _channel_closed{false};
+
+		// The media packets received before the stream is driven by the StreamMotor are kept until ProcessMediaPacket()
+		std::mutex _channel_media_packet_lock;
+		std::queue<std::shared_ptr<MediaPacket>> _channel_media_packet_queue;
+		bool _channel_media_packet_direct = false;
+
 		uint32_t _last_request_id;
+		// OVT_PROTOCOL_REVISION_XXX responded by the origin
+		uint32_t _protocol_revision = OVT_PROTOCOL_REVISION_LEGACY;
 
 		int64_t _origin_request_time_msec = 0;
 		int64_t _origin_response_time_msec = 0;
@@ -107,46 +107,18 @@ namespace pvd
 		_curr_url = url;
 		_sent_sequence_header = false;
 
-		ov::StopWatch stop_watch;
+		_pending_request = nullptr;
+		_setup_media_index = 0;
+		_interleaved_channel = 0;
 
-		stop_watch.Start();
-		if (ConnectTo() == false)
-		{
-			return false;
-		}
-		_origin_request_time_msec = stop_watch.Elapsed();
-
-		stop_watch.Update();
-
-		if (RequestDescribe() == false)
-		{
-			Release();
-			return false;
-		}
-
-		if (RequestSetup() == false)
-		{
-			Release();
-			return false;
-		}
+		auto &rtsp_pull_config = GetApplicationInfo().GetConfig().GetProviders().GetRtspPullProvider();
+		_connect_timeout_msec = rtsp_pull_config.GetConnectTimeout();
+		_request_timeout_msec = rtsp_pull_config.GetRequestTimeout();
 
-		if (RequestPlay() == false)
-		{
-			Release();
-			return false;
-		}
-
-		_origin_response_time_msec = stop_watch.Elapsed();
-
-		// Stream was created completly
-		_stream_metrics = StreamMetrics(*std::static_pointer_cast<info::Stream>(PullStream::GetSharedPtr()));
-		if (_stream_metrics != nullptr)
-		{
-			_stream_metrics->SetOriginConnectionTimeMSec(_origin_request_time_msec);
-			_stream_metrics->SetOriginSubscribeTimeMSec(_origin_response_time_msec);
-		}
+		_start_stop_watch.Start();
 
-		return true;
+		// The rest of the steps are continued by ContinueStartStream()
+		return ConnectTo();
 	}
 
 	bool RtspcStream::RestartStream(const std::shared_ptr<const ov::Url> &url)
@@ -175,6 +147,106 @@ namespace pvd
 		return true;
 	}
 
+	PullStream::ProcessMediaResult RtspcStream::ContinueStartStream()
+	{
+		if (_connection_observer == nullptr)
+		{
+			return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+		}
+
+		auto connection_state = _connection_observer->GetState();
+		if (connection_state == ConnectionObserver::State::Failed)
+		{
+			SetState(State::ERROR);
+			logte("Cannot connect to server (%s) : %s:%d", _connection_observer->GetErrorMessage().CStr(), _curr_url->Host().CStr(), _curr_url->Port());
+			return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+		}
+		else if (connection_state == ConnectionObserver::State::Closed)
+		{
+			SetState(State::ERROR);
+			logte("The connection to the rtsp server(%s) has been closed while starting the stream", _curr_url->ToUrlString().CStr());
+			return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+		}
+
+		if (static_cast<int64_t>(ov::Clock::NowMSec()) > _start_step_deadline_msec)
+		{
+			SetState(State::ERROR);
+
+			if (_start_step == StartStep::Connecting)
+			{
+				logte("Cannot connect to server (timed out after %" PRId64 " ms) : %s:%d", _connect_timeout_msec, _curr_url->Host().CStr(), _curr_url->Port());
+			}
+			else
+			{
+				logte("No response(CSeq : %u) was received from the rtsp server(%s) within %" PRId64 " ms",
+					  (_pending_request != nullptr) ? _pending_request->GetCSeq() : 0, _curr_url->ToUrlString().CStr(), _request_timeout_msec);
+			}
+
+			return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+		}
+
+		if (_start_step == StartStep::Connecting)
+		{
+			if (connection_state != ConnectionObserver::State::Connected)
+			{
+				return ProcessMediaResult::PROCESS_MEDIA_TRY_AGAIN;
+			}
+
+			_origin_request_time_msec = _start_stop_watch.Elapsed();
+			_start_stop_watch.Update();
+
+			SetState(State::CONNECTED);
+
+			return RequestDescribe() ? ProcessMediaResult::PROCESS_MEDIA_TRY_AGAIN : ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+		}
+
+		if (ReceivePacket() == false)
+		{
+			return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+		}
+
+		// The interleaved data received with the response of PLAY is kept in _rtsp_demuxer, and handled by ProcessMediaPacket()
+		while (_rtsp_demuxer.IsAvailableMessage())
+		{
+			auto reply = _rtsp_demuxer.PopMessage();
+
+			if ((reply->GetMessageType() != RtspMessageType::RESPONSE) || (_pending_request == nullptr) || (reply->GetCSeq() != _pending_request->GetCSeq()))
+			{
+				// Non subscription message, ignore
+				logti("Received Message : %s", reply->DumpHeader().CStr());
+				continue;
+			}
+
+			ProcessMediaResult result;
+
+			switch (_start_step)
+			{
+				case StartStep::Describing:
+					result = OnDescribeResponse(reply);
+					break;
+
+				case StartStep::SettingUp:
+					result = OnSetupResponse(reply);
+					break;
+
+				case StartStep::Playing:
+					result = OnPlayResponse(reply);
+					break;
+
+				default:
+					result = ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+					break;
+			}
+
+			if (result != ProcessMediaResult::PROCESS_MEDIA_TRY_AGAIN)
+			{
+				return result;
+			}
+		}
+
+		return ProcessMediaResult::PROCESS_MEDIA_TRY_AGAIN;
+	}
+
 	bool RtspcStream::ConnectTo()
 	{
 		if (GetState() == State::PLAYING || GetState() == State::TERMINATED)
@@ -214,9 +286,17 @@ namespace pvd
 			return false;
 		}
 
-		_signalling_socket->MakeBlocking();
+		// The socket pool notifies the result of the connection (including the timeout) to _connection_observer,
+		// and the data is received by the StreamMotor without blocking
+		_connection_observer = std::make_shared<ConnectionObserver>();
+		if (_signalling_socket->MakeNonBlocking(_connection_observer) == false)
+		{
+			SetState(State::ERROR);
+			logte("Could not make the socket non-blocking : %s:%d", _curr_url->Host().CStr(), _curr_url->Port());
+			return false;
+		}
 
-		auto error = _signalling_socket->Connect(socket_address, 3000);
+		auto error = _signalling_socket->Connect(socket_address, _connect_timeout_msec);
 		if (error != nullptr)
 		{
 			SetState(State::ERROR);
@@ -224,7 +304,11 @@ namespace pvd
 			return false;
 		}
 
-		SetState(State::CONNECTED);
+		// It must not be ERROR/STOPPED while connecting, otherwise WhiteElephantCollector resumes the stream again
+		SetState(State::IDLE);
+
+		_start_step = StartStep::Connecting;
+		_start_step_deadline_msec = static_cast<int64_t>(ov::Clock::NowMSec()) + _connect_timeout_msec;
 
 		return true;
 	}
@@ -240,81 +324,70 @@ namespace pvd
 		describe->AddHeaderField(std::make_shared<RtspHeaderField>(RtspHeaderFieldType::Accept, "application/sdp"));
 		describe->AddHeaderField(std::make_shared<RtspHeaderField>(RtspHeaderFieldType::UserAgent, RTSP_USER_AGENT_NAME));
 
+		if (_authorization_field != nullptr)
+		{
+			describe->AddHeaderField(_authorization_field);
+		}
+
 		logti("Request Describe : %s", describe->DumpHeader().CStr());
 
-		std::shared_ptr<RtspMessage> reply = nullptr;
-		for (int i = 0; i < 2; i++)
+		if (SendStartRequest(describe, StartStep::Describing) == false)
+		{
+			SetState(State::ERROR);
+			logte("Could not request DESCIBE to RTSP server (%s)", _curr_url->ToUrlString().CStr());
+			return false;
+		}
+
+		return true;
+	}
+
+	PullStream::ProcessMediaResult RtspcStream::OnDescribeResponse(const std::shared_ptr<RtspMessage> &reply)
+	{
+		// Unauthorized, try to authenticate
+		if (reply->GetStatusCode() == 401)
 		{
-			if (SendRequestMessage(describe) == false)
+			// Authorization has been failed
+			if (_authorization_field != nullptr)
 			{
 				SetState(State::ERROR);
-				logte("Could not request DESCIBE to RTSP server (%s)", _curr_url->ToUrlString().CStr());
-				return false;
+				logte("Rtsp server(%s) rejected the describe request : %d(%s) | ID/Password may be incorrect.", _curr_url->ToUrlString().CStr(), reply->GetStatusCode(), reply->GetReasonPhrase().CStr());
+				return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
 			}
 
-			reply = ReceiveResponse(describe->GetCSeq(), 3000);
-			if (reply == nullptr)
+			auto authenticate_field = reply->GetHeaderFieldAs<RtspHeaderWWWAuthenticateField>(RtspHeaderField::FieldTypeToString(RtspHeaderFieldType::WWWAuthenticate));
+			if (authenticate_field == nullptr)
 			{
 				SetState(State::ERROR);
-				logte("No response(CSeq : %u) was received from the rtsp server(%s)", describe->GetCSeq(), _curr_url->ToUrlString().CStr());
-				return false;
+				logte("Rtsp server(%s) rejected the describe request : %d(%s)", _curr_url->ToUrlString().CStr(), reply->GetStatusCode(), reply->GetReasonPhrase().CStr());
+				return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
 			}
-			// Unauthorized, try to authenticate
-			else if (reply->GetStatusCode() == 401)
-			{
-				// Authorization has been failed
-				if (i == 1)
-				{
-					SetState(State::ERROR);
-					logte("Rtsp server(%s) rejected the describe request : %d(%s) | ID/Password may be incorrect.", _curr_url->ToUrlString().CStr(), reply->GetStatusCode(), reply->GetReasonPhrase().CStr());
-					return false;
-				}
-
-				auto authenticate_field = reply->GetHeaderFieldAs<RtspHeaderWWWAuthenticateField>(RtspHeaderField::FieldTypeToString(RtspHeaderFieldType::WWWAuthenticate));
-				if (authenticate_field == nullptr)
-				{
-					SetState(State::ERROR);
-					logte("Rtsp server(%s) rejected the describe request : %d(%s)", _curr_url->ToUrlString().CStr(), reply->GetStatusCode(), reply->GetReasonPhrase().CStr());
-					return false;
-				}
-
-				// Add authorization field
-				if (authenticate_field->GetScheme() == RtspHeaderWWWAuthenticateField::Scheme::Basic)
-				{
-					_authorization_field = RtspHeaderAuthorizationField::CreateRtspBasicAuthorizationField(_curr_url->Id(), _curr_url->Password());
-					describe->AddHeaderField(_authorization_field);
-
-					// Try to send again
-					continue;
-				}
-				else if (authenticate_field->GetScheme() == RtspHeaderWWWAuthenticateField::Scheme::Digest)
-				{
-					_authorization_field = RtspHeaderAuthorizationField::CreateRtspDigestAuthorizationField(_curr_url->Id(), _curr_url->Password(),
-																											describe->GetMethodStr(), describe->GetRequestUri(),
-																											authenticate_field->GetRealm(), authenticate_field->GetNonce());
-					describe->AddHeaderField(_authorization_field);
 
-					// Try to send again
-					continue;
-				}
-				else
-				{
-					SetState(State::ERROR);
-					logte("Rtsp server(%s) rejected the describe request : %d(%s)", _curr_url->ToUrlString().CStr(), reply->GetStatusCode(), reply->GetReasonPhrase().CStr());
-					return false;
-				}
+			// Add authorization field
+			if (authenticate_field->GetScheme() == RtspHeaderWWWAuthenticateField::Scheme::Basic)
+			{
+				_authorization_field = RtspHeaderAuthorizationField::CreateRtspBasicAuthorizationField(_curr_url->Id(), _curr_url->Password());
 			}
-			else if (reply->GetStatusCode() != 200)
+			else if (authenticate_field->GetScheme() == RtspHeaderWWWAuthenticateField::Scheme::Digest)
 			{
-				SetState(State::ERROR);
-				logte("Rtsp server(%s) rejected the describe request : %d(%s)", _curr_url->ToUrlString().CStr(), reply->GetStatusCode(), reply->GetReasonPhrase().CStr());
-				return false;
+				_authorization_field = RtspHeaderAuthorizationField::CreateRtspDigestAuthorizationField(_curr_url->Id(), _curr_url->Password(),
+																										_pending_request->GetMethodStr(), _pending_request->GetRequestUri(),
+																										authenticate_field->GetRealm(), authenticate_field->GetNonce());
 			}
 			else
 			{
-				// Success
-				break;
+				SetState(State::ERROR);
+				logte("Rtsp server(%s) rejected the describe request : %d(%s)", _curr_url->ToUrlString().CStr(), reply->GetStatusCode(), reply->GetReasonPhrase().CStr());
+				return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
 			}
+
+			// Try to send again
+			return RequestDescribe() ? ProcessMediaResult::PROCESS_MEDIA_TRY_AGAIN : ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+		}
+		else if (reply->GetStatusCode() != 200)
+		{
+			SetState(State::ERROR);
+			logte("Rtsp server(%s) rejected the describe request : %d(%s)", _curr_url->ToUrlString().CStr(), reply->GetStatusCode(), reply->GetReasonPhrase().CStr());
+			return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
 		}
 
 		logti("Response Describe : %s", reply->DumpHeader().CStr());
@@ -349,8 +422,8 @@ namespace pvd
 		if (reply->GetBody() == nullptr)
 		{
 			SetState(State::ERROR);
-			logte("There is no SDP in the describe response. Url(%s) CSeq(%d)", _curr_url->ToUrlString().CStr(), describe->GetCSeq());
-			return false;
+			logte("There is no SDP in the describe response. Url(%s) CSeq(%d)", _curr_url->ToUrlString().CStr(), reply->GetCSeq());
+			return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
 		}
 
 		// Parse SDP to add track information
@@ -358,7 +431,7 @@ namespace pvd
 		{
 			SetState(State::ERROR);
 			logte("Parsing of SDP received from rtsp url (%s)failed. ", _curr_url->ToUrlString().CStr());
-			return false;
+			return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
 		}
 
 		logti("SDP : %s\n", reply->GetBody()->ToString().CStr());
@@ -367,7 +440,11 @@ namespace pvd
 
 		SetState(State::DESCRIBED);
 
-		return true;
+		_rtp_rtcp = std::make_shared<RtpRtcp>(RtpRtcpInterface::GetSharedPtr());
+		_setup_media_index = 0;
+		_interleaved_channel = 0;
+
+		return RequestSetup() ? ProcessMediaResult::PROCESS_MEDIA_TRY_AGAIN : ProcessMediaResult::PROCESS_MEDIA_FAILURE;
 	}
 
 	bool RtspcStream::RequestSetup()
@@ -377,13 +454,11 @@ namespace pvd
 			return false;
 		}
 
-		int interleaved_channel = 0;
-
-		_rtp_rtcp = std::make_shared<RtpRtcp>(RtpRtcpInterface::GetSharedPtr());
-
-		auto media_desc_list = _sdp.GetMediaList();
-		for (const auto &media_desc : media_desc_list)
+		auto &media_desc_list = _sdp.GetMediaList();
+		for (; _setup_media_index < media_desc_list.size(); _setup_media_index++)
 		{
+			const auto &media_desc = media_desc_list[_setup_media_index];
+
 			if (media_desc->GetMediaType() == MediaDescription::MediaType::Application || media_desc->GetMediaType() == MediaDescription::MediaType::Unknown)
 			{
 				logtw("Ignored not supported media type : %s", media_desc->GetMediaTypeStr().CStr());
@@ -431,28 +506,19 @@ namespace pvd
 			}
 
 			auto setup = std::make_shared<RtspMessage>(RtspMethod::SETUP, GetNextCSeq(), control_url);
-			if (_authorization_field != nullptr)
-			{
-				// If authorization method is Digest, update the method and uri
-				if (_authorization_field->GetScheme() == RtspHeaderWWWAuthenticateField::Scheme::Digest)
-				{
-					_authorization_field->UpdateDigestAuth(setup->GetMethodStr(), setup->GetRequestUri());
-				}
-
-				setup->AddHeaderField(_authorization_field);
-			}
+			AddAuthorizationField(setup);
 
 			// Now RtspcStream only supports RTP/AVP/TCP;unicast/interleaved(rtp+rtcp)
 			// The chennel id can be used for demuxing, but since it is already demuxing in a different way, it is not saved.
 			setup->AddHeaderField(std::make_shared<RtspHeaderField>(RtspHeaderFieldType::Transport,
-																	ov::String::FormatString("RTP/AVP/TCP;unicast;interleaved=%d-%d;ssrc=%X", interleaved_channel, interleaved_channel + 1, ov::Random::GenerateUInt32())));
+																	ov::String::FormatString("RTP/AVP/TCP;unicast;interleaved=%d-%d;ssrc=%X", _interleaved_channel, _interleaved_channel + 1, ov::Random::GenerateUInt32())));
 			if (_rtsp_session_id.IsEmpty() == false)
 			{
 				setup->AddHeaderField(std::make_shared<RtspHeaderField>(RtspHeaderFieldType::Session, _rtsp_session_id));
 			}
 			setup->AddHeaderField(std::make_shared<RtspHeaderField>(RtspHeaderFieldType::UserAgent, RTSP_USER_AGENT_NAME));
 
-			if (SendRequestMessage(setup) == false)
+			if (SendStartRequest(setup, StartStep::SettingUp) == false)
 			{
 				SetState(State::ERROR);
 				logte("Could not request setup to RTSP server (%s)", _curr_url->ToUrlString().CStr());
@@ -461,177 +527,194 @@ namespace pvd
 
 			logti("Request SETUP : %s", setup->DumpHeader().CStr());
 
-			auto reply = ReceiveResponse(setup->GetCSeq(), 3000);
-			if (reply == nullptr)
-			{
-				SetState(State::ERROR);
-				logte("No response(CSeq : %u) was received from the rtsp server(%s)", setup->GetCSeq(), _curr_url->ToUrlString().CStr());
-				return false;
-			}
-			else if (reply->GetStatusCode() != 200)
-			{
-				SetState(State::ERROR);
-				logte("Rtsp server(%s) rejected the setup request : %d(%s)", _curr_url->ToUrlString().CStr(), reply->GetStatusCode(), reply->GetReasonPhrase().CStr());
-				return false;
-			}
+			// OnSetupResponse() continues with the next media
+			return true;
+		}
 
-			logti("Response SETUP : %s", reply->DumpHeader().CStr());
+		// All medias have been set up
+		if (CompleteSetup() == false)
+		{
+			return false;
+		}
 
-			// Session
-			auto session_field = reply->GetHeaderFieldAs<RtspHeaderSessionField>(RtspHeaderField::FieldTypeToString(RtspHeaderFieldType::Session));
-			if (session_field == nullptr)
-			{
-				_rtsp_session_id = "";
-			}
-			else
-			{
-				// Session  = "Session" ":" session-id [ ";" "timeout" "=" delta-seconds ]
-				_rtsp_session_id = session_field->GetSessionId();
-				// timeout
-				_rtsp_session_timeout_sec = session_field->GetTimeoutDeltaSeconds();
-				if (_rtsp_session_timeout_sec == 0)
-				{
-					_rtsp_session_timeout_sec = DEFAULT_RTSP_SESSION_TIMEOUT_SEC;
-				}
-			}
+		return RequestPlay();
+	}
 
-			// Transport
-			auto transport_field = reply->GetHeaderFieldAs<RtspHeaderTransportField>(RtspHeaderField::FieldTypeToString(RtspHeaderFieldType::Transport));
-			if (transport_field == nullptr)
-			{
-				SetState(State::ERROR);
-				logte("There is no Transport header in the response from the RTSP server(%s)", _curr_url->ToUrlString().CStr());
-				return false;
-			}
-			else
+	PullStream::ProcessMediaResult RtspcStream::OnSetupResponse(const std::shared_ptr<RtspMessage> &reply)
+	{
+		if (reply->GetStatusCode() != 200)
+		{
+			SetState(State::ERROR);
+			logte("Rtsp server(%s) rejected the setup request : %d(%s)", _curr_url->ToUrlString().CStr(), reply->GetStatusCode(), reply->GetReasonPhrase().CStr());
+			return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+		}
+
+		logti("Response SETUP : %s", reply->DumpHeader().CStr());
+
+		// Session
+		auto session_field = reply->GetHeaderFieldAs<RtspHeaderSessionField>(RtspHeaderField::FieldTypeToString(RtspHeaderFieldType::Session));
+		if (session_field == nullptr)
+		{
+			_rtsp_session_id = "";
+		}
+		else
+		{
+			// Session  = "Session" ":" session-id [ ";" "timeout" "=" delta-seconds ]
+			_rtsp_session_id = session_field->GetSessionId();
+			// timeout
+			_rtsp_session_timeout_sec = session_field->GetTimeoutDeltaSeconds();
+			if (_rtsp_session_timeout_sec == 0)
 			{
-				// Some rtsp server ignores this value, so it is unusable
-				// transport_field->GetSsrc();
-				if (transport_field->IsInterleavedParsed())
-				{
-					interleaved_channel = transport_field->GetInterleavedChannelStart();
-				}
+				_rtsp_session_timeout_sec = DEFAULT_RTSP_SESSION_TIMEOUT_SEC;
 			}
+		}
 
-			auto first_payload = media_desc->GetFirstPayload();
-			if (first_payload == nullptr)
+		// Transport
+		auto transport_field = reply->GetHeaderFieldAs<RtspHeaderTransportField>(RtspHeaderField::FieldTypeToString(RtspHeaderFieldType::Transport));
+		if (transport_field == nullptr)
+		{
+			SetState(State::ERROR);
+			logte("There is no Transport header in the response from the RTSP server(%s)", _curr_url->ToUrlString().CStr());
+			return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+		}
+		else
+		{
+			// Some rtsp server ignores this value, so it is unusable
+			// transport_field->GetSsrc();
+			if (transport_field->IsInterleavedParsed())
 			{
-				logte("Failed to get the first Payload type of peer sdp");
-				return false;
+				_interleaved_channel = transport_field->GetInterleavedChannelStart();
 			}
+		}
+
+		const auto &media_desc = _sdp.GetMediaList()[_setup_media_index];
+
+		auto first_payload = media_desc->GetFirstPayload();
+		if (first_payload == nullptr)
+		{
+			logte("Failed to get the first Payload type of peer sdp");
+			return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+		}
 
-			// Make track
-			auto track = std::make_shared<MediaTrack>();
-			RtpDepacketizingManager::SupportedDepacketizerType depacketizer_type;
+		// Make track
+		auto track = std::make_shared<MediaTrack>();
+		RtpDepacketizingManager::SupportedDepacketizerType depacketizer_type;
 
-			track->SetId(interleaved_channel);
-			track->SetTimeBase(1, first_payload->GetCodecRate());
-			track->SetVideoTimestampScale(1.0);
+		track->SetId(_interleaved_channel);
+		track->SetTimeBase(1, first_payload->GetCodecRate());
+		track->SetVideoTimestampScale(1.0);
 
-			switch (first_payload->GetCodec())
-			{
-				case PayloadAttr::SupportCodec::H264:
-					track->SetMediaType(cmn::MediaType::Video);
-					track->SetCodecId(cmn::MediaCodecId::H264);
-					track->SetOriginBitstream(cmn::BitstreamFormat::H264_RTP_RFC_6184);
-					_h264_extradata_nalu = first_payload->GetH264ExtraDataAsAnnexB();
-					depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::H264;
-					break;
+		switch (first_payload->GetCodec())
+		{
+			case PayloadAttr::SupportCodec::H264:
+				track->SetMediaType(cmn::MediaType::Video);
+				track->SetCodecId(cmn::MediaCodecId::H264);
+				track->SetOriginBitstream(cmn::BitstreamFormat::H264_RTP_RFC_6184);
+				_h264_extradata_nalu = first_payload->GetH264ExtraDataAsAnnexB();
+				depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::H264;
+				break;
 
 #if 0
-				case PayloadAttr::SupportCodec::H265:
-					track->SetMediaType(cmn::MediaType::Video);
-					track->SetCodecId(cmn::MediaCodecId::H265);
-					track->SetOriginBitstream(cmn::BitstreamFormat::H265_RTP_RFC_7798);
-					// Get Extradata from the first payload(out of band)
-					// _h264_extradata_nalu = first_payload->GetH264ExtraDataAsAnnexB(); 
-					depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::H265;
-					break;
+			case PayloadAttr::SupportCodec::H265:
+				track->SetMediaType(cmn::MediaType::Video);
+				track->SetCodecId(cmn::MediaCodecId::H265);
+				track->SetOriginBitstream(cmn::BitstreamFormat::H265_RTP_RFC_7798);
+				// Get Extradata from the first payload(out of band)
+				// _h264_extradata_nalu = first_payload->GetH264ExtraDataAsAnnexB(); 
+				depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::H265;
+				break;
 #endif
-				case PayloadAttr::SupportCodec::VP8:
-					track->SetMediaType(cmn::MediaType::Video);
-					track->SetCodecId(cmn::MediaCodecId::Vp8);
-					track->SetOriginBitstream(cmn::BitstreamFormat::VP8_RTP_RFC_7741);
-					depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::VP8;
-					break;
+			case PayloadAttr::SupportCodec::VP8:
+				track->SetMediaType(cmn::MediaType::Video);
+				track->SetCodecId(cmn::MediaCodecId::Vp8);
+				track->SetOriginBitstream(cmn::BitstreamFormat::VP8_RTP_RFC_7741);
+				depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::VP8;
+				break;
 
-				case PayloadAttr::SupportCodec::MPEG4_GENERIC:
-					track->SetMediaType(cmn::MediaType::Audio);
-					track->SetCodecId(cmn::MediaCodecId::Aac);
-					track->SetOriginBitstream(cmn::BitstreamFormat::AAC_MPEG4_GENERIC);
-					track->GetChannel().SetCount(std::atoi(first_payload->GetCodecParams()));
-					depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::MPEG4_GENERIC_AUDIO;
-					break;
+			case PayloadAttr::SupportCodec::MPEG4_GENERIC:
+				track->SetMediaType(cmn::MediaType::Audio);
+				track->SetCodecId(cmn::MediaCodecId::Aac);
+				track->SetOriginBitstream(cmn::BitstreamFormat::AAC_MPEG4_GENERIC);
+				track->GetChannel().SetCount(std::atoi(first_payload->GetCodecParams()));
+				depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::MPEG4_GENERIC_AUDIO;
+				break;
 
-				case PayloadAttr::SupportCodec::OPUS:
-					track->SetMediaType(cmn::MediaType::Audio);
-					track->SetCodecId(cmn::MediaCodecId::Opus);
-					track->SetOriginBitstream(cmn::BitstreamFormat::OPUS_RTP_RFC_7587);
-					track->GetChannel().SetCount(std::atoi(first_payload->GetCodecParams()));
-					depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::OPUS;
-					break;
+			case PayloadAttr::SupportCodec::OPUS:
+				track->SetMediaType(cmn::MediaType::Audio);
+				track->SetCodecId(cmn::MediaCodecId::Opus);
+				track->SetOriginBitstream(cmn::BitstreamFormat::OPUS_RTP_RFC_7587);
+				track->GetChannel().SetCount(std::atoi(first_payload->GetCodecParams()));
+				depacketizer_type = RtpDepacketizingManager::SupportedDepacketizerType::OPUS;
+				break;
 
-				default:
-					logte("%s - Unsupported codec  : %s", GetName().CStr(), first_payload->GetCodecParams().CStr());
-					continue;
-			}
+			default:
+				logte("%s - Unsupported codec  : %s", GetName().CStr(), first_payload->GetCodecParams().CStr());
+				_setup_media_index++;
+				return RequestSetup() ? ProcessMediaResult::PROCESS_MEDIA_TRY_AGAIN : ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+		}
 
-			// Add Depacketizer
-			if (AddDepacketizer(interleaved_channel, depacketizer_type) == false)
+		// Add Depacketizer
+		if (AddDepacketizer(_interleaved_channel, depacketizer_type) == false)
+		{
+			logte("%s - Could not add depacketizer for channel %u codec  : %s", GetName().CStr(), _interleaved_channel, first_payload->GetCodecParams().CStr());
+			return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+		}
+
+		// Set Parameters
+		if (depacketizer_type == RtpDepacketizingManager::SupportedDepacketizerType::MPEG4_GENERIC_AUDIO)
+		{
+			RtpDepacketizerMpeg4GenericAudio::Mode mpeg4_mode;
+			if (first_payload->GetMpeg4GenericMode() == PayloadAttr::Mpeg4GenericMode::AAC_lbr)
 			{
-				logte("%s - Could not add depacketizer for channel %u codec  : %s", GetName().CStr(), interleaved_channel, first_payload->GetCodecParams().CStr());
-				return false;
+				mpeg4_mode = RtpDepacketizerMpeg4GenericAudio::Mode::AAC_lbr;
 			}
-
-			// Set Parameters
-			if (depacketizer_type == RtpDepacketizingManager::SupportedDepacketizerType::MPEG4_GENERIC_AUDIO)
+			else if (first_payload->GetMpeg4GenericMode() == PayloadAttr::Mpeg4GenericMode::AAC_hbr)
 			{
-				RtpDepacketizerMpeg4GenericAudio::Mode mpeg4_mode;
-				if (first_payload->GetMpeg4GenericMode() == PayloadAttr::Mpeg4GenericMode::AAC_lbr)
-				{
-					mpeg4_mode = RtpDepacketizerMpeg4GenericAudio::Mode::AAC_lbr;
-				}
-				else if (first_payload->GetMpeg4GenericMode() == PayloadAttr::Mpeg4GenericMode::AAC_hbr)
-				{
-					mpeg4_mode = RtpDepacketizerMpeg4GenericAudio::Mode::AAC_hbr;
-				}
-				else
-				{
-					logte("%s - It is not supported MPEG4-GENERIC audio mode : %s", GetName().CStr(), first_payload->GetFmtp().CStr());
-					return false;
-				}
+				mpeg4_mode = RtpDepacketizerMpeg4GenericAudio::Mode::AAC_hbr;
+			}
+			else
+			{
+				logte("%s - It is not supported MPEG4-GENERIC audio mode : %s", GetName().CStr(), first_payload->GetFmtp().CStr());
+				return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+			}
 
-				auto mpeg4_size_length = first_payload->GetMpeg4GenericSizeLength();
-				auto mpeg4_index_length = first_payload->GetMpeg4GenericIndexLength();
-				auto mpeg4_index_delta_length = first_payload->GetMpeg4GenericIndexDeltaLength();
-				auto mpeg4_config = first_payload->GetMpeg4GenericConfig();
+			auto mpeg4_size_length = first_payload->GetMpeg4GenericSizeLength();
+			auto mpeg4_index_length = first_payload->GetMpeg4GenericIndexLength();
+			auto mpeg4_index_delta_length = first_payload->GetMpeg4GenericIndexDeltaLength();
+			auto mpeg4_config = first_payload->GetMpeg4GenericConfig();
 
-				if (mpeg4_config == nullptr)
-				{
-					logte("%s - Could not parse MPEG4-GENERIC audio config : %s", GetName().CStr(), first_payload->GetFmtp().CStr());
-					return false;
-				}
+			if (mpeg4_config == nullptr)
+			{
+				logte("%s - Could not parse MPEG4-GENERIC audio config : %s", GetName().CStr(), first_payload->GetFmtp().CStr());
+				return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+			}
 
-				auto depacketizer = std::dynamic_pointer_cast<RtpDepacketizerMpeg4GenericAudio>(GetDepacketizer(interleaved_channel));
-				if (depacketizer->SetConfigParams(mpeg4_mode, mpeg4_size_length, mpeg4_index_length, mpeg4_index_delta_length, mpeg4_config) == false)
-				{
-					logte("%s - Could not parse MPEG4-GENERIC audio config : %s", GetName().CStr(), first_payload->GetFmtp().CStr());
-					return false;
-				}
+			auto depacketizer = std::dynamic_pointer_cast<RtpDepacketizerMpeg4GenericAudio>(GetDepacketizer(_interleaved_channel));
+			if (depacketizer->SetConfigParams(mpeg4_mode, mpeg4_size_length, mpeg4_index_length, mpeg4_index_delta_length, mpeg4_config) == false)
+			{
+				logte("%s - Could not parse MPEG4-GENERIC audio config : %s", GetName().CStr(), first_payload->GetFmtp().CStr());
+				return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
 			}
+		}
 
-			AddTrack(track);
+		AddTrack(track);
 
-			// Some RTSP servers ignore the ssrc of SETUP, so they use an interleaved channel instead.
-			RtpRtcp::RtpTrackIdentifier rtp_track_id(track->GetId());
-			rtp_track_id.interleaved_channel = interleaved_channel;
+		// Some RTSP servers ignore the ssrc of SETUP, so they use an interleaved channel instead.
+		RtpRtcp::RtpTrackIdentifier rtp_track_id(track->GetId());
+		rtp_track_id.interleaved_channel = _interleaved_channel;
 
-			_rtp_rtcp->AddRtpReceiver(track, rtp_track_id);
-			RegisterRtpClock(track->GetId(), track->GetTimeBase().GetExpr());
+		_rtp_rtcp->AddRtpReceiver(track, rtp_track_id);
+		RegisterRtpClock(track->GetId(), track->GetTimeBase().GetExpr());
 
-			interleaved_channel += 2;
-		}
+		_interleaved_channel += 2;
+		_setup_media_index++;
 
+		// Next media or PLAY
+		return RequestSetup() ? ProcessMediaResult::PROCESS_MEDIA_TRY_AGAIN : ProcessMediaResult::PROCESS_MEDIA_FAILURE;
+	}
+
+	bool RtspcStream::CompleteSetup()
+	{
 		_rtp_rtcp->RegisterPrevNode(nullptr);
 		_rtp_rtcp->RegisterNextNode(ov::Node::GetSharedPtr());
 		_rtp_rtcp->Start();
@@ -650,16 +733,7 @@ namespace pvd
 		}
 
 		auto play = std::make_shared<RtspMessage>(RtspMethod::PLAY, GetNextCSeq(), _curr_url->ToUrlString(true));
-		if (_authorization_field != nullptr)
-		{
-			// If authorization method is Digest, update the method and uri
-			if (_authorization_field->GetScheme() == RtspHeaderWWWAuthenticateField::Scheme::Digest)
-			{
-				_authorization_field->UpdateDigestAuth(play->GetMethodStr(), play->GetRequestUri());
-			}
-
-			play->AddHeaderField(_authorization_field);
-		}
+		AddAuthorizationField(play);
 
 		if (_rtsp_session_id.IsEmpty() == false)
 		{
@@ -667,37 +741,46 @@ namespace pvd
 		}
 		play->AddHeaderField(std::make_shared<RtspHeaderField>(RtspHeaderFieldType::UserAgent, RTSP_USER_AGENT_NAME));
 
-		if (SendRequestMessage(play) == false)
+		if (SendStartRequest(play, StartStep::Playing) == false)
 		{
 			SetState(State::ERROR);
-			logte("Could not request DESCIBE to RTSP server (%s)", _curr_url->ToUrlString().CStr());
+			logte("Could not request PLAY to RTSP server (%s)", _curr_url->ToUrlString().CStr());
 			return false;
 		}
 
 		logti("Request PLAY : %s", play->DumpHeader().CStr());
 
-		auto reply = ReceiveResponse(play->GetCSeq(), 3000);
+		return true;
+	}
 
-		if (reply == nullptr)
-		{
-			SetState(State::ERROR);
-			logte("No response(CSeq : %u) was received from the rtsp server(%s)", play->GetCSeq(), _curr_url->ToUrlString().CStr());
-			return false;
-		}
-		else if (reply->GetStatusCode() != 200)
+	PullStream::ProcessMediaResult RtspcStream::OnPlayResponse(const std::shared_ptr<RtspMessage> &reply)
+	{
+		if (reply->GetStatusCode() != 200)
 		{
 			SetState(State::ERROR);
-			logte("Rtsp server(%s) rejected the describe request : %d(%s)", _curr_url->ToUrlString().CStr(), reply->GetStatusCode(), reply->GetReasonPhrase().CStr());
-			return false;
+			logte("Rtsp server(%s) rejected the play request : %d(%s)", _curr_url->ToUrlString().CStr(), reply->GetStatusCode(), reply->GetReasonPhrase().CStr());
+			return ProcessMediaResult::PROCESS_MEDIA_FAILURE;
 		}
 
 		logti("Response PLAY : %s", reply->DumpHeader().CStr());
 
+		_pending_request = nullptr;
+
 		SetState(State::PLAYING);
 
 		_ping_timer.Start();
 
-		return true;
+		_origin_response_time_msec = _start_stop_watch.Elapsed();
+
+		// Stream was created completly
+		_stream_metrics = StreamMetrics(*std::static_pointer_cast<info::Stream>(PullStream::GetSharedPtr()));
+		if (_stream_metrics != nullptr)
+		{
+			_stream_metrics->SetOriginConnectionTimeMSec(_origin_request_time_msec);
+			_stream_metrics->SetOriginSubscribeTimeMSec(_origin_response_time_msec);
+		}
+
+		return ProcessMediaResult::PROCESS_MEDIA_SUCCESS;
 	}
 
 	bool RtspcStream::RequestStop()
@@ -708,16 +791,7 @@ namespace pvd
 		}
 
 		auto teardown = std::make_shared<RtspMessage>(RtspMethod::TEARDOWN, GetNextCSeq(), _curr_url->ToUrlString(true));
-		if (_authorization_field != nullptr)
-		{
-			// If authorization method is Digest, update the method and uri
-			if (_authorization_field->GetScheme() == RtspHeaderWWWAuthenticateField::Scheme::Digest)
-			{
-				_authorization_field->UpdateDigestAuth(teardown->GetMethodStr(), teardown->GetRequestUri());
-			}
-
-			teardown->AddHeaderField(_authorization_field);
-		}
+		AddAuthorizationField(teardown);
 
 		if (_rtsp_session_id.IsEmpty() == false)
 		{
@@ -725,6 +799,8 @@ namespace pvd
 		}
 		teardown->AddHeaderField(std::make_shared<RtspHeaderField>(RtspHeaderFieldType::UserAgent, RTSP_USER_AGENT_NAME));
 
+		// The connection is closed right after TEARDOWN, so the response is not waited for
+		// (it can be called by the StreamMotor which receives the response)
 		if (SendRequestMessage(teardown) == false)
 		{
 			SetState(State::ERROR);
@@ -732,20 +808,6 @@ namespace pvd
 			return false;
 		}
 
-		auto reply = ReceiveResponse(teardown->GetCSeq(), 3000);
-		if (reply == nullptr)
-		{
-			SetState(State::ERROR);
-			logte("No response(CSeq : %u) was received from the rtsp server(%s)", teardown->GetCSeq(), _curr_url->ToUrlString().CStr());
-			return false;
-		}
-		else if (reply->GetStatusCode() != 200)
-		{
-			SetState(State::ERROR);
-			logte("Rtsp server(%s) rejected the describe request : %d(%s)", _curr_url->ToUrlString().CStr(), reply->GetStatusCode(), reply->GetReasonPhrase().CStr());
-			return false;
-		}
-
 		return true;
 	}
 
@@ -753,23 +815,14 @@ namespace pvd
 	{
 		// GET_PARAMETER
 		auto get_parameter = std::make_shared<RtspMessage>(RtspMethod::GET_PARAMETER, GetNextCSeq(), _curr_url->ToUrlString(true));
-		if (_authorization_field != nullptr)
-		{
-			// If authorization method is Digest, update the method and uri
-			if (_authorization_field->GetScheme() == RtspHeaderWWWAuthenticateField::Scheme::Digest)
-			{
-				_authorization_field->UpdateDigestAuth(get_parameter->GetMethodStr(), get_parameter->GetRequestUri());
-			}
-
-			get_parameter->AddHeaderField(_authorization_field);
-		}
+		AddAuthorizationField(get_parameter);
 
 		if (_rtsp_session_id.IsEmpty() == false)
 		{
 			get_parameter->AddHeaderField(std::make_shared<RtspHeaderField>(RtspHeaderFieldType::Session, _rtsp_session_id));
 		}
 
-		if (SendRequestMessage(get_parameter, false) == false)
+		if (SendRequestMessage(get_parameter) == false)
 		{
 			SetState(State::ERROR);
 			logte("Could not request GET_PARAMETER to RTSP server (%s)", _curr_url->ToUrlString().CStr());
@@ -786,116 +839,49 @@ namespace pvd
 		return _cseq++;
 	}
 
-	bool RtspcStream::SubscribeResponse(const std::shared_ptr<RtspMessage> &request_message)
-	{
-		std::lock_guard<std::mutex> lock(_response_subscriptions_lock);
-		_response_subscriptions.emplace(request_message->GetCSeq(), std::make_shared<ResponseSubscription>(request_message));
-		return true;
-	}
-
-	std::shared_ptr<RtspcStream::ResponseSubscription> RtspcStream::PopResponseSubscription(uint32_t cseq)
+	void RtspcStream::AddAuthorizationField(const std::shared_ptr<RtspMessage> &message)
 	{
-		std::lock_guard<std::mutex> lock(_response_subscriptions_lock);
-		auto it = _response_subscriptions.find(cseq);
-		if (it == _response_subscriptions.end())
+		if (_authorization_field == nullptr)
 		{
-			logtd("There is no request message to receive a response. (CSeq : %u)", cseq);
-			return nullptr;
+			return;
 		}
 
-		auto request_response = it->second;
-
-		// Remove waited request message
-		_response_subscriptions.erase(it);
-
-		return request_response;
-	}
-
-	bool RtspcStream::SendRequestMessage(const std::shared_ptr<RtspMessage> &message, bool wait_for_response)
-	{
-		if (wait_for_response == true)
+		// If authorization method is Digest, update the method and uri
+		if (_authorization_field->GetScheme() == RtspHeaderWWWAuthenticateField::Scheme::Digest)
 		{
-			// Add to RequestedMap to receive reply
-			SubscribeResponse(message);
+			_authorization_field->UpdateDigestAuth(message->GetMethodStr(), message->GetRequestUri());
 		}
 
-		// Send
-		return _signalling_socket->Send(message->GetMessage());
+		message->AddHeaderField(_authorization_field);
 	}
 
-	std::shared_ptr<RtspMessage> RtspcStream::ReceiveResponse(uint32_t cseq, uint64_t timeout_ms)
+	bool RtspcStream::SendRequestMessage(const std::shared_ptr<RtspMessage> &message)
 	{
-		auto request_response = PopResponseSubscription(cseq);
-		if (request_response == nullptr)
-		{
-			return nullptr;
-		}
-
-		// When the stream is playing, another thread receives a message and notifies it.
-		if (GetState() == State::PLAYING)
-		{
-			return request_response->WaitForResponse(timeout_ms);
-		}
-		// Otherwise, the response must be received directly from the socket.
-		else
+		if (_signalling_socket == nullptr)
 		{
-			auto reply = ReceiveMessage(timeout_ms);
-			// If the stream is not in the playing state, the client cannot receive unexpected CSeq.
-			if (reply == nullptr)
-			{
-				// timed out
-				return nullptr;
-			}
-			else if (reply->GetCSeq() != cseq)
-			{
-				logte("Unexpected CSeq : %u (expected : %u)", reply->GetCSeq(), cseq);
-				return nullptr;
-			}
-
-			return reply;
+			return false;
 		}
 
-		return nullptr;
+		// Send
+		return _signalling_socket->Send(message->GetMessage());
 	}
 
-	std::shared_ptr<RtspMessage> RtspcStream::ReceiveMessage(int64_t timeout_msec)
+	bool RtspcStream::SendStartRequest(const std::shared_ptr<RtspMessage> &message, StartStep step)
 	{
-		ov::StopWatch stop_watch;
-
-		stop_watch.Start();
-		while (true)
-		{
-			if (ReceivePacket(false, timeout_msec) == false)
-			{
-				return nullptr;
-			}
+		_start_step = step;
+		_pending_request = message;
+		_start_step_deadline_msec = static_cast<int64_t>(ov::Clock::NowMSec()) + _request_timeout_msec;
 
-			if (_rtsp_demuxer.IsAvailableMessage())
-			{
-				return _rtsp_demuxer.PopMessage();
-			}
-
-			if (stop_watch.IsElapsed(timeout_msec))
-			{
-				return nullptr;
-			}
-		}
-
-		return nullptr;
+		return SendRequestMessage(message);
 	}
 
-	bool RtspcStream::ReceivePacket(bool non_block, int64_t timeout_msec)
+	bool RtspcStream::ReceivePacket()
 	{
 		uint8_t buffer[65535];
 		size_t read_bytes = 0ULL;
 
-		if (non_block == false && timeout_msec != 0)
-		{
-			struct timeval tv = {timeout_msec / 1000, (timeout_msec % 1000) * 1000};
-			_signalling_socket->SetRecvTimeout(tv);
-		}
-
-		auto error = _signalling_socket->Recv(buffer, 65535, &read_bytes, non_block);
+		// The socket is non-blocking
+		auto error = _signalling_socket->Recv(buffer, 65535, &read_bytes, true);
 		if (read_bytes == 0)
 		{
 			if (error != nullptr)
@@ -904,19 +890,9 @@ namespace pvd
 				SetState(State::ERROR);
 				return false;
 			}
-			else
-			{
-				if (non_block == true)
-				{
-					// retry later
-					return true;
-				}
-				else
-				{
-					// timeout
-					return false;
-				}
-			}
+
+			// retry later
+			return true;
 		}
 
 		// Since the response to the Play request and part of the interleaved data can be received at once,
@@ -945,7 +921,7 @@ namespace pvd
 		}
 
 		// Receive Packet
-		auto result = ReceivePacket(true);
+		auto result = ReceivePacket();
 		if (result == false)
 		{
 			logte("%s/%s(%u) - Could not receive packet : err(%d)", GetApplicationInfo().GetVHostAppName().CStr(), GetName().CStr(), GetId(), static_cast<uint8_t>(result));
@@ -960,16 +936,8 @@ namespace pvd
 				auto rtsp_message = _rtsp_demuxer.PopMessage();
 				if (rtsp_message->GetMessageType() == RtspMessageType::RESPONSE)
 				{
-					// Find Request
-					auto subscription = PopResponseSubscription(rtsp_message->GetCSeq());
-					if (subscription == nullptr)
-					{
-						// Non subscription message, ignore
-						logti("Received Message : %s", rtsp_message->DumpHeader().CStr());
-						continue;
-					}
-
-					subscription->OnResponseReceived(rtsp_message);
+					// Responses of GET_PARAMETER (Ping), nothing to do
+					logtd("Received Message : %s", rtsp_message->DumpHeader().CStr());
 				}
 				else if (rtsp_message->GetMessageType() == RtspMessageType::REQUEST)
 				{
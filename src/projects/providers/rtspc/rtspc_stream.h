@@ -42,6 +42,11 @@ namespace pvd
 		ProcessMediaEventTrigger GetProcessMediaEventTriggerMode() override {
 			return ProcessMediaEventTrigger::TRIGGER_EPOLL;
 		}
+		// Connecting and RTSP requests before PLAYING do not block, the StreamMotor continues them
+		bool IsAsyncStartSupported() override
+		{
+			return true;
+		}
 		// PullStream Implementation
 		int GetFileDescriptorForDetectingEvent() override;
 		// If this stream belongs to the Pull provider, 
@@ -60,82 +65,124 @@ namespace pvd
 	private:
 		std::shared_ptr<pvd::RtspcProvider> GetRtspcProvider();
 
-		class ResponseSubscription
+		// Receives the result of the non-blocking connection from the socket pool
+		// The data is received by the StreamMotor, so OnReadable() does nothing
+		class ConnectionObserver : public ov::SocketAsyncInterface
 		{
 		public:
-			ResponseSubscription(const std::shared_ptr<RtspMessage> &message)
+			enum class State : uint8_t
 			{
-				_request = message;
-				_reqeust_stop_watch.Start();
-			}
+				Connecting,
+				Connected,
+				Failed,
+				Closed
+			};
 
-			std::shared_ptr<RtspMessage> WaitForResponse(uint64_t timeout_ms)
+			void OnConnected(const std::shared_ptr<const ov::SocketError> &error) override
 			{
-				// Semaphore Wait
-				if(_event.WaitFor(timeout_ms) == false)
+				if (error != nullptr)
 				{
-					return nullptr;
+					std::lock_guard<std::mutex> lock(_error_lock);
+					_error_message = error->What();
+					_state = State::Failed;
+					return;
 				}
 
-				return _response;
+				_state = State::Connected;
+			}
+
+			void OnReadable() override
+			{
+			}
+
+			void OnClosed() override
+			{
+				if (_state != State::Failed)
+				{
+					_state = State::Closed;
+				}
 			}
 
-			void OnResponseReceived(const std::shared_ptr<RtspMessage> &message)
+			State GetState() const
 			{
-				_response = message;
-				_round_trip_time_ms = _reqeust_stop_watch.Elapsed();
+				return _state;
+			}
 
-				// Notify
-				_event.Notify();
+			ov::String GetErrorMessage()
+			{
+				std::lock_guard<std::mutex> lock(_error_lock);
+				return _error_message;
 			}
 
 		private:
-			ov::StopWatch _reqeust_stop_watch;
-			ov::Semaphore _event;
+			std::atomic<State> _state{State::Connecting};
 
-			int64_t _round_trip_time_ms = 0;
+			std::mutex _error_lock;
+			ov::String _error_message;
+		};
 
-			std::shared_ptr<RtspMessage> _request = nullptr;
-			std::shared_ptr<RtspMessage> _response = nullptr;
+		// Each step of the start is completed by the response from the RTSP server
+		enum class StartStep : uint8_t
+		{
+			Connecting,
+			Describing,
+			SettingUp,
+			Playing
 		};
 
 		bool StartStream(const std::shared_ptr<const ov::Url> &url) override; // Start
 		bool RestartStream(const std::shared_ptr<const ov::Url> &url) override; // Failover
 		bool StopStream() override; // Stop
+		ProcessMediaResult ContinueStartStream() override;
 
+		// Each request is sent without waiting for the response, and the response is handled by On*Response()
 		bool ConnectTo();
 		bool RequestDescribe();
+		// Sends SETUP for the next media, or PLAY if all medias have been set up
 		bool RequestSetup();
 		bool RequestPlay();
 		bool RequestStop();
 		void Release();
 
+		ProcessMediaResult OnDescribeResponse(const std::shared_ptr<RtspMessage> &reply);
+		ProcessMediaResult OnSetupResponse(const std::shared_ptr<RtspMessage> &reply);
+		ProcessMediaResult OnPlayResponse(const std::shared_ptr<RtspMessage> &reply);
+		bool CompleteSetup();
+
 		bool Ping(); // Send GET_PARAMETER
 
 		int32_t GetNextCSeq();
 
-		bool SendRequestMessage(const std::shared_ptr<RtspMessage> &message, bool wait_for_response = true);
-		std::shared_ptr<RtspMessage> ReceiveResponse(uint32_t cseq, uint64_t timeout_ms);
+		void AddAuthorizationField(const std::shared_ptr<RtspMessage> &message);
+		bool SendRequestMessage(const std::shared_ptr<RtspMessage> &message);
+		// The response must be received within the request timeout
+		bool SendStartRequest(const std::shared_ptr<RtspMessage> &message, StartStep step);
 
-		// Blocking, it is used before playing state
-		std::shared_ptr<RtspMessage> ReceiveMessage(int64_t timeout_msec);
-
-		// Receive and append packet to demuxer
-		bool ReceivePacket(bool non_block = false, int64_t timeout_msec = 0);
+		// Non-blocking, receive and append packet to demuxer
+		bool ReceivePacket();
 
 		bool AddDepacketizer(uint8_t payload_type, RtpDepacketizingManager::SupportedDepacketizerType codec_id);
 		std::shared_ptr<RtpDepacketizingManager> GetDepacketizer(uint8_t payload_type);
 
 		ov::String GenerateControlUrl(ov::String control);
 
-		bool SubscribeResponse(const std::shared_ptr<RtspMessage> &request_message);
-		std::shared_ptr<ResponseSubscription> PopResponseSubscription(uint32_t cseq);
-
 		std::vector<std::shared_ptr<const ov::Url>> _url_list;
 		std::shared_ptr<const ov::Url> _curr_url;
 		std::shared_ptr<RtspHeaderAuthorizationField> _authorization_field = nullptr;
 
 		std::shared_ptr<ov::Socket> _signalling_socket;
+		std::shared_ptr<ConnectionObserver> _connection_observer;
+
+		// Start
+		StartStep _start_step = StartStep::Connecting;
+		std::shared_ptr<RtspMessage> _pending_request = nullptr;
+		int64_t _start_step_deadline_msec = 0;
+		int64_t _connect_timeout_msec = 0;
+		int64_t _request_timeout_msec = 0;
+		ov::StopWatch _start_stop_watch;
+		// Index of the media in SDP to be set up
+		size_t _setup_media_index = 0;
+		int _interleaved_channel = 0;
 		
 		// Values from RTSP
 		int32_t	_cseq = 0;
@@ -149,9 +196,6 @@ namespace pvd
 		// ssrc, rtp channel id (rtcp channel id = rtp_channel_id + 1)
 		std::map<uint32_t, uint8_t> _ssrc_channel_id_map;
 
-		// CSeq : RequestMessage
-		std::mutex _response_subscriptions_lock;
-		std::unordered_map<uint32_t, std::shared_ptr<ResponseSubscription>> _response_subscriptions;
 		RtspDemuxer _rtsp_demuxer;
 
 		// Rtp
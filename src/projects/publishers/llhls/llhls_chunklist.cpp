@@ -11,6 +11,7 @@
 #include "llhls_private.h"
 #include <base/ovcrypto/base_64.h>
 #include <base/ovlibrary/zip.h>
+#include <modules/http/server/http_compression_cache.h>
 
 LLHlsChunklist::LLHlsChunklist(const ov::String &url, const std::shared_ptr<const MediaTrack> &track, 
 							uint32_t segment_count, uint32_t target_duration, double part_target_duration, 
@@ -57,7 +58,7 @@ void LLHlsChunklist::SetEndList()
 {
 	_end_list = true;
 
-	UpdateCacheForDefaultChunklist();
+	UpdateCachedChunklists();
 }
 
 void LLHlsChunklist::SetWallclockOffset(int64_t offset_ms)
@@ -139,7 +140,7 @@ bool LLHlsChunklist::AppendPartialSegmentInfo(uint32_t segment_sequence, const S
 		segment->InsertPartialSegmentInfo(std::make_shared<SegmentInfo>(info));
 	}
 
-	UpdateCacheForDefaultChunklist();
+	UpdateCachedChunklists();
 
 	return true;
 }
@@ -169,21 +170,75 @@ bool LLHlsChunklist::RemoveSegmentInfo(uint32_t segment_sequence)
 	return true;
 }
 
-void LLHlsChunklist::UpdateCacheForDefaultChunklist()
+// Placeholder for the query string of a session (It cannot be a part of the URL)
+#define LLHLS_CHUNKLIST_QUERY_STRING_PLACEHOLDER "\x01"
+
+void LLHlsChunklist::UpdateCachedChunklists()
 {
-	// no query string, no skip, no legacy, all segments
-	ov::String chunklist = MakeChunklist("", false, false, true);
+	int64_t msn = -1, part = -1;
+	GetLastSequenceNumber(msn, part);
+
+	std::shared_ptr<const CachedChunklist> cached_chunklists[2][2];
+
+	for (int legacy = 0; legacy < 2; legacy++)
+	{
+		for (int rewind = 0; rewind < 2; rewind++)
+		{
+			if (rewind == 0 && _last_completed_segment_sequence < 0)
+			{
+				// The window of the no-rewind chunklist can be determined after the first segment is completed
+				continue;
+			}
+
+			auto chunklist_template = MakeChunklist(LLHLS_CHUNKLIST_QUERY_STRING_PLACEHOLDER, false, legacy == 1, rewind == 1);
+
+			auto cached_chunklist = std::make_shared<CachedChunklist>();
+			cached_chunklist->msn = msn;
+			cached_chunklist->part = part;
+			cached_chunklist->pieces = chunklist_template.Split("?" LLHLS_CHUNKLIST_QUERY_STRING_PLACEHOLDER);
+			cached_chunklist->chunklist = ov::String::Join(cached_chunklist->pieces, "");
+
+			cached_chunklists[legacy][rewind] = cached_chunklist;
+		}
+	}
+
+	// The default chunklist (no query string, no skip, no legacy, all segments) is requested the most, so it is compressed in advance
+	cached_chunklists[0][1]->ToGzipData();
+
+	std::lock_guard<std::shared_mutex> lock(_cached_chunklists_guard);
+
+	for (int legacy = 0; legacy < 2; legacy++)
 	{
-		// lock 
-		std::lock_guard<std::shared_mutex> lock(_cached_default_chunklist_guard);
-		_cached_default_chunklist = chunklist;
+		for (int rewind = 0; rewind < 2; rewind++)
+		{
+			_cached_chunklists[legacy][rewind] = cached_chunklists[legacy][rewind];
+		}
 	}
+}
 
+std::shared_ptr<const LLHlsChunklist::CachedChunklist> LLHlsChunklist::GetCachedChunklist(bool legacy, bool rewind) const
+{
+	std::shared_lock<std::shared_mutex> lock(_cached_chunklists_guard);
+	return _cached_chunklists[legacy ? 1 : 0][rewind ? 1 : 0];
+}
+
+ov::String LLHlsChunklist::CachedChunklist::ToString(const ov::String &query_string) const
+{
+	if (query_string.IsEmpty())
 	{
-		// lock 
-		std::lock_guard<std::shared_mutex> lock(_cached_default_chunklist_gzip_guard);
-		_cached_default_chunklist_gzip = ov::Zip::CompressGzip(chunklist.ToData(false));
+		return chunklist;
 	}
+
+	return ov::String::Join(pieces, ov::String::FormatString("?%s", query_string.CStr()).CStr());
+}
+
+std::shared_ptr<const ov::Data> LLHlsChunklist::CachedChunklist::ToGzipData() const
+{
+	std::call_once(gzip_once, [this]() {
+		gzip = ov::Zip::CompressGzip(chunklist.ToData(false));
+	});
+
+	return gzip;
 }
 
 bool LLHlsChunklist::SaveOldSegmentInfo(std::shared_ptr<SegmentInfo> &segment_info)
@@ -240,6 +295,43 @@ bool LLHlsChunklist::GetLastSequenceNumber(int64_t &msn, int64_t &psn) const
 	return true;
 }
 
+bool LLHlsChunklist::GetPreloadHintSequenceNumber(int64_t &msn, int64_t &psn) const
+{
+	if (_preload_hint_enabled == false || _end_list == true)
+	{
+		return false;
+	}
+
+	std::shared_lock<std::shared_mutex> lock(_segments_guard);
+
+	if (_segments.empty())
+	{
+		return false;
+	}
+
+	auto last_segment = _segments.rbegin()->second;
+	const auto &partial_segments = last_segment->GetPartialSegments();
+	if (partial_segments.empty())
+	{
+		return false;
+	}
+
+	// The hinted part is the next part of the last part (See GetNextPartialSegmentName() of LLHlsStream)
+	auto last_partial_segment = partial_segments.back();
+	if (last_partial_segment->IsCompleted() == true)
+	{
+		msn = last_segment->GetSequence() + 1;
+		psn = 0;
+	}
+	else
+	{
+		msn = last_segment->GetSequence();
+		psn = last_partial_segment->GetSequence() + 1;
+	}
+
+	return true;
+}
+
 ov::String LLHlsChunklist::MakeExtXKey() const
 {
 	ov::String xkey;
@@ -587,11 +679,14 @@ ov::String LLHlsChunklist::ToString(const ov::String &query_string, bool skip, b
 		return "";
 	}
 
-	if (query_string.IsEmpty() && skip == false && legacy == false && rewind == true && vod == false && vod_start_segment_number == 0 && !_cached_default_chunklist.IsEmpty())
+	if (vod == false && vod_start_segment_number == 0)
 	{
-		// return cached chunklist for default chunklist
-		std::shared_lock<std::shared_mutex> lock(_cached_default_chunklist_guard);
-		return _cached_default_chunklist;
+		// return the pre-rendered chunklist
+		auto cached_chunklist = GetCachedChunklist(legacy, rewind);
+		if (cached_chunklist != nullptr && cached_chunklist->chunklist.IsEmpty() == false)
+		{
+			return cached_chunklist->ToString(query_string);
+		}
 	}
 
 	return MakeChunklist(query_string, skip, legacy, rewind, vod, vod_start_segment_number);
@@ -599,11 +694,17 @@ ov::String LLHlsChunklist::ToString(const ov::String &query_string, bool skip, b
 
 std::shared_ptr<const ov::Data> LLHlsChunklist::ToGzipData(const ov::String &query_string, bool skip, bool legacy, bool rewind) const
 {
-	if (query_string.IsEmpty() && skip == false && legacy == false && _cached_default_chunklist_gzip != nullptr && rewind == true)
+	if (query_string.IsEmpty())
 	{
-		std::shared_lock<std::shared_mutex> lock(_cached_default_chunklist_gzip_guard);
-		return _cached_default_chunklist_gzip;
+		auto cached_chunklist = GetCachedChunklist(legacy, rewind);
+		if (cached_chunklist != nullptr && cached_chunklist->chunklist.IsEmpty() == false)
+		{
+			return cached_chunklist->ToGzipData();
+		}
 	}
 
-	return ov::Zip::CompressGzip(ToString(query_string, skip, legacy, rewind).ToData(false));
+	// Playlists with a query string are compressed per request, the compressed one is shared by the requests with the same content
+	auto playlist = ToString(query_string, skip, legacy, rewind).ToData(false);
+
+	return http::svr::HttpCompressionCache::GetInstance()->Compress(http::svr::ContentEncoding::Gzip, http::svr::HttpCompressionCache::MakeContentKey(playlist), playlist);
 }
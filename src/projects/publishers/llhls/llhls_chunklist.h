@@ -236,10 +236,13 @@ public:
 	bool RemoveSegmentInfo(uint32_t segment_sequence);
 
 	ov::String ToString(const ov::String &query_string, bool skip, bool legacy, bool rewind, bool vod = false, uint32_t vod_start_segment_number = 0) const;
+	// Returns nullptr if the chunklist could not be compressed
 	std::shared_ptr<const ov::Data> ToGzipData(const ov::String &query_string, bool skip, bool legacy, bool rewind) const;
 
 	std::shared_ptr<SegmentInfo> GetSegmentInfo(uint32_t segment_sequence) const;
 	bool GetLastSequenceNumber(int64_t &msn, int64_t &psn) const;
+	// Get the (msn, part) of the partial segment of EXT-X-PRELOAD-HINT
+	bool GetPreloadHintSequenceNumber(int64_t &msn, int64_t &psn) const;
 
 	void SetEndList();
 
@@ -287,11 +290,35 @@ private:
 	std::map<int32_t, std::shared_ptr<LLHlsChunklist>> _renditions;
 	mutable std::shared_mutex _renditions_guard;
 
-	ov::String _cached_default_chunklist;
-	mutable std::shared_mutex _cached_default_chunklist_guard;
+	// Pre-rendered chunklist of a (legacy, rewind) variant, shared by all sessions until the next update
+	//
+	// The chunklist is rendered once with a placeholder in place of the query string,
+	// so the chunklist of any session can be made by joining the pieces with its query string.
+	// (_HLS_skip is not implemented yet, so the skip variants are the same as the others)
+	struct CachedChunklist
+	{
+		// The last (msn, part) when the chunklist was rendered
+		int64_t msn = -1;
+		int64_t part = -1;
+
+		// The chunklist is split at the query string positions
+		std::vector<ov::String> pieces;
+		// The chunklist without query string
+		ov::String chunklist;
+
+		// The gzip of the chunklist without query string, it is compressed once when requested first
+		mutable std::once_flag gzip_once;
+		mutable std::shared_ptr<const ov::Data> gzip;
+
+		ov::String ToString(const ov::String &query_string) const;
+		std::shared_ptr<const ov::Data> ToGzipData() const;
+	};
+
+	std::shared_ptr<const CachedChunklist> GetCachedChunklist(bool legacy, bool rewind) const;
 
-	std::shared_ptr<ov::Data> _cached_default_chunklist_gzip;
-	mutable std::shared_mutex _cached_default_chunklist_gzip_guard;
+	// [legacy][rewind]
+	std::shared_ptr<const CachedChunklist> _cached_chunklists[2][2];
+	mutable std::shared_mutex _cached_chunklists_guard;
 
 	bmff::CencProperty _cenc_property;
 
@@ -301,5 +328,5 @@ private:
 
 	std::shared_ptr<Marker> _root_marker;
 
-	void UpdateCacheForDefaultChunklist();
+	void UpdateCachedChunklists();
 };
\ No newline at end of file
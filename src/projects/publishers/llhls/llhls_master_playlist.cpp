@@ -10,6 +10,7 @@
 
 #include <base/ovcrypto/base_64.h>
 #include <base/ovlibrary/zip.h>
+#include <modules/http/server/http_compression_cache.h>
 
 #include "llhls_private.h"
 
@@ -461,5 +462,8 @@ std::shared_ptr<const ov::Data> LLHlsMasterPlaylist::ToGzipData(const ov::String
 		return _cached_default_playlist_gzip;
 	}
 
-	return ov::Zip::CompressGzip(ToString(chunk_query_string, legacy, rewind).ToData(false));
+	// Playlists with a query string are compressed per request, the compressed one is shared by the requests with the same content
+	auto playlist = ToString(chunk_query_string, legacy, rewind).ToData(false);
+
+	return http::svr::HttpCompressionCache::GetInstance()->Compress(http::svr::ContentEncoding::Gzip, http::svr::HttpCompressionCache::MakeContentKey(playlist), playlist);
 }
\ No newline at end of file
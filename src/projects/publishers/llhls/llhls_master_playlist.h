@@ -27,6 +27,7 @@ public:
 	void UpdateCacheForDefaultPlaylist();
 
 	ov::String ToString(const ov::String &chunk_query_string, bool legacy, bool rewind, bool include_path=true) const;
+	// Returns nullptr if the playlist could not be compressed
 	std::shared_ptr<const ov::Data> ToGzipData(const ov::String &chunk_query_string, bool legacy, bool rewind) const;
 
 private:
@@ -85,13 +85,16 @@ bool LLHlsSession::Start()
 
 	_hls_legacy = llhls_conf.GetDefaultQueryString().GetBoolValue("_HLS_legacy", kDefaultHlsLegacy);
 	_hls_rewind = llhls_conf.GetDefaultQueryString().GetBoolValue("_HLS_rewind", kDefaultHlsRewind);
+
+	_http2_push_enabled = llhls_conf.IsHttp2PushEnabled();
+	_progressive_part_enabled = llhls_conf.IsProgressivePartEnabled();
 	
 	return Session::Start();
 }
 
 bool LLHlsSession::Stop()
 {
-	logtd("LLHlsSession(%u) : Pending request size(%d)", GetId(), _pending_requests.size());
+	logtd("LLHlsSession(%u) : Pending request size(%d), Progressive request size(%d)", GetId(), _pending_requests.size(), _progressive_requests.size());
 
 	return Session::Stop();
 }
@@ -170,6 +173,19 @@ void LLHlsSession::SendOutgoingData(const std::any &notification)
 
 void LLHlsSession::OnMessageReceived(const std::any &message)
 {
+	// The stream notifies the session only when its blocked requests are satisfied (See LLHlsStream::AddPlaylistWaiter)
+	if (message.type() == typeid(std::shared_ptr<LLHlsStream::PlaylistUpdatedEvent>))
+	{
+		SendOutgoingData(message);
+		return;
+	}
+	else if (message.type() == typeid(std::shared_ptr<LLHlsStream::ProgressiveChunkUpdatedEvent>))
+	{
+		auto event = std::any_cast<std::shared_ptr<LLHlsStream::ProgressiveChunkUpdatedEvent>>(message);
+		OnProgressiveChunkUpdated(event->track_id);
+		return;
+	}
+
 	std::shared_ptr<http::svr::HttpExchange> exchange = nullptr;
 	try 
 	{
@@ -449,7 +465,15 @@ void LLHlsSession::ResponsePlaylist(const std::shared_ptr<http::svr::HttpExchang
 	// Get the playlist
 	auto query_string = MakeQueryStringToPropagate(request_uri);
 	auto [result, playlist] = llhls_stream->GetMasterPlaylist(file_name, query_string, gzip, legacy, rewind);
-	if (result == LLHlsStream::RequestResult::Success)
+	if ((result == LLHlsStream::RequestResult::Success) && (playlist == nullptr) && gzip)
+	{
+		// Could not be compressed, so it is sent as is
+		gzip = false;
+		content_encoding = "identity";
+		std::tie(result, playlist) = llhls_stream->GetMasterPlaylist(file_name, query_string, gzip, legacy, rewind);
+	}
+
+	if ((result == LLHlsStream::RequestResult::Success) && (playlist != nullptr))
 	{
 		// Send the playlist
 		response->SetStatusCode(http::StatusCode::OK);
@@ -538,7 +562,15 @@ void LLHlsSession::ResponseChunklist(const std::shared_ptr<http::svr::HttpExchan
 	auto query_string = MakeQueryStringToPropagate(request_uri);
 
 	auto [result, chunklist] = llhls_stream->GetChunklist(query_string, track_id, msn, part, skip, gzip, legacy, rewind);
-	if (result == LLHlsStream::RequestResult::Success)
+	if ((result == LLHlsStream::RequestResult::Success) && (chunklist == nullptr) && gzip)
+	{
+		// Could not be compressed, so it is sent as is
+		gzip = false;
+		content_encoding = "identity";
+		std::tie(result, chunklist) = llhls_stream->GetChunklist(query_string, track_id, msn, part, skip, gzip, legacy, rewind);
+	}
+
+	if ((result == LLHlsStream::RequestResult::Success) && (chunklist != nullptr))
 	{
 		// Send the chunklist
 		response->SetStatusCode(http::StatusCode::OK);
@@ -582,6 +614,12 @@ void LLHlsSession::ResponseChunklist(const std::shared_ptr<http::svr::HttpExchan
 
 		response->AppendData(chunklist);
 
+		// Only the blocking requests are pushed, the player is waiting for the hinted part right after this response
+		if (_http2_push_enabled == true && has_delivery_directives == true)
+		{
+			PushPreloadHintChunk(exchange, track_id, query_string);
+		}
+
 		// If a client uses previously cached llhls.m3u8 and requests chunklist
 		if (_origin_mode == false && _number_of_players == 0)
 		{
@@ -674,8 +712,28 @@ void LLHlsSession::ResponseSegment(const std::shared_ptr<http::svr::HttpExchange
 
 	auto response = exchange->GetResponse();
 
-	// Get the segment
-	auto [result, segment] = llhls_stream->GetSegment(track_id, segment_number);
+	LLHlsStream::RequestResult result = LLHlsStream::RequestResult::NotFound;
+	bmff::FMP4DataList segment;
+	std::shared_ptr<const ov::Data> segment_md5;
+
+	// DVR segments are sent from the file without loading them into the memory
+	std::shared_ptr<ov::ReadOnlyFile> segment_file;
+	auto [file_result, file_path] = llhls_stream->GetSegmentFile(track_id, segment_number);
+	if (file_result == LLHlsStream::RequestResult::Success)
+	{
+		segment_file = ov::ReadOnlyFile::Open(file_path);
+	}
+
+	if (segment_file != nullptr)
+	{
+		result = LLHlsStream::RequestResult::Success;
+	}
+	else
+	{
+		// Get the segment
+		std::tie(result, segment, segment_md5) = llhls_stream->GetSegment(track_id, segment_number, response->IsEtagEnabled());
+	}
+
 	if (result == LLHlsStream::RequestResult::Success)
 	{
 		// Send the segment
@@ -704,7 +762,12 @@ void LLHlsSession::ResponseSegment(const std::shared_ptr<http::svr::HttpExchange
 			response->SetHeader("Cache-Control", cache_control);
 		}
 
-		response->AppendData(segment);
+		if (segment_file != nullptr)
+		{
+			response->AppendFile(segment_file);
+		}
+
+		response->AppendDataList(segment, segment_md5);
 	}
 	else
 	{
@@ -726,39 +789,23 @@ void LLHlsSession::ResponsePartialSegment(const std::shared_ptr<http::svr::HttpE
 	auto response = exchange->GetResponse();
 
 	// Get the partial segment
-	auto [result, partial_segment] = llhls_stream->GetChunk(track_id, segment_number, partial_number);
+	auto [result, partial_segment, partial_segment_md5] = llhls_stream->GetChunk(track_id, segment_number, partial_number, response->IsEtagEnabled());
 	if (result == LLHlsStream::RequestResult::Success)
 	{
 		// Send the partial segment
 		response->SetStatusCode(http::StatusCode::OK);
-		// Set Content-Type header
-		if (GetStream()->GetTrack(track_id)->GetMediaType() == cmn::MediaType::Video)
-		{
-			response->SetHeader("Content-Type", "video/mp4");
-		}
-		else
-		{
-			response->SetHeader("Content-Type", "audio/mp4");
-		}
+		SetPartialSegmentHeaders(response, track_id);
 
-		if (_partial_segment_max_age >= 0)
-		{
-			ov::String cache_control;
-			if (_partial_segment_max_age == 0)
-			{
-				cache_control = ov::String::FormatString("no-cache, no-store");
-			}
-			else
-			{
-				cache_control = ov::String::FormatString("max-age=%d", _partial_segment_max_age);
-			}
-			response->SetHeader("Cache-Control", cache_control);
-		}
-
-		response->AppendData(partial_segment);
+		response->AppendDataList(partial_segment, partial_segment_md5);
 	}
 	else if (result == LLHlsStream::RequestResult::Accepted && holdIfAccepted == true)
 	{
+		// The part in progress (usually the hinted part) is delivered while it is being packaged
+		if (_progressive_part_enabled == true && StartProgressiveResponse(exchange, file_name, track_id, segment_number, partial_number) == true)
+		{
+			return;
+		}
+
 		// Hold
 		AddPendingRequest(exchange, RequestType::PartialSegment, file_name, track_id, segment_number, partial_number, false, false, false);
 		return ;
@@ -777,6 +824,145 @@ void LLHlsSession::ResponsePartialSegment(const std::shared_ptr<http::svr::HttpE
 	ResponseData(exchange);
 }
 
+void LLHlsSession::SetPartialSegmentHeaders(const std::shared_ptr<http::svr::HttpResponse> &response, const int32_t &track_id)
+{
+	// Set Content-Type header
+	if (GetStream()->GetTrack(track_id)->GetMediaType() == cmn::MediaType::Video)
+	{
+		response->SetHeader("Content-Type", "video/mp4");
+	}
+	else
+	{
+		response->SetHeader("Content-Type", "audio/mp4");
+	}
+
+	if (_partial_segment_max_age >= 0)
+	{
+		ov::String cache_control;
+		if (_partial_segment_max_age == 0)
+		{
+			cache_control = ov::String::FormatString("no-cache, no-store");
+		}
+		else
+		{
+			cache_control = ov::String::FormatString("max-age=%d", _partial_segment_max_age);
+		}
+		response->SetHeader("Cache-Control", cache_control);
+	}
+}
+
+bool LLHlsSession::StartProgressiveResponse(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &file_name, const int32_t &track_id, const int64_t &segment_number, const int64_t &partial_number)
+{
+	auto llhls_stream = std::static_pointer_cast<LLHlsStream>(GetStream());
+	if (llhls_stream == nullptr)
+	{
+		return false;
+	}
+
+	// Only the part in progress can be delivered progressively, the later parts are held
+	auto [result, data_list, completed] = llhls_stream->GetProgressiveChunk(track_id, segment_number, partial_number, 0);
+	if (result != LLHlsStream::RequestResult::Success)
+	{
+		return false;
+	}
+
+	auto response = exchange->GetResponse();
+	if (response->StartStreaming() == false)
+	{
+		return false;
+	}
+
+	response->SetStatusCode(http::StatusCode::OK);
+	SetPartialSegmentHeaders(response, track_id);
+
+	ProgressiveRequest request;
+	request.file_name = file_name;
+	request.track_id = track_id;
+	request.segment_number = segment_number;
+	request.partial_number = partial_number;
+	request.exchange = exchange;
+
+	_progressive_requests.push_back(request);
+
+	if (ContinueProgressiveResponse(_progressive_requests.back()) == true)
+	{
+		_progressive_requests.pop_back();
+	}
+
+	return true;
+}
+
+bool LLHlsSession::ContinueProgressiveResponse(ProgressiveRequest &request)
+{
+	auto llhls_stream = std::static_pointer_cast<LLHlsStream>(GetStream());
+	if (llhls_stream == nullptr)
+	{
+		return true;
+	}
+
+	auto exchange = request.exchange;
+	auto response = exchange->GetResponse();
+
+	auto [result, data_list, completed] = llhls_stream->GetProgressiveChunk(request.track_id, request.segment_number, request.partial_number, request.sent_bytes);
+	if (result != LLHlsStream::RequestResult::Success)
+	{
+		// The part has been deleted before it is completed, the response cannot be completed
+		logtw("%s/%s/%s Failed to complete progressive response. (%zu bytes sent)", GetApplication()->GetVHostAppName().CStr(), GetStream()->GetName().CStr(), request.file_name.CStr(), request.sent_bytes);
+
+		response->EndStreaming();
+		exchange->Release();
+		return true;
+	}
+
+	for (const auto &data : data_list)
+	{
+		response->AppendData(data);
+		request.sent_bytes += data->GetLength();
+	}
+
+	// The header is sent on the first call
+	auto sent_size = response->Response();
+	if (sent_size < 0)
+	{
+		exchange->Release();
+		return true;
+	}
+	else if (sent_size > 0)
+	{
+		MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::LLHls, sent_size);
+	}
+
+	if (completed == true)
+	{
+		response->EndStreaming();
+
+		logtd("\n%s", exchange->GetDebugInfo().CStr());
+		exchange->Release();
+		return true;
+	}
+
+	// Wait for the next fragment of the part
+	llhls_stream->AddProgressiveChunkWaiter(GetId(), request.track_id, request.segment_number, request.partial_number, request.sent_bytes);
+
+	return false;
+}
+
+void LLHlsSession::OnProgressiveChunkUpdated(const int32_t &track_id)
+{
+	auto it = _progressive_requests.begin();
+	while (it != _progressive_requests.end())
+	{
+		if (it->track_id == track_id && ContinueProgressiveResponse(*it) == true)
+		{
+			it = _progressive_requests.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+}
+
 void LLHlsSession::ResponseData(const std::shared_ptr<http::svr::HttpExchange> &exchange)
 {
 	auto response = exchange->GetResponse();
@@ -793,6 +979,56 @@ void LLHlsSession::ResponseData(const std::shared_ptr<http::svr::HttpExchange> &
 	exchange->Release();
 }
 
+void LLHlsSession::PushPreloadHintChunk(const std::shared_ptr<http::svr::HttpExchange> &exchange, const int32_t &track_id, const ov::String &query_string)
+{
+	auto connection = exchange->GetConnection();
+	if (connection == nullptr || connection->IsHttp2PushEnabled() == false)
+	{
+		return;
+	}
+
+	auto llhls_stream = std::static_pointer_cast<LLHlsStream>(GetStream());
+	if (llhls_stream == nullptr)
+	{
+		return;
+	}
+
+	auto [result, segment_number, partial_number, file_name] = llhls_stream->GetPreloadHintChunk(track_id);
+	if (result != LLHlsStream::RequestResult::Success)
+	{
+		return;
+	}
+
+	// The same part can be hinted by several chunklists (e.g. reloads of the player), push it only once
+	auto hinted_chunk = std::make_pair(segment_number, partial_number);
+	auto last_pushed_it = _last_pushed_chunks.find(track_id);
+	if (last_pushed_it != _last_pushed_chunks.end() && hinted_chunk <= last_pushed_it->second)
+	{
+		return;
+	}
+
+	// The URI of the part is relative to the chunklist
+	auto chunklist_path = exchange->GetRequest()->GetParsedUri()->Path();
+	auto path = chunklist_path.Left(chunklist_path.IndexOfRev('/') + 1) + file_name;
+	if (query_string.IsEmpty() == false)
+	{
+		path.AppendFormat("?%s", query_string.CStr());
+	}
+
+	auto pushed_exchange = connection->PushPromise(exchange, path);
+	if (pushed_exchange == nullptr)
+	{
+		return;
+	}
+
+	_last_pushed_chunks[track_id] = hinted_chunk;
+
+	logtd("LLHlsSession(%u) : Push the preload hint part : %s", GetId(), path.CStr());
+
+	// The part is not yet created in most cases, so the pushed stream is held until the part is ready like a blocking request
+	ResponsePartialSegment(pushed_exchange, file_name, track_id, segment_number, partial_number);
+}
+
 void LLHlsSession::OnPlaylistUpdated(const int32_t &track_id, const int64_t &msn, const int64_t &part)
 {
 	logtd("LLHlsSession::OnPlaylistUpdated track_id: %d, msn: %lld, part: %lld", track_id, msn, part);
@@ -862,6 +1098,13 @@ bool LLHlsSession::AddPendingRequest(const std::shared_ptr<http::svr::HttpExchan
 	// Add the request to the pending list
 	_pending_requests.push_back(request);
 
+	// Register the request to the stream to be woken up when the playlist is updated
+	auto llhls_stream = std::static_pointer_cast<LLHlsStream>(GetStream());
+	if (llhls_stream != nullptr)
+	{
+		llhls_stream->AddPlaylistWaiter(GetId(), (type == RequestType::Playlist) ? LLHlsStream::kAnyTrack : track_id, segment_number, partial_number);
+	}
+
 	if (_pending_requests.size() > MAX_PENDING_REQUESTS)
 	{
 		logtd("[%s/%s/%u] Too many pending requests (%u)", 
@@ -81,6 +81,12 @@ private:
 
 	void ResponseData(const std::shared_ptr<http::svr::HttpExchange> &exchange);
 
+	void SetPartialSegmentHeaders(const std::shared_ptr<http::svr::HttpResponse> &response, const int32_t &track_id);
+
+	// HTTP/2 Server Push of the partial segment of EXT-X-PRELOAD-HINT
+	// It must be called before the response of the chunklist is sent, since PUSH_PROMISE should precede the response of the associated stream.
+	void PushPreloadHintChunk(const std::shared_ptr<http::svr::HttpExchange> &exchange, const int32_t &track_id, const ov::String &query_string);
+
 	void OnPlaylistUpdated(const int32_t &track_id, const int64_t &msn, const int64_t &part);
 
 	ov::String MakeQueryStringToPropagate(const std::shared_ptr<ov::Url> &request_uri);
@@ -104,6 +110,27 @@ private:
 
 	std::list<PendingRequest> _pending_requests;
 
+	// Progressive requests, the part in progress is being delivered as it is packaged
+	struct ProgressiveRequest
+	{
+		ov::String file_name;
+		int32_t track_id = -1;
+		int64_t segment_number = -1;
+		int64_t partial_number = -1;
+		// Bytes of the part sent so far
+		size_t sent_bytes = 0;
+
+		std::shared_ptr<http::svr::HttpExchange> exchange;
+	};
+
+	// Returns false if the part is not in progress, then the request should be held until the part is completed
+	bool StartProgressiveResponse(const std::shared_ptr<http::svr::HttpExchange> &exchange, const ov::String &file_name, const int32_t &track_id, const int64_t &segment_number, const int64_t &partial_number);
+	// Sends the data of the part appended since the last call, returns true if the response is finished
+	bool ContinueProgressiveResponse(ProgressiveRequest &request);
+	void OnProgressiveChunkUpdated(const int32_t &track_id);
+
+	std::list<ProgressiveRequest> _progressive_requests;
+
 	// ID list of connections requesting this session
 	// Connection ID : last request time
 	std::map<uint32_t, uint64_t> _last_request_time;
@@ -128,4 +155,9 @@ private:
 	// default querystring value
 	bool _hls_legacy = false;
 	bool _hls_rewind = false;
+
+	bool _http2_push_enabled = false;
+	bool _progressive_part_enabled = false;
+	// Track ID : the last pushed (msn, part)
+	std::map<int32_t, std::pair<int64_t, int64_t>> _last_pushed_chunks;
 };
\ No newline at end of file
@@ -94,6 +94,7 @@ bool LLHlsStream::Start()
 
 	_packager_config.chunk_duration_ms = llhls_config.GetChunkDuration() * 1000.0;
 	_packager_config.segment_duration_ms = llhls_config.GetSegmentDuration() * 1000.0;
+	_packager_config.progressive_chunk = llhls_config.IsProgressivePartEnabled();
 	// cenc property will be set in AddPackager
 
 	_storage_config.max_segments = llhls_config.GetSegmentCount();
@@ -291,6 +292,13 @@ bool LLHlsStream::Stop()
 		}
 	}
 
+	{
+		std::lock_guard<std::mutex> lock(_playlist_waiters_lock);
+		_playlist_waiters.clear();
+		_progressive_chunk_waiters.clear();
+		_last_notified_sequence.clear();
+	}
+
 	return Stream::Stop();
 }
 
@@ -873,26 +881,43 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 	return {RequestResult::Success, storage->GetInitializationSection()};
 }
 
-std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::GetSegment(const int32_t &track_id, const int64_t &segment_number) const
+std::tuple<LLHlsStream::RequestResult, bmff::FMP4DataList, std::shared_ptr<const ov::Data>> LLHlsStream::GetSegment(const int32_t &track_id, const int64_t &segment_number, bool with_md5) const
 {
 	auto storage = GetStorage(track_id);
 	if (storage == nullptr)
 	{
 		logtw("Could not find storage for track_id = %d", track_id);
-		return {RequestResult::NotFound, nullptr};
+		return {RequestResult::NotFound, {}, nullptr};
 	}
 
 	auto segment = storage->GetMediaSegment(segment_number);
 	if (segment == nullptr)
 	{
 		logtw("Could not find segment for track_id = %d, segment = %ld (last_segment = %ld)", track_id, segment_number, storage->GetLastSegmentNumber());
-		return {RequestResult::NotFound, nullptr};
+		return {RequestResult::NotFound, {}, nullptr};
 	}
 
-	return {RequestResult::Success, segment->GetData()};
+	return {RequestResult::Success, segment->GetDataList(), with_md5 ? segment->GetMd5() : nullptr};
 }
 
-std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::GetChunk(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number) const
+std::tuple<LLHlsStream::RequestResult, ov::String> LLHlsStream::GetSegmentFile(const int32_t &track_id, const int64_t &segment_number) const
+{
+	auto storage = GetStorage(track_id);
+	if (storage == nullptr)
+	{
+		return {RequestResult::NotFound, ""};
+	}
+
+	auto file_path = storage->GetMediaSegmentFilePath(segment_number);
+	if (file_path.IsEmpty())
+	{
+		return {RequestResult::NotFound, ""};
+	}
+
+	return {RequestResult::Success, file_path};
+}
+
+std::tuple<LLHlsStream::RequestResult, bmff::FMP4DataList, std::shared_ptr<const ov::Data>> LLHlsStream::GetChunk(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number, bool with_md5) const
 {
 	logtd("LLHlsStream(%s) - GetChunk(%d, %ld, %ld)", GetName().CStr(), track_id, segment_number, chunk_number);
 
@@ -900,7 +925,7 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 	if (storage == nullptr)
 	{
 		logtw("Could not find storage for track_id = %d", track_id);
-		return {RequestResult::NotFound, nullptr};
+		return {RequestResult::NotFound, {}, nullptr};
 	}
 
 	auto [last_segment_number, last_chunk_number] = storage->GetLastChunkNumber();
@@ -909,7 +934,7 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 	{
 		logtd("Accepted chunk for track_id = %d, segment = %ld, chunk = %ld (last_segment = %ld, last_chunk = %ld)", track_id, segment_number, chunk_number, last_segment_number, last_chunk_number);
 		// Hold the request until a Playlist contains a Segment with the requested Sequence Number
-		return {RequestResult::Accepted, nullptr};
+		return {RequestResult::Accepted, {}, nullptr};
 	}
 	else
 	{
@@ -920,10 +945,45 @@ std::tuple<LLHlsStream::RequestResult, std::shared_ptr<ov::Data>> LLHlsStream::G
 	if (chunk == nullptr)
 	{
 		logtw("Could not find partial segment for track_id = %d, segment = %ld, partial = %ld (last_segment = %ld, last_partial = %ld)", track_id, segment_number, chunk_number, last_segment_number, last_chunk_number);
-		return {RequestResult::NotFound, nullptr};
+		return {RequestResult::NotFound, {}, nullptr};
+	}
+
+	return {RequestResult::Success, chunk->GetDataList(), with_md5 ? chunk->GetMd5() : nullptr};
+}
+
+std::tuple<LLHlsStream::RequestResult, bmff::FMP4DataList, bool> LLHlsStream::GetProgressiveChunk(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number, size_t offset) const
+{
+	auto storage = GetStorage(track_id);
+	if (storage == nullptr)
+	{
+		logtw("Could not find storage for track_id = %d", track_id);
+		return {RequestResult::NotFound, {}, false};
+	}
+
+	auto [found, completed, data_list] = storage->GetMediaChunkDataList(segment_number, chunk_number, offset);
+	if (found == false)
+	{
+		return {RequestResult::NotFound, {}, false};
+	}
+
+	return {RequestResult::Success, data_list, completed};
+}
+
+std::tuple<LLHlsStream::RequestResult, int64_t, int64_t, ov::String> LLHlsStream::GetPreloadHintChunk(const int32_t &track_id) const
+{
+	auto chunklist = GetChunklistWriter(track_id);
+	if (chunklist == nullptr)
+	{
+		return {RequestResult::NotFound, -1, -1, ""};
+	}
+
+	int64_t segment_number = -1, chunk_number = -1;
+	if (chunklist->GetPreloadHintSequenceNumber(segment_number, chunk_number) == false)
+	{
+		return {RequestResult::NotFound, -1, -1, ""};
 	}
 
-	return {RequestResult::Success, chunk->GetData()};
+	return {RequestResult::Success, segment_number, chunk_number, GetPartialSegmentName(track_id, segment_number, chunk_number)};
 }
 
 void LLHlsStream::BufferMediaPacketUntilReadyToPlay(const std::shared_ptr<MediaPacket> &media_packet)
@@ -1699,6 +1759,8 @@ void LLHlsStream::OnMediaChunkUpdated(const int32_t &track_id, const uint32_t &s
 
 	// Notify
 	NotifyPlaylistUpdated(track_id, segment_number, chunk_number);
+	// The chunk which was in progress is completed
+	NotifyProgressiveChunkUpdated(track_id, segment_number, chunk_number);
 
 	if (last_chunk == true)
 	{
@@ -1706,6 +1768,11 @@ void LLHlsStream::OnMediaChunkUpdated(const int32_t &track_id, const uint32_t &s
 	}
 }
 
+void LLHlsStream::OnMediaChunkFragmentAppended(const int32_t &track_id, const uint32_t &segment_number, const uint32_t &chunk_number)
+{
+	NotifyProgressiveChunkUpdated(track_id, segment_number, chunk_number);
+}
+
 void LLHlsStream::OnMediaSegmentDeleted(const int32_t &track_id, const uint32_t &segment_number)
 {
 	auto playlist = GetChunklistWriter(track_id);
@@ -1722,11 +1789,150 @@ void LLHlsStream::OnMediaSegmentDeleted(const int32_t &track_id, const uint32_t
 
 void LLHlsStream::NotifyPlaylistUpdated(const int32_t &track_id, const int64_t &msn, const int64_t &part)
 {
-	// Make std::any for broadcast
-	// I think make_shared is better than copy sizeof(PlaylistUpdatedEvent) to all sessions
+	std::set<session_id_t> session_ids;
+
+	{
+		std::lock_guard<std::mutex> lock(_playlist_waiters_lock);
+
+		_last_notified_sequence[track_id] = {msn, part};
+
+		// A waiter (w_msn, w_part) is satisfied if w_msn < msn || (w_msn == msn && w_part <= part)
+		for (auto waiter_track_id : {track_id, kAnyTrack})
+		{
+			auto waiters_it = _playlist_waiters.find(waiter_track_id);
+			if (waiters_it == _playlist_waiters.end())
+			{
+				continue;
+			}
+
+			auto &waiters = waiters_it->second;
+			auto end = waiters.upper_bound({msn, part});
+
+			for (auto it = waiters.begin(); it != end; ++it)
+			{
+				session_ids.insert(it->second);
+			}
+
+			waiters.erase(waiters.begin(), end);
+		}
+	}
+
+	if (session_ids.empty())
+	{
+		return;
+	}
+
+	// Only the sessions which have satisfied requests are notified
 	auto event = std::make_shared<PlaylistUpdatedEvent>(track_id, msn, part);
 	auto notification = std::make_any<std::shared_ptr<PlaylistUpdatedEvent>>(event);
-	BroadcastPacket(notification);
+
+	for (const auto &session_id : session_ids)
+	{
+		auto session = GetSession(session_id);
+		if (session == nullptr)
+		{
+			// The session has been deleted
+			continue;
+		}
+
+		SendMessage(session, notification);
+	}
+}
+
+void LLHlsStream::AddPlaylistWaiter(session_id_t session_id, const int32_t &track_id, const int64_t &msn, const int64_t &part)
+{
+	std::shared_ptr<PlaylistUpdatedEvent> event;
+
+	{
+		std::lock_guard<std::mutex> lock(_playlist_waiters_lock);
+
+		// The playlist may have been updated after the session checked it, so check the last notified sequence
+		for (const auto &[notified_track_id, sequence] : _last_notified_sequence)
+		{
+			if ((track_id != kAnyTrack) && (notified_track_id != track_id))
+			{
+				continue;
+			}
+
+			if (std::make_pair(msn, part) <= sequence)
+			{
+				event = std::make_shared<PlaylistUpdatedEvent>(notified_track_id, sequence.first, sequence.second);
+				break;
+			}
+		}
+
+		if (event == nullptr)
+		{
+			_playlist_waiters[track_id].emplace(std::make_pair(msn, part), session_id);
+			return;
+		}
+	}
+
+	// Already satisfied
+	auto session = GetSession(session_id);
+	if (session != nullptr)
+	{
+		SendMessage(session, std::make_any<std::shared_ptr<PlaylistUpdatedEvent>>(event));
+	}
+}
+
+void LLHlsStream::NotifyProgressiveChunkUpdated(const int32_t &track_id, const int64_t &msn, const int64_t &part)
+{
+	std::set<session_id_t> session_ids;
+
+	{
+		std::lock_guard<std::mutex> lock(_playlist_waiters_lock);
+
+		auto waiters_it = _progressive_chunk_waiters.find(track_id);
+		if (waiters_it == _progressive_chunk_waiters.end() || waiters_it->second.empty())
+		{
+			return;
+		}
+
+		session_ids.swap(waiters_it->second);
+	}
+
+	auto event = std::make_shared<ProgressiveChunkUpdatedEvent>(track_id, msn, part);
+	auto notification = std::make_any<std::shared_ptr<ProgressiveChunkUpdatedEvent>>(event);
+
+	for (const auto &session_id : session_ids)
+	{
+		auto session = GetSession(session_id);
+		if (session == nullptr)
+		{
+			continue;
+		}
+
+		SendMessage(session, notification);
+	}
+}
+
+void LLHlsStream::AddProgressiveChunkWaiter(session_id_t session_id, const int32_t &track_id, const int64_t &msn, const int64_t &part, size_t offset)
+{
+	auto storage = GetStorage(track_id);
+	if (storage == nullptr)
+	{
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_playlist_waiters_lock);
+
+		// The data is appended before the notification, so checking it under the lock does not miss any update
+		auto [found, completed, data_list] = storage->GetMediaChunkDataList(msn, part, offset);
+		if (found == true && completed == false && data_list.empty())
+		{
+			_progressive_chunk_waiters[track_id].insert(session_id);
+			return;
+		}
+	}
+
+	// More data is already available (or the chunk is gone)
+	auto session = GetSession(session_id);
+	if (session != nullptr)
+	{
+		SendMessage(session, std::make_any<std::shared_ptr<ProgressiveChunkUpdatedEvent>>(std::make_shared<ProgressiveChunkUpdatedEvent>(track_id, msn, part)));
+	}
 }
 
 int64_t LLHlsStream::GetMinimumLastSegmentNumber() const
@@ -67,6 +67,35 @@ public:
 		int64_t part;
 	};
 	
+	// Blocking requests index
+	//
+	// A session registers the (msn, part) that its blocked request is waiting for. When the playlist of the track
+	// is updated, only the sessions whose requests are now satisfied receive PlaylistUpdatedEvent (via SendMessage)
+	// instead of broadcasting the event to all sessions.
+	//
+	// track_id: kAnyTrack if the request can be resumed by the update of any track (e.g. master playlist)
+	static constexpr int32_t kAnyTrack = -1;
+	void AddPlaylistWaiter(session_id_t session_id, const int32_t &track_id, const int64_t &msn, const int64_t &part);
+
+	// The chunk in progress has been updated (a fragment is appended or the chunk is completed)
+	struct ProgressiveChunkUpdatedEvent
+	{
+		ProgressiveChunkUpdatedEvent(const int32_t &id, const int64_t &new_msn, const int64_t &new_part)
+		{
+			track_id = id;
+			msn = new_msn;
+			part = new_part;
+		}
+
+		int32_t track_id;
+		int64_t msn;
+		int64_t part;
+	};
+
+	// A session which is delivering the chunk in progress registers the bytes it has sent,
+	// and it receives ProgressiveChunkUpdatedEvent once when more data of the chunk is available.
+	void AddProgressiveChunkWaiter(session_id_t session_id, const int32_t &track_id, const int64_t &msn, const int64_t &part, size_t offset);
+
 	const ov::String &GetStreamKey() const;
 
 	uint64_t GetMaxChunkDurationMS() const;
@@ -74,8 +103,16 @@ public:
 	std::tuple<RequestResult, std::shared_ptr<const ov::Data>> GetMasterPlaylist(const ov::String &file_name, const ov::String &chunk_query_string, bool gzip, bool legacy, bool rewind, bool include_path=true);
 	std::tuple<RequestResult, std::shared_ptr<const ov::Data>> GetChunklist(const ov::String &chunk_query_string, const int32_t &track_id, int64_t msn, int64_t psn, bool skip, bool gzip, bool legacy, bool rewind) const;
 	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetInitializationSegment(const int32_t &track_id) const;
-	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetSegment(const int32_t &track_id, const int64_t &segment_number) const;
-	std::tuple<RequestResult, std::shared_ptr<ov::Data>> GetChunk(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number) const;
+	// The segment/chunk is returned as a list of buffers which refer to the media data held by the storage (no copy)
+	// with the MD5 of the data cached by the segment/chunk if with_md5 is true
+	std::tuple<RequestResult, bmff::FMP4DataList, std::shared_ptr<const ov::Data>> GetSegment(const int32_t &track_id, const int64_t &segment_number, bool with_md5 = false) const;
+	// Returns the path of the segment file if the segment can be sent from the file (DVR)
+	std::tuple<RequestResult, ov::String> GetSegmentFile(const int32_t &track_id, const int64_t &segment_number) const;
+	std::tuple<RequestResult, bmff::FMP4DataList, std::shared_ptr<const ov::Data>> GetChunk(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number, bool with_md5 = false) const;
+	// <result, data list, completed> of the chunk from the offset (in bytes), the chunk may be in progress (progressive chunk)
+	std::tuple<RequestResult, bmff::FMP4DataList, bool> GetProgressiveChunk(const int32_t &track_id, const int64_t &segment_number, const int64_t &chunk_number, size_t offset) const;
+	// <result, segment number, chunk number, file name> of the partial segment of EXT-X-PRELOAD-HINT
+	std::tuple<RequestResult, int64_t, int64_t, ov::String> GetPreloadHintChunk(const int32_t &track_id) const;
 
 	//////////////////////////
 	// For Dump API
@@ -103,11 +140,13 @@ private:
 	bool IsSupportedCodec(cmn::MediaCodecId codec_id) const; 
 
 	void NotifyPlaylistUpdated(const int32_t &track_id, const int64_t &msn, const int64_t &part);
+	void NotifyProgressiveChunkUpdated(const int32_t &track_id, const int64_t &msn, const int64_t &part);
 
 	// bmff::FMp4StorageObserver implementation
 	void OnFMp4StorageInitialized(const int32_t &track_id) override;
 	void OnMediaSegmentCreated(const int32_t &track_id, const uint32_t &segment_number) override;
 	void OnMediaChunkUpdated(const int32_t &track_id, const uint32_t &segment_number, const uint32_t &chunk_number, bool last_chunk) override;
+	void OnMediaChunkFragmentAppended(const int32_t &track_id, const uint32_t &segment_number, const uint32_t &chunk_number) override;
 	void OnMediaSegmentDeleted(const int32_t &track_id, const uint32_t &segment_number) override;
 
 	// Create and Get fMP4 packager and storage with track info, storage and packager_config
@@ -164,6 +203,16 @@ private:
 	// Track ID : Storage
 	std::map<int32_t, std::shared_ptr<bmff::FMP4Storage>> _storage_map;
 	mutable std::shared_mutex _storage_map_lock;
+
+	// (msn, part) : session ID
+	using PlaylistWaiterMap = std::multimap<std::pair<int64_t, int64_t>, session_id_t>;
+	// Track ID : waiters (kAnyTrack for the waiters of any track)
+	std::map<int32_t, PlaylistWaiterMap> _playlist_waiters;
+	// Track ID : the last notified (msn, part)
+	std::map<int32_t, std::pair<int64_t, int64_t>> _last_notified_sequence;
+	// Track ID : sessions delivering the chunk in progress of the track
+	std::map<int32_t, std::set<session_id_t>> _progressive_chunk_waiters;
+	std::mutex _playlist_waiters_lock;
 	std::map<int32_t, std::shared_ptr<bmff::FMP4Packager>> _packager_map;
 	mutable std::shared_mutex _packager_map_lock;
 	std::map<int32_t, std::shared_ptr<LLHlsChunklist>> _chunklist_map;
@@ -235,13 +235,21 @@ void OvtPublisher::OnDataReceived(const std::shared_ptr<ov::Socket> &remote,
 			return;
 		}
 
-		if (app.UpperCaseString() == "DESCRIBE")
+		// Edges which do not know the revision do not send it
+		Json::Value &json_request_revision = object.GetJsonValue()["revision"];
+		uint32_t requested_revision = json_request_revision.isUInt() ? json_request_revision.asUInt() : OVT_PROTOCOL_REVISION_LEGACY;
+
+		if (app.UpperCaseString() == "MULTIPLEX")
+		{
+			HandleMultiplexRequest(remote, request_id, requested_revision);
+		}
+		else if (app.UpperCaseString() == "DESCRIBE")
 		{
 			HandleDescribeRequest(remote, request_id, url);
 		}
 		else if (app.UpperCaseString() == "PLAY")
 		{
-			HandlePlayRequest(remote, request_id, url);
+			HandlePlayRequest(remote, request_id, url, requested_revision);
 		}
 		else if (app.UpperCaseString() == "STOP")
 		{
@@ -281,6 +289,22 @@ void OvtPublisher::OnDisconnected(const std::shared_ptr<ov::Socket> &remote,
 	RemoveDepacketizer(remote->GetNativeHandle());
 }
 
+void OvtPublisher::HandleMultiplexRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, uint32_t requested_revision)
+{
+	if (requested_revision < OVT_PROTOCOL_REVISION_MULTIPLEXED)
+	{
+		ResponseResult(remote, 0, "multiplex", request_id, 400, "Multiplexing requires revision 3 or later");
+		return;
+	}
+
+	logti("OvtProvider multiplexes streams over the connection : %s", remote->ToString().CStr());
+
+	Json::Value contents;
+	contents["revision"] = OVT_PROTOCOL_REVISION;
+
+	ResponseResult(remote, 0, "multiplex", request_id, 200, "ok", contents);
+}
+
 void OvtPublisher::HandleDescribeRequest(const std::shared_ptr<ov::Socket> &remote, const uint32_t request_id, const std::shared_ptr<const ov::Url> &url)
 {
 	auto orchestrator = ocst::Orchestrator::GetInstance();
@@ -331,7 +355,7 @@ void OvtPublisher::HandleDescribeRequest(const std::shared_ptr<ov::Socket> &remo
 	ResponseResult(remote, 0, "describe", request_id, 200, "ok", description);
 }
 
-void OvtPublisher::HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, const std::shared_ptr<const ov::Url> &url)
+void OvtPublisher::HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, const std::shared_ptr<const ov::Url> &url, uint32_t requested_revision)
 {
 	auto vhost_app_name = ocst::Orchestrator::GetInstance()->ResolveApplicationNameFromDomain(url->Host(), url->App());
 
@@ -353,8 +377,10 @@ void OvtPublisher::HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote,
 		return;
 	}
 
+	auto revision = std::clamp<uint32_t>(requested_revision, OVT_PROTOCOL_REVISION_LEGACY, OVT_PROTOCOL_REVISION);
+
 	// Session ID is remote socket's ID
-	auto session = OvtSession::Create(app, stream, remote->GetNativeHandle(), remote);
+	auto session = OvtSession::Create(app, stream, remote->GetNativeHandle(), remote, revision);
 	if (session == nullptr)
 	{
 		ov::String msg;
@@ -365,7 +391,16 @@ void OvtPublisher::HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote,
 
 	LinkRemoteWithStream(remote->GetNativeHandle(), stream);
 
-	ResponseResult(remote, session->GetId(), "play", request_id, 200, "ok");
+	Json::Value contents;
+	contents["revision"] = revision;
+
+	if (revision >= OVT_PROTOCOL_REVISION_MULTIPLEXED)
+	{
+		// The packets of the stream are classified by the stream ID in the multiplexed connection
+		contents["channelId"] = stream->GetId();
+	}
+
+	ResponseResult(remote, session->GetId(), "play", request_id, 200, "ok", contents);
 
 	stream->AddSession(session);
 }
@@ -387,6 +422,9 @@ void OvtPublisher::HandleStopRequest(const std::shared_ptr<ov::Socket> &remote,
 
 	// Session ID is remote socket's ID
 	stream->RemoveSession(remote->GetNativeHandle());
+
+	// The connection may still be used by the other streams (multiplexed)
+	UnlinkRemoteFromStream(remote->GetNativeHandle(), stream);
 }
 
 void OvtPublisher::ResponseResult(const std::shared_ptr<ov::Socket> &remote, uint32_t session_id, const ov::String app, uint32_t request_id, uint32_t code, const ov::String &msg)
@@ -452,3 +490,23 @@ bool OvtPublisher::UnlinkRemoteFromStream(int remote_id)
 
 	return true;
 }
+
+bool OvtPublisher::UnlinkRemoteFromStream(int remote_id, const std::shared_ptr<OvtStream> &stream)
+{
+	std::lock_guard<std::shared_mutex> guard(_remote_stream_map_lock);
+	auto streams = _remote_stream_map.equal_range(remote_id);
+
+	for (auto it = streams.first; it != streams.second;)
+	{
+		if (it->second == stream)
+		{
+			it = _remote_stream_map.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+
+	return true;
+}
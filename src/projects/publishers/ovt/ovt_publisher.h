@@ -8,6 +8,7 @@
 #include "base/publisher/publisher.h"
 #include "modules/ovt_packetizer/ovt_depacketizer.h"
 #include "modules/ovt_packetizer/ovt_packet.h"
+#include "modules/ovt_packetizer/ovt_signaling.h"
 #include "ovt_application.h"
 
 class OvtPublisher : public pub::Publisher, public PhysicalPortObserver
@@ -49,8 +50,9 @@ private:
 	void OnDisconnected(const std::shared_ptr<ov::Socket> &remote, PhysicalPortDisconnectReason reason, const std::shared_ptr<const ov::Error> &error) override;
 	//--------------------------------------------------------------------
 
+	void HandleMultiplexRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, uint32_t requested_revision);
 	void HandleDescribeRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, const std::shared_ptr<const ov::Url> &url);
-	void HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, const std::shared_ptr<const ov::Url> &url);
+	void HandlePlayRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t request_id, const std::shared_ptr<const ov::Url> &url, uint32_t requested_revision);
 	void HandleStopRequest(const std::shared_ptr<ov::Socket> &remote, uint32_t session_id, uint32_t request_id, const std::shared_ptr<const ov::Url> &url);
 
 	void ResponseResult(const std::shared_ptr<ov::Socket> &remote, uint32_t session_id, const ov::String app, uint32_t request_id, uint32_t code, const ov::String &msg);
@@ -60,6 +62,7 @@ private:
 
 	bool LinkRemoteWithStream(int remote_id, std::shared_ptr<OvtStream> &stream);
 	bool UnlinkRemoteFromStream(int remote_id);
+	bool UnlinkRemoteFromStream(int remote_id, const std::shared_ptr<OvtStream> &stream);
 
 	std::shared_ptr<OvtDepacketizer> GetDepacketizer(int remote_id);
 	bool RemoveDepacketizer(int remote_id);
@@ -2,6 +2,8 @@
 #include <base/ovlibrary/byte_io.h>
 #include <base/publisher/stream.h>
 #include <modules/ovt_packetizer/ovt_packet.h>
+#include <modules/ovt_packetizer/ovt_packetizer.h>
+#include <modules/ovt_packetizer/ovt_signaling.h>
 #include <monitoring/monitoring.h>
 #include "ovt_session.h"
 #include "ovt_private.h"
@@ -9,10 +11,11 @@
 std::shared_ptr<OvtSession> OvtSession::Create(const std::shared_ptr<pub::Application> &application,
 										  	   const std::shared_ptr<pub::Stream> &stream,
 										  	   uint32_t session_id,
-										  	   const std::shared_ptr<ov::Socket> &connector)
+										  	   const std::shared_ptr<ov::Socket> &connector,
+										  	   uint32_t protocol_revision)
 {
 	auto session_info = info::Session(*std::static_pointer_cast<info::Stream>(stream), session_id);
-	auto session = std::make_shared<OvtSession>(session_info, application, stream, connector);
+	auto session = std::make_shared<OvtSession>(session_info, application, stream, connector, protocol_revision);
 	if(!session->Start())
 	{
 		return nullptr;
@@ -23,11 +26,13 @@ std::shared_ptr<OvtSession> OvtSession::Create(const std::shared_ptr<pub::Applic
 OvtSession::OvtSession(const info::Session &session_info,
 		   const std::shared_ptr<pub::Application> &application,
 		   const std::shared_ptr<pub::Stream> &stream,
-		   const std::shared_ptr<ov::Socket> &connector)
+		   const std::shared_ptr<ov::Socket> &connector,
+		   uint32_t protocol_revision)
    : pub::Session(session_info, application, stream)
 {
 	_connector = connector;
 	_sent_ready = false;
+	_protocol_revision = protocol_revision;
 
 	MonitorInstance->OnSessionConnected(*GetStream(), PublisherType::Ovt);
 }
@@ -49,7 +54,12 @@ bool OvtSession::Start()
 bool OvtSession::Stop()
 {
 	logtd("OvtSession(%d) has stopped", GetId());
-	_connector->Close();
+
+	// If multiplexed, the connection is shared by the other streams, the edge closes it
+	if (_protocol_revision < OVT_PROTOCOL_REVISION_MULTIPLEXED)
+	{
+		_connector->Close();
+	}
 	
 	return Session::Stop();
 }
@@ -83,7 +93,22 @@ void OvtSession::SendOutgoingData(const std::any &packet)
 		return;
 	}
 
-	// Set OVT Session ID into packet
+	if (_protocol_revision >= OVT_PROTOCOL_REVISION_MULTIPLEXED)
+	{
+		if (ShouldDropMediaPacket(session_packet))
+		{
+			return;
+		}
+	}
+
+	if (_protocol_revision >= OVT_PROTOCOL_REVISION_CONNECTION_BOUND_SESSION)
+	{
+		// The session is bound to the connection, so the packet shared by all sessions is sent as it is
+		_connector->Send(session_packet->GetData());
+		return;
+	}
+
+	// Legacy edge: Set OVT Session ID into packet
 	auto copy_packet = std::make_shared<OvtPacket>(*session_packet);
 	copy_packet->SetSessionId(GetId());
 
@@ -95,6 +120,106 @@ const std::shared_ptr<ov::Socket> OvtSession::GetConnector()
 	return _connector;
 }
 
+uint32_t OvtSession::GetProtocolRevision() const
+{
+	return _protocol_revision;
+}
+
+bool OvtSession::ShouldDropMediaPacket(const std::shared_ptr<OvtPacket> &packet)
+{
+	// All packets of a media packet are sent or dropped together
+	if (_at_media_packet_boundary)
+	{
+		// The pending bytes are shared by all streams in the connection, but each stream recovers with its own keyframe
+		auto pending_bytes = _connector->GetPendingSendBytes();
+
+		if (pending_bytes > CONGESTION_HIGH_WATERMARK)
+		{
+			if (_waiting_for_keyframe == false)
+			{
+				logtw("OvtSession(%d) - The connection is congested (%zu bytes pending), drops the frames until the next keyframe", GetId(), pending_bytes);
+			}
+
+			_waiting_for_keyframe = true;
+		}
+
+		if (_waiting_for_keyframe && IsVideoKeyframe(packet) && (pending_bytes < CONGESTION_LOW_WATERMARK))
+		{
+			logti("OvtSession(%d) - Resumes from the keyframe (%" PRIu64 " frames dropped)", GetId(), _dropped_media_packet_count);
+			_waiting_for_keyframe = false;
+		}
+
+		// Keyframes, audio and data are not dropped while waiting for the keyframe
+		_dropping_media_packet = _waiting_for_keyframe && (packet->Keyframe() == false);
+
+		if (_dropping_media_packet)
+		{
+			_dropped_media_packet_count++;
+		}
+	}
+
+	_at_media_packet_boundary = packet->Marker();
+
+	return _dropping_media_packet;
+}
+
+bool OvtSession::IsVideoKeyframe(const std::shared_ptr<OvtPacket> &packet)
+{
+	if ((packet->Keyframe() == false) ||
+		(packet->PayloadType() != OVT_PAYLOAD_TYPE_MEDIA_PACKET) ||
+		(packet->PayloadLength() < MEDIA_PACKET_HEADER_SIZE))
+	{
+		return false;
+	}
+
+	// MediaType of the media packet header
+	auto media_type = static_cast<cmn::MediaType>(ByteReader<uint8_t>::ReadBigEndian(&packet->Payload()[28]));
+
+	return (media_type == cmn::MediaType::Video);
+}
+
+void OvtSession::NotifyStreamStopped()
+{
+	if (_protocol_revision < OVT_PROTOCOL_REVISION_MULTIPLEXED)
+	{
+		// The connection is closed by Stop()
+		return;
+	}
+
+	if (_stop_notified.exchange(true))
+	{
+		return;
+	}
+
+	SendStopNotification();
+}
+
+void OvtSession::SendStopNotification()
+{
+	Json::Value root;
+	Json::Value contents;
+
+	contents["channelId"] = GetStream()->GetId();
+
+	root["id"] = 0;
+	root["application"] = "stop";
+	root["code"] = 200;
+	root["message"] = "stream has been stopped";
+	root["contents"] = contents;
+
+	OvtPacketizer packetizer;
+
+	if (packetizer.PacketizeMessage(OVT_PAYLOAD_TYPE_MESSAGE_RESPONSE, ov::Clock::NowMSec(), ov::Json::Stringify(root).ToData(false)) == false)
+	{
+		return;
+	}
+
+	while (packetizer.IsAvailablePackets())
+	{
+		_connector->Send(packetizer.PopPacket()->GetData());
+	}
+}
+
 void OvtSession::OnMessageReceived(const std::any &message)
 {
 	// NOTHING YET
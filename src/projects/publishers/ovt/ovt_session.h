@@ -3,19 +3,27 @@
 #include <base/info/media_track.h>
 #include <base/ovsocket/socket.h>
 #include <base/publisher/session.h>
+#include <modules/ovt_packetizer/ovt_packet.h>
 
 class OvtSession : public pub::Session
 {
 public:
+	// When the pending bytes of a multiplexed connection exceed the high watermark, the sessions drop the video frames
+	// which are not keyframes until the next keyframe after the pending bytes go below the low watermark
+	static constexpr size_t CONGESTION_HIGH_WATERMARK = 8 * 1024 * 1024;
+	static constexpr size_t CONGESTION_LOW_WATERMARK = 2 * 1024 * 1024;
+
 	static std::shared_ptr<OvtSession> Create(const std::shared_ptr<pub::Application> &application,
 											  const std::shared_ptr<pub::Stream> &stream,
 											  uint32_t ovt_session_id,
-											  const std::shared_ptr<ov::Socket> &connector);
+											  const std::shared_ptr<ov::Socket> &connector,
+											  uint32_t protocol_revision);
 
 	OvtSession(const info::Session &session_info,
 			const std::shared_ptr<pub::Application> &application,
 			const std::shared_ptr<pub::Stream> &stream,
-			const std::shared_ptr<ov::Socket> &connector);
+			const std::shared_ptr<ov::Socket> &connector,
+			uint32_t protocol_revision);
 	~OvtSession() override;
 
 	bool Start() override;
@@ -25,8 +33,31 @@ public:
 	void OnMessageReceived(const std::any &message) override;
 
 	const std::shared_ptr<ov::Socket> GetConnector();
+	uint32_t GetProtocolRevision() const;
+
+	// Called when the origin stream is stopped (OVT_PROTOCOL_REVISION_MULTIPLEXED)
+	// Notifies the edge only once. It is not sent when the edge stops the session or the session is deleted.
+	void NotifyStreamStopped();
 
 private:
+	// Whether the media packet which starts with the packet should be dropped (OVT_PROTOCOL_REVISION_MULTIPLEXED)
+	bool ShouldDropMediaPacket(const std::shared_ptr<OvtPacket> &packet);
+	// K is also set for audio and data, so the media type in the header of the media packet is checked
+	// The packet must be the first packet of a media packet
+	static bool IsVideoKeyframe(const std::shared_ptr<OvtPacket> &packet);
+	// Notifies the edge that the stream has been stopped, without closing the multiplexed connection
+	void SendStopNotification();
+
 	std::shared_ptr<ov::Socket>		_connector;
 	bool 							_sent_ready;
+	// OVT_PROTOCOL_REVISION_XXX negotiated with PLAY
+	uint32_t						_protocol_revision;
+
+	// Whether the next packet is the first packet of a media packet
+	bool							_at_media_packet_boundary = true;
+	bool							_dropping_media_packet = false;
+	bool							_waiting_for_keyframe = false;
+	uint64_t						_dropped_media_packet_count = 0;
+
+	std::atomic<bool>				_stop_notified{false};
 };
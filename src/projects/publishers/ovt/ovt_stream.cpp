@@ -56,6 +56,8 @@ bool OvtStream::Start()
 
 	logtd("OvtStream(%d) has been started", GetId());
 	_packetizer = std::make_shared<OvtPacketizer>(OvtPacketizerInterface::GetSharedPtr());
+	// Channel ID of the stream in the multiplexed connections, sessions of the legacy edges overwrite it
+	_packetizer->SetSessionId(GetId());
 
 	return Stream::Start();
 }
@@ -88,6 +90,13 @@ bool OvtStream::Stop()
 	}
 	mlock.unlock();
 
+	// The edges which share the connection with other streams are notified that the stream has been stopped
+	for (const auto &item : GetAllSessions())
+	{
+		auto session = std::static_pointer_cast<OvtSession>(item.second);
+		session->NotifyStreamStopped();
+	}
+
 	return Stream::Stop();
 }
 
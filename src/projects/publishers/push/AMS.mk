@@ -1,6 +1,9 @@
 LOCAL_PATH := $(call get_local_path)
 include $(DEFAULT_VARIABLES)
 
+LOCAL_STATIC_LIBRARIES := \
+	rtmp_v2_module
+
 LOCAL_TARGET := push_publisher
 
 $(call add_pkg_config,srt)
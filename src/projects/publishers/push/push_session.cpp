@@ -66,6 +66,22 @@ namespace pub
 			dest_url = ov::String::FormatString("%s/%s", GetPush()->GetUrl().CStr(), GetPush()->GetStreamKey().CStr());
 		}
 
+		if (IsNativeRtmpEnabled())
+		{
+			if (StartRtmpPushClient() == false)
+			{
+				SetState(SessionState::Error);
+				GetPush()->SetState(info::Push::PushState::Error);
+
+				return false;
+			}
+
+			// The state of the push is changed to Pushing when the server accepts the publish (see SendOutgoingDataByRtmpPushClient())
+			logtd("PushSession(%d) has started with the native RTMP client.", GetId());
+
+			return Session::Start();
+		}
+
 		auto writer = CreateWriter();
 		if (writer == nullptr)
 		{
@@ -129,6 +145,32 @@ namespace pub
 
 	bool PushSession::Stop()
 	{
+		std::shared_ptr<RtmpPushClient> rtmp_push_client;
+		{
+			std::lock_guard<std::shared_mutex> lock(_rtmp_push_client_mutex);
+			rtmp_push_client = std::move(_rtmp_push_client);
+		}
+
+		if (rtmp_push_client != nullptr)
+		{
+			auto push = GetPush();
+			if (push != nullptr)
+			{
+				push->SetState(info::Push::PushState::Stopping);
+				push->UpdatePushStartTime();
+			}
+
+			rtmp_push_client->Stop();
+
+			if (push != nullptr)
+			{
+				push->SetState(info::Push::PushState::Stopped);
+				push->IncreaseSequence();
+			}
+
+			logtd("PushSession(%d) has stopped (dropped packets: %" PRIu64 ")", GetId(), rtmp_push_client->GetDroppedPacketCount());
+		}
+
 		auto writer = GetWriter();
 		if (writer != nullptr)
 		{
@@ -179,6 +221,13 @@ namespace pub
 			return;
 		}
 
+		auto rtmp_push_client = GetRtmpPushClient();
+		if (rtmp_push_client != nullptr)
+		{
+			SendOutgoingDataByRtmpPushClient(rtmp_push_client, session_packet);
+			return;
+		}
+
 		auto writer = GetWriter();
 		if (writer == nullptr)
 		{
@@ -206,6 +255,99 @@ namespace pub
 		MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Push, sent_bytes);
 	}
 
+	void PushSession::SendOutgoingDataByRtmpPushClient(const std::shared_ptr<RtmpPushClient> &client, const std::shared_ptr<MediaPacket> &packet)
+	{
+		uint64_t sent_bytes = 0;
+
+		if (client->SendPacket(packet, &sent_bytes) == false)
+		{
+			logte("Failed to send packet");
+
+			client->Stop();
+
+			SetState(SessionState::Error);
+			GetPush()->SetState(info::Push::PushState::Error);
+
+			return;
+		}
+
+		if ((client->GetState() == RtmpPushClient::State::Publishing) &&
+			(GetPush()->GetState() == info::Push::PushState::Connecting))
+		{
+			GetPush()->SetState(info::Push::PushState::Pushing);
+		}
+
+		if (sent_bytes == 0)
+		{
+			// Not published yet, or dropped because the destination is too slow
+			return;
+		}
+
+		GetPush()->UpdatePushTime();
+		GetPush()->IncreasePushBytes(sent_bytes);
+
+		MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Push, sent_bytes);
+	}
+
+	bool PushSession::IsNativeRtmpEnabled()
+	{
+		if (GetPush()->GetProtocolType() != info::Push::ProtocolType::RTMP)
+		{
+			return false;
+		}
+
+		// RTMPS is still handled by ffmpeg
+		if (GetPush()->GetUrl().LowerCaseString().HasPrefix("rtmp://") == false)
+		{
+			return false;
+		}
+
+		return GetApplication()->GetConfig().GetPublishers().GetPushPublisher().IsNativeRtmp();
+	}
+
+	bool PushSession::StartRtmpPushClient()
+	{
+		auto &push_config = GetApplication()->GetConfig().GetPublishers().GetPushPublisher();
+		auto client = RtmpPushClient::Create(static_cast<size_t>(std::max(push_config.GetSendBufferSize(), 0)));
+
+		for (auto &[track_id, track] : GetStream()->GetTracks())
+		{
+			if (IsSelectedTrack(track) == false)
+			{
+				continue;
+			}
+
+			if ((IsSupportTrack(GetPush()->GetProtocolType(), track) == false) ||
+				(IsSupportCodec(GetPush()->GetProtocolType(), track->GetCodecId()) == false))
+			{
+				logtd("Could not supported track. track_id:%d, codec_id: %d", track->GetId(), track->GetCodecId());
+				continue;
+			}
+
+			if (client->AddTrack(track) == false)
+			{
+				logtw("Failed to add new track. track_id:%d", track->GetId());
+			}
+		}
+
+		if (client->Start(GetPush()->GetUrl(), GetPush()->GetStreamKey()) == false)
+		{
+			client->Stop();
+			return false;
+		}
+
+		std::lock_guard<std::shared_mutex> lock(_rtmp_push_client_mutex);
+		_rtmp_push_client = client;
+
+		return true;
+	}
+
+	std::shared_ptr<RtmpPushClient> PushSession::GetRtmpPushClient()
+	{
+		std::shared_lock<std::shared_mutex> lock(_rtmp_push_client_mutex);
+		return _rtmp_push_client;
+	}
+
 	std::shared_ptr<ffmpeg::Writer> PushSession::CreateWriter()
 	{
 		std::lock_guard<std::shared_mutex> lock(_writer_mutex);
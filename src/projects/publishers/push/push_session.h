@@ -15,6 +15,7 @@
 #include <modules/ffmpeg/compat.h>
 
 #include "base/info/push.h"
+#include "rtmp_push_client.h"
 
 namespace pub
 {
@@ -39,11 +40,17 @@ namespace pub
 
 		std::shared_ptr<info::Push> GetPush();
 		std::shared_ptr<ffmpeg::Writer> GetWriter();
+		std::shared_ptr<RtmpPushClient> GetRtmpPushClient();
 
 	private:
 		std::shared_ptr<ffmpeg::Writer> CreateWriter();
 		void DestoryWriter();
 
+		// Returns true if the built-in RTMP client is used instead of ffmpeg::Writer
+		bool IsNativeRtmpEnabled();
+		bool StartRtmpPushClient();
+		void SendOutgoingDataByRtmpPushClient(const std::shared_ptr<RtmpPushClient> &client, const std::shared_ptr<MediaPacket> &packet);
+
 		bool IsSelectedTrack(const std::shared_ptr<MediaTrack> &track);
 		bool IsSupportTrack(const info::Push::ProtocolType protocol_type, const std::shared_ptr<MediaTrack> &track);
 		bool IsSupportCodec(const info::Push::ProtocolType protocol_type, cmn::MediaCodecId codec_id);
@@ -53,5 +60,8 @@ namespace pub
 
 		std::shared_ptr<ffmpeg::Writer> _writer = nullptr;
 		std::shared_mutex _writer_mutex;
+
+		std::shared_ptr<RtmpPushClient> _rtmp_push_client = nullptr;
+		std::shared_mutex _rtmp_push_client_mutex;
 	};
 }  // namespace pub
\ No newline at end of file
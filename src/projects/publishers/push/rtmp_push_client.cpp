@@ -0,0 +1,1063 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Keukhan
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "rtmp_push_client.h"
+
+#include <modules/bitstream/aac/aac_converter.h>
+#include <modules/bitstream/nalu/nal_stream_converter.h>
+#include <modules/containers/flv_v2/flv_datastructure.h>
+
+#include "push_private.h"
+
+// Size of the chunk which is sent to the server
+#define RTMP_PUSH_CHUNK_SIZE 4096
+// The server uses 128 bytes until it sends SetChunkSize
+#define RTMP_PUSH_DEFAULT_PEER_CHUNK_SIZE 128
+#define RTMP_PUSH_RECV_BUFFER_SIZE (64 * 1024)
+#define RTMP_PUSH_DEFAULT_PORT 1935
+
+// S0 + S1 + S2
+#define RTMP_PUSH_HANDSHAKE_RESPONSE_LENGTH (1 + modules::rtmp::HANDSHAKE_PACKET_LENGTH * 2)
+
+// Transaction IDs of the commands which are sent by the client
+#define RTMP_PUSH_TRANSACTION_CONNECT 1.0
+#define RTMP_PUSH_TRANSACTION_RELEASE_STREAM 2.0
+#define RTMP_PUSH_TRANSACTION_FC_PUBLISH 3.0
+#define RTMP_PUSH_TRANSACTION_CREATE_STREAM 4.0
+#define RTMP_PUSH_TRANSACTION_PUBLISH 5.0
+
+namespace pub
+{
+	constexpr const char *StateToString(RtmpPushClient::State state)
+	{
+		switch (state)
+		{
+			OV_CASE_RETURN(RtmpPushClient::State::Idle, "Idle");
+			OV_CASE_RETURN(RtmpPushClient::State::Connecting, "Connecting");
+			OV_CASE_RETURN(RtmpPushClient::State::Handshaking, "Handshaking");
+			OV_CASE_RETURN(RtmpPushClient::State::WaitingForConnectResult, "WaitingForConnectResult");
+			OV_CASE_RETURN(RtmpPushClient::State::WaitingForCreateStreamResult, "WaitingForCreateStreamResult");
+			OV_CASE_RETURN(RtmpPushClient::State::WaitingForPublishStart, "WaitingForPublishStart");
+			OV_CASE_RETURN(RtmpPushClient::State::Publishing, "Publishing");
+			OV_CASE_RETURN(RtmpPushClient::State::Stopped, "Stopped");
+			OV_CASE_RETURN(RtmpPushClient::State::Error, "Error");
+		}
+
+		return "Unknown";
+	}
+
+	std::shared_ptr<RtmpPushClient> RtmpPushClient::Create(size_t send_buffer_size)
+	{
+		return std::make_shared<RtmpPushClient>(send_buffer_size);
+	}
+
+	RtmpPushClient::RtmpPushClient(size_t send_buffer_size)
+		: _send_buffer_size(send_buffer_size),
+		  _chunk_parser(RTMP_PUSH_DEFAULT_PEER_CHUNK_SIZE),
+		  _chunk_writer(RTMP_PUSH_CHUNK_SIZE)
+	{
+	}
+
+	RtmpPushClient::~RtmpPushClient()
+	{
+		Stop();
+	}
+
+	bool RtmpPushClient::AddTrack(const std::shared_ptr<MediaTrack> &track)
+	{
+		switch (track->GetMediaType())
+		{
+			case cmn::MediaType::Video:
+				if ((_video_track != nullptr) || (track->GetCodecId() != cmn::MediaCodecId::H264))
+				{
+					return false;
+				}
+				_video_track = track;
+				return true;
+
+			case cmn::MediaType::Audio:
+				if ((_audio_track != nullptr) || (track->GetCodecId() != cmn::MediaCodecId::Aac))
+				{
+					return false;
+				}
+				_audio_track = track;
+				return true;
+
+			case cmn::MediaType::Data:
+				if (_data_track != nullptr)
+				{
+					return false;
+				}
+				_data_track = track;
+				return true;
+
+			default:
+				break;
+		}
+
+		return false;
+	}
+
+	bool RtmpPushClient::Start(const ov::String &url, const ov::String &stream_key)
+	{
+		auto parsed_url = ov::Url::Parse(url);
+
+		if (parsed_url == nullptr)
+		{
+			logte("Invalid URL: %s", url.CStr());
+			return false;
+		}
+
+		if (parsed_url->Scheme().LowerCaseString() != "rtmp")
+		{
+			logte("Unsupported scheme: %s (URL: %s)", parsed_url->Scheme().CStr(), url.CStr());
+			return false;
+		}
+
+		auto path = parsed_url->Path();
+		while (path.HasPrefix("/"))
+		{
+			path = path.Substring(1);
+		}
+
+		while (path.HasSuffix("/"))
+		{
+			path = path.Substring(0, path.GetLength() - 1);
+		}
+
+		if (stream_key.IsEmpty() == false)
+		{
+			// rtmp://host/app + stream_key
+			_app_name = path;
+			_stream_name = stream_key;
+			_tc_url = url;
+		}
+		else
+		{
+			// rtmp://host/app/stream
+			auto index = path.IndexOfRev('/');
+
+			if (index < 0)
+			{
+				logte("Could not find the stream name from URL: %s", url.CStr());
+				return false;
+			}
+
+			_app_name = path.Substring(0, index);
+			_stream_name = path.Substring(index + 1);
+			_tc_url = ov::String::FormatString("%s://%s/%s", parsed_url->Scheme().CStr(), parsed_url->Host().CStr(), _app_name.CStr());
+
+			if (parsed_url->Port() != 0)
+			{
+				_tc_url = ov::String::FormatString("%s://%s:%d/%s", parsed_url->Scheme().CStr(), parsed_url->Host().CStr(), parsed_url->Port(), _app_name.CStr());
+			}
+		}
+
+		if (_app_name.IsEmpty() || _stream_name.IsEmpty())
+		{
+			logte("Could not find the application/stream name from URL: %s (stream key: %s)", url.CStr(), stream_key.CStr());
+			return false;
+		}
+
+		auto port = (parsed_url->Port() == 0) ? RTMP_PUSH_DEFAULT_PORT : parsed_url->Port();
+		auto socket_address = ov::SocketAddress::CreateAndGetFirst(ov::String::FormatString("%s:%d", parsed_url->Host().CStr(), port));
+
+		if (socket_address.IsValid() == false)
+		{
+			logte("Invalid address: %s:%d (URL: %s)", parsed_url->Host().CStr(), port, url.CStr());
+			return false;
+		}
+
+		auto socket = ov::SocketPool::GetTcpPool()->AllocSocket(socket_address.GetFamily());
+
+		if (socket == nullptr)
+		{
+			logte("Could not create a socket");
+			return false;
+		}
+
+		if (socket->MakeNonBlocking(GetSharedPtr()) == false)
+		{
+			logte("Could not make the socket nonblocking");
+			socket->Close();
+			return false;
+		}
+
+		{
+			std::lock_guard lock_guard(_socket_mutex);
+			_socket = socket;
+		}
+
+		SetState(State::Connecting);
+
+		logtd("Connecting to %s (app: %s, stream: %s, address: %s)...",
+			  _tc_url.CStr(), _app_name.CStr(), _stream_name.CStr(), socket_address.ToString(false).CStr());
+
+		auto error = socket->Connect(socket_address);
+
+		if (error != nullptr)
+		{
+			logte("Could not connect to %s: %s", url.CStr(), error->What());
+			SetState(State::Error);
+			return false;
+		}
+
+		// The result will be notified through OnConnected()
+		return true;
+	}
+
+	void RtmpPushClient::Stop()
+	{
+		SetState(State::Stopped);
+
+		std::lock_guard lock_guard(_socket_mutex);
+		OV_SAFE_RESET(_socket, nullptr, _socket->Close(), _socket);
+	}
+
+	void RtmpPushClient::SetState(State state)
+	{
+		auto current_state = _state.load();
+
+		do
+		{
+			if ((current_state == State::Stopped) || (current_state == state))
+			{
+				// Once stopped, the state is not changed anymore
+				return;
+			}
+		} while (_state.compare_exchange_weak(current_state, state) == false);
+
+		logtd("RTMP push state is changed: %s => %s (%s/%s)", StateToString(current_state), StateToString(state), _tc_url.CStr(), _stream_name.CStr());
+	}
+
+	std::shared_ptr<ov::Socket> RtmpPushClient::GetSocket()
+	{
+		std::lock_guard lock_guard(_socket_mutex);
+		return _socket;
+	}
+
+	void RtmpPushClient::OnConnected(const std::shared_ptr<const ov::SocketError> &error)
+	{
+		if (error != nullptr)
+		{
+			logte("Could not connect to %s: %s", _tc_url.CStr(), error->What());
+			SetState(State::Error);
+			return;
+		}
+
+		SetState(State::Handshaking);
+
+		if (SendHandshake() == false)
+		{
+			SetState(State::Error);
+		}
+	}
+
+	void RtmpPushClient::OnReadable()
+	{
+		auto socket = GetSocket();
+
+		if (socket == nullptr)
+		{
+			return;
+		}
+
+		auto data = std::make_shared<ov::Data>(RTMP_PUSH_RECV_BUFFER_SIZE);
+
+		while (true)
+		{
+			auto error = socket->Recv(data);
+
+			if (error != nullptr)
+			{
+				logte("Could not receive data from %s: %s", _tc_url.CStr(), error->What());
+				SetState(State::Error);
+				return;
+			}
+
+			if (data->IsEmpty())
+			{
+				// Read data next time
+				return;
+			}
+
+			std::shared_ptr<const ov::Data> remained_data = data;
+
+			if (_state == State::Handshaking)
+			{
+				size_t bytes_used = 0;
+
+				if (HandleHandshake(remained_data, &bytes_used) == false)
+				{
+					SetState(State::Error);
+					return;
+				}
+
+				remained_data = remained_data->Subdata(bytes_used);
+			}
+
+			if ((remained_data->IsEmpty() == false) && (HandleData(remained_data) == false))
+			{
+				SetState(State::Error);
+				return;
+			}
+		}
+	}
+
+	void RtmpPushClient::OnClosed()
+	{
+		if (_state != State::Stopped)
+		{
+			logtw("The connection is closed by the server: %s/%s", _tc_url.CStr(), _stream_name.CStr());
+		}
+
+		SetState(State::Error);
+	}
+
+	bool RtmpPushClient::SendHandshake()
+	{
+		// C0 + C1
+		//
+		// C1: time (4 bytes) + zero (4 bytes) + random bytes (1528 bytes)
+		ov::Data handshake(1 + modules::rtmp::HANDSHAKE_PACKET_LENGTH);
+		handshake.SetLength(1 + modules::rtmp::HANDSHAKE_PACKET_LENGTH);
+
+		auto buffer = handshake.GetWritableDataAs<uint8_t>();
+		buffer[0] = modules::rtmp::HANDSHAKE_VERSION;
+		::memset(buffer + 1, 0, 8);
+		ov::Random::Fill(buffer + 1 + 8, modules::rtmp::HANDSHAKE_PACKET_LENGTH - 8);
+
+		auto socket = GetSocket();
+
+		return (socket != nullptr) && socket->Send(handshake.Clone());
+	}
+
+	bool RtmpPushClient::HandleHandshake(const std::shared_ptr<const ov::Data> &data, size_t *bytes_used)
+	{
+		auto needed_length = RTMP_PUSH_HANDSHAKE_RESPONSE_LENGTH - _handshake_data.GetLength();
+		auto length = std::min(needed_length, data->GetLength());
+
+		_handshake_data.Append(data->GetData(), length);
+		*bytes_used = length;
+
+		if (_handshake_data.GetLength() < RTMP_PUSH_HANDSHAKE_RESPONSE_LENGTH)
+		{
+			// Need more data
+			return true;
+		}
+
+		auto buffer = _handshake_data.GetDataAs<uint8_t>();
+
+		if (buffer[0] != modules::rtmp::HANDSHAKE_VERSION)
+		{
+			logte("Unsupported RTMP version: %d", buffer[0]);
+			return false;
+		}
+
+		auto socket = GetSocket();
+
+		if (socket == nullptr)
+		{
+			return false;
+		}
+
+		// C2: echo of S1
+		if (socket->Send(buffer + 1, modules::rtmp::HANDSHAKE_PACKET_LENGTH) == false)
+		{
+			return false;
+		}
+
+		_handshake_data.Clear();
+
+		SetState(State::WaitingForConnectResult);
+
+		return SendSetChunkSize(RTMP_PUSH_CHUNK_SIZE) && SendAmfConnect();
+	}
+
+	bool RtmpPushClient::HandleData(const std::shared_ptr<const ov::Data> &data)
+	{
+		AccumulateAcknowledgementSize(data->GetLength());
+
+		std::shared_ptr<const ov::Data> current_data = data;
+
+		if ((_remained_data != nullptr) && (_remained_data->IsEmpty() == false))
+		{
+			_remained_data->Append(data);
+			current_data = _remained_data;
+		}
+
+		_remained_data = nullptr;
+
+		while (current_data->IsEmpty() == false)
+		{
+			size_t bytes_used = 0;
+			auto status = _chunk_parser.Parse(current_data, &bytes_used);
+
+			switch (status)
+			{
+				case modules::rtmp::ChunkParser::ParseResult::Error:
+					logte("An error occurred while parse RTMP data");
+					return false;
+
+				case modules::rtmp::ChunkParser::ParseResult::NeedMoreData:
+					// The parser parses the unused data again from the beginning next time
+					if (bytes_used < current_data->GetLength())
+					{
+						_remained_data = current_data->Subdata(bytes_used)->Clone();
+					}
+					return true;
+
+				case modules::rtmp::ChunkParser::ParseResult::Parsed:
+					if (HandleChunkMessage() == false)
+					{
+						return false;
+					}
+					break;
+			}
+
+			current_data = current_data->Subdata(bytes_used);
+		}
+
+		return true;
+	}
+
+	bool RtmpPushClient::HandleChunkMessage()
+	{
+		while (true)
+		{
+			auto message = _chunk_parser.GetMessage();
+
+			if ((message == nullptr) || (message->payload == nullptr))
+			{
+				break;
+			}
+
+			bool result = true;
+			auto type_id = message->header->completed.type_id;
+
+			switch (type_id)
+			{
+				case modules::rtmp::MessageTypeID::SetChunkSize:
+					_chunk_parser.SetChunkSize(message->ReadPayloadAsU32());
+					break;
+
+				case modules::rtmp::MessageTypeID::WindowAcknowledgementSize:
+					_acknowledgement_size = message->ReadPayloadAsU32();
+					break;
+
+				OV_CASE_BREAK(modules::rtmp::MessageTypeID::UserControl, result = HandleUserControl(message));
+				OV_CASE_BREAK(modules::rtmp::MessageTypeID::Amf0Command, result = HandleAmf0Command(message));
+
+				default:
+					// Acknowledgement, SetPeerBandwidth, ...
+					break;
+			}
+
+			if (result == false)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool RtmpPushClient::HandleUserControl(const std::shared_ptr<const modules::rtmp::Message> &message)
+	{
+		auto data = message->payload;
+
+		if (data->GetLength() < 2)
+		{
+			logte("Invalid user control message size (data length must greater than 2 bytes, but %zu)", data->GetLength());
+			return false;
+		}
+
+		ov::ByteStream byte_stream(data);
+		auto type = byte_stream.ReadBE16As<modules::rtmp::UserControlEventType>();
+
+		if (type == modules::rtmp::UserControlEventType::PingRequest)
+		{
+			if (byte_stream.IsRemained(sizeof(uint32_t)) == false)
+			{
+				logte("Invalid ping message size: %zu", data->GetLength());
+				return false;
+			}
+
+			auto chunk_write_info = modules::rtmp::ChunkWriteInfo::Create(
+				modules::rtmp::ChunkStreamId::Urgent,
+				modules::rtmp::MessageTypeID::UserControl,
+				0,
+				sizeof(uint16_t) + sizeof(uint32_t));
+
+			chunk_write_info->AppendPayload(modules::rtmp::UserControlEventType::PingResponse);
+			chunk_write_info->AppendPayload(byte_stream.ReadBE32());
+
+			return SendMessage(chunk_write_info);
+		}
+
+		return true;
+	}
+
+	bool RtmpPushClient::HandleAmf0Command(const std::shared_ptr<const modules::rtmp::Message> &message)
+	{
+		ov::ByteStream byte_stream(message->payload);
+		modules::rtmp::AmfDocument document;
+
+		if (document.Decode(byte_stream) == false)
+		{
+			logte("Could not decode AMF document");
+			return false;
+		}
+
+		ov::String message_name = document.GetString(0).value_or("");
+		double transaction_id = document.GetNumber(1).value_or(0.0);
+
+		switch (modules::rtmp::ToCommand(message_name))
+		{
+			OV_CASE_RETURN(modules::rtmp::Command::AckResult, HandleAmfResult(document, transaction_id));
+			OV_CASE_RETURN(modules::rtmp::Command::OnStatus, HandleAmfOnStatus(document));
+
+			case modules::rtmp::Command::AckError: {
+				auto information = document.GetObject(3);
+				auto description = (information != nullptr) ? information->GetObject()->GetString("description").value_or("") : "";
+
+				// The results of releaseStream and FCPublish are not important
+				if ((transaction_id == RTMP_PUSH_TRANSACTION_RELEASE_STREAM) || (transaction_id == RTMP_PUSH_TRANSACTION_FC_PUBLISH))
+				{
+					return true;
+				}
+
+				logte("The server returned an error for the transaction %.1f: %s", transaction_id, description.CStr());
+				return false;
+			}
+
+			default:
+				// onBWDone, onFCPublish, ...
+				break;
+		}
+
+		return true;
+	}
+
+	bool RtmpPushClient::HandleAmfResult(const modules::rtmp::AmfDocument &document, double transaction_id)
+	{
+		if (transaction_id == RTMP_PUSH_TRANSACTION_CONNECT)
+		{
+			if (_state != State::WaitingForConnectResult)
+			{
+				return true;
+			}
+
+			SetState(State::WaitingForCreateStreamResult);
+
+			return SendAmfCreateStream();
+		}
+
+		if (transaction_id == RTMP_PUSH_TRANSACTION_CREATE_STREAM)
+		{
+			if (_state != State::WaitingForCreateStreamResult)
+			{
+				return true;
+			}
+
+			auto stream_id = document.GetNumber(3);
+
+			if (stream_id.has_value() == false)
+			{
+				logte("Could not obtain the stream id from the result of createStream");
+				return false;
+			}
+
+			_rtmp_stream_id = static_cast<uint32_t>(stream_id.value());
+
+			SetState(State::WaitingForPublishStart);
+
+			return SendAmfPublish();
+		}
+
+		return true;
+	}
+
+	bool RtmpPushClient::HandleAmfOnStatus(const modules::rtmp::AmfDocument &document)
+	{
+		auto information = document.GetObject(3);
+
+		if (information == nullptr)
+		{
+			logte("Invalid onStatus message");
+			return false;
+		}
+
+		auto object = information->GetObject();
+		auto level = object->GetString("level").value_or("");
+		auto code = object->GetString("code").value_or("");
+
+		if (level == "error")
+		{
+			logte("The server returned an error: %s (%s)", code.CStr(), object->GetString("description").value_or("").CStr());
+			return false;
+		}
+
+		if ((code == "NetStream.Publish.Start") && (_state == State::WaitingForPublishStart))
+		{
+			if ((SendMetadata() == false) || (SendSequenceHeaders() == false))
+			{
+				return false;
+			}
+
+			logti("RTMP push is started: %s/%s", _tc_url.CStr(), _stream_name.CStr());
+
+			SetState(State::Publishing);
+		}
+
+		return true;
+	}
+
+	void RtmpPushClient::AccumulateAcknowledgementSize(size_t data_size)
+	{
+		_acknowledgement_traffic += data_size;
+		_acknowledgement_traffic_after_last_acked += data_size;
+
+		if ((_acknowledgement_size > 0) && (_acknowledgement_traffic_after_last_acked >= _acknowledgement_size))
+		{
+			SendAcknowledgement(_acknowledgement_traffic);
+			_acknowledgement_traffic_after_last_acked = 0;
+		}
+	}
+
+	bool RtmpPushClient::SendMessage(const std::shared_ptr<const modules::rtmp::ChunkWriteInfo> &chunk_write_info)
+	{
+		auto socket = GetSocket();
+
+		return (socket != nullptr) && socket->Send(_chunk_writer.Serialize(chunk_write_info));
+	}
+
+	bool RtmpPushClient::SendAmfCommand(const std::shared_ptr<modules::rtmp::ChunkWriteInfo> &chunk_write_info, const modules::rtmp::AmfDocument &document)
+	{
+		ov::ByteStream stream(2048);
+		if (document.Encode(stream) == false)
+		{
+			return false;
+		}
+
+		chunk_write_info->AppendPayload(stream.GetData());
+
+		return SendMessage(chunk_write_info);
+	}
+
+	bool RtmpPushClient::SendSetChunkSize(uint32_t chunk_size)
+	{
+		auto chunk_write_info = modules::rtmp::ChunkWriteInfo::Create(
+			modules::rtmp::ChunkStreamId::Urgent,
+			modules::rtmp::MessageTypeID::SetChunkSize,
+			0);
+
+		chunk_write_info->AppendPayload(ov::HostToBE32(chunk_size));
+
+		return SendMessage(chunk_write_info);
+	}
+
+	bool RtmpPushClient::SendAcknowledgement(uint32_t acknowledgement_traffic)
+	{
+		auto chunk_write_info = modules::rtmp::ChunkWriteInfo::Create(
+			modules::rtmp::ChunkStreamId::Urgent,
+			modules::rtmp::MessageTypeID::Acknowledgement,
+			0);
+
+		chunk_write_info->AppendPayload(ov::HostToBE32(acknowledgement_traffic));
+
+		return SendMessage(chunk_write_info);
+	}
+
+	bool RtmpPushClient::SendAmfConnect()
+	{
+		return SendAmfCommand(
+			modules::rtmp::ChunkWriteInfo::Create(ov::ToUnderlyingType(modules::rtmp::ChunkStreamId::Control)),
+			modules::rtmp::AmfDocumentBuilder()
+				.Append(modules::rtmp::EnumToString(modules::rtmp::Command::Connect))
+				.Append(RTMP_PUSH_TRANSACTION_CONNECT)
+				.Append(modules::rtmp::AmfObjectBuilder()
+							.Append("app", _app_name.CStr())
+							.Append("type", "nonprivate")
+							.Append("flashVer", "FMLE/3.0 (compatible; OvenMediaEngine)")
+							.Append("tcUrl", _tc_url.CStr())
+							.Build())
+				.Build());
+	}
+
+	bool RtmpPushClient::SendAmfCreateStream()
+	{
+		auto chunk_stream_id = ov::ToUnderlyingType(modules::rtmp::ChunkStreamId::Control);
+
+		// releaseStream and FCPublish are not defined in the spec, but some servers (e.g. Wowza, some CDNs) require them
+		return SendAmfCommand(
+				   modules::rtmp::ChunkWriteInfo::Create(chunk_stream_id),
+				   modules::rtmp::AmfDocumentBuilder()
+					   .Append(modules::rtmp::EnumToString(modules::rtmp::Command::ReleaseStream))
+					   .Append(RTMP_PUSH_TRANSACTION_RELEASE_STREAM)
+					   .Append(modules::rtmp::AmfProperty::NullProperty())
+					   .Append(_stream_name.CStr())
+					   .Build()) &&
+			   SendAmfCommand(
+				   modules::rtmp::ChunkWriteInfo::Create(chunk_stream_id),
+				   modules::rtmp::AmfDocumentBuilder()
+					   .Append(modules::rtmp::EnumToString(modules::rtmp::Command::FCPublish))
+					   .Append(RTMP_PUSH_TRANSACTION_FC_PUBLISH)
+					   .Append(modules::rtmp::AmfProperty::NullProperty())
+					   .Append(_stream_name.CStr())
+					   .Build()) &&
+			   SendAmfCommand(
+				   modules::rtmp::ChunkWriteInfo::Create(chunk_stream_id),
+				   modules::rtmp::AmfDocumentBuilder()
+					   .Append(modules::rtmp::EnumToString(modules::rtmp::Command::CreateStream))
+					   .Append(RTMP_PUSH_TRANSACTION_CREATE_STREAM)
+					   .Append(modules::rtmp::AmfProperty::NullProperty())
+					   .Build());
+	}
+
+	bool RtmpPushClient::SendAmfPublish()
+	{
+		return SendAmfCommand(
+			modules::rtmp::ChunkWriteInfo::Create(ov::ToUnderlyingType(modules::rtmp::ChunkStreamId::Control), _rtmp_stream_id),
+			modules::rtmp::AmfDocumentBuilder()
+				.Append(modules::rtmp::EnumToString(modules::rtmp::Command::Publish))
+				.Append(RTMP_PUSH_TRANSACTION_PUBLISH)
+				.Append(modules::rtmp::AmfProperty::NullProperty())
+				.Append(_stream_name.CStr())
+				.Append("live")
+				.Build());
+	}
+
+	bool RtmpPushClient::SendMetadata()
+	{
+		modules::rtmp::AmfEcmaArrayBuilder metadata;
+
+		if (_video_track != nullptr)
+		{
+			metadata
+				.Append("width", static_cast<double>(_video_track->GetWidth()))
+				.Append("height", static_cast<double>(_video_track->GetHeight()))
+				.Append("framerate", _video_track->GetFrameRate())
+				.Append("videocodecid", static_cast<double>(ov::ToUnderlyingType(modules::flv::VideoCodecId::Avc)))
+				.Append("videodatarate", _video_track->GetBitrate() / 1000.0);
+		}
+
+		if (_audio_track != nullptr)
+		{
+			metadata
+				.Append("audiocodecid", static_cast<double>(ov::ToUnderlyingType(modules::flv::SoundFormat::Aac)))
+				.Append("audiosamplerate", static_cast<double>(_audio_track->GetSampleRate()))
+				.Append("audiochannels", static_cast<double>(_audio_track->GetChannel().GetCounts()))
+				.Append("stereo", _audio_track->GetChannel().GetCounts() > 1)
+				.Append("audiodatarate", _audio_track->GetBitrate() / 1000.0);
+		}
+
+		metadata.Append("encoder", "OvenMediaEngine");
+
+		return SendAmfCommand(
+			modules::rtmp::ChunkWriteInfo::Create(
+				ov::ToUnderlyingType(modules::rtmp::ChunkStreamId::Control),
+				modules::rtmp::MessageTypeID::Amf0Data,
+				_rtmp_stream_id),
+			modules::rtmp::AmfDocumentBuilder()
+				.Append(modules::rtmp::EnumToString(modules::rtmp::Command::SetDataFrame))
+				.Append(modules::rtmp::EnumToString(modules::rtmp::Command::OnMetaData))
+				.Append(metadata.Build())
+				.Build());
+	}
+
+	bool RtmpPushClient::SendSequenceHeaders()
+	{
+		if (_video_track != nullptr)
+		{
+			auto decoder_configuration_record = _video_track->GetDecoderConfigurationRecord();
+
+			if ((decoder_configuration_record == nullptr) || (decoder_configuration_record->GetData() == nullptr))
+			{
+				logte("Could not obtain the AVCDecoderConfigurationRecord of the video track: %d", _video_track->GetId());
+				return false;
+			}
+
+			auto chunk_write_info = modules::rtmp::ChunkWriteInfo::Create(modules::rtmp::ChunkStreamId::Media, modules::rtmp::MessageTypeID::Video, _rtmp_stream_id);
+
+			// Frame type + codec id, AVC packet type, composition time
+			chunk_write_info->AppendPayload(static_cast<uint8_t>((ov::ToUnderlyingType(modules::flv::VideoFrameType::KeyFrame) << 4) | ov::ToUnderlyingType(modules::flv::VideoCodecId::Avc)));
+			chunk_write_info->AppendPayload(modules::flv::VideoPacketType::SequenceStart);
+			chunk_write_info->AppendPayload(static_cast<uint8_t>(0));
+			chunk_write_info->AppendPayload(static_cast<uint8_t>(0));
+			chunk_write_info->AppendPayload(static_cast<uint8_t>(0));
+			chunk_write_info->AppendPayload(decoder_configuration_record->GetData().get());
+
+			if (SendMessage(chunk_write_info) == false)
+			{
+				return false;
+			}
+		}
+
+		if (_audio_track != nullptr)
+		{
+			auto decoder_configuration_record = _audio_track->GetDecoderConfigurationRecord();
+
+			if ((decoder_configuration_record == nullptr) || (decoder_configuration_record->GetData() == nullptr))
+			{
+				logte("Could not obtain the AudioSpecificConfig of the audio track: %d", _audio_track->GetId());
+				return false;
+			}
+
+			auto chunk_write_info = modules::rtmp::ChunkWriteInfo::Create(modules::rtmp::ChunkStreamId::Media, modules::rtmp::MessageTypeID::Audio, _rtmp_stream_id);
+
+			// Sound format + rate + size + type (AAC always uses 44kHz/16bit/stereo), AAC packet type
+			chunk_write_info->AppendPayload(static_cast<uint8_t>(
+				(ov::ToUnderlyingType(modules::flv::SoundFormat::Aac) << 4) |
+				(ov::ToUnderlyingType(modules::flv::SoundRate::_44) << 2) |
+				(ov::ToUnderlyingType(modules::flv::SoundSize::_16Bit) << 1) |
+				ov::ToUnderlyingType(modules::flv::SoundType::Stereo)));
+			chunk_write_info->AppendPayload(modules::flv::AACPacketType::SequenceHeader);
+			chunk_write_info->AppendPayload(decoder_configuration_record->GetData().get());
+
+			if (SendMessage(chunk_write_info) == false)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	std::shared_ptr<modules::rtmp::ChunkWriteInfo> RtmpPushClient::CreateVideoMessage(const std::shared_ptr<MediaPacket> &packet, uint32_t timestamp)
+	{
+		std::shared_ptr<const ov::Data> data;
+
+		switch (packet->GetBitstreamFormat())
+		{
+			case cmn::BitstreamFormat::H264_ANNEXB:
+				data = NalStreamConverter::ConvertAnnexbToXvcc(packet->GetData(), packet->GetFragHeader());
+				break;
+
+			case cmn::BitstreamFormat::H264_AVCC:
+				data = packet->GetData();
+				break;
+
+			default:
+				break;
+		}
+
+		if (data == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto is_key_frame = (packet->GetFlag() == MediaPacketFlag::Key);
+		auto frame_type = is_key_frame ? modules::flv::VideoFrameType::KeyFrame : modules::flv::VideoFrameType::InterFrame;
+		auto time_base = _video_track->GetTimeBase().GetExpr();
+		auto composition_time = static_cast<int32_t>((packet->GetPts() - packet->GetDts()) * time_base * 1000.0);
+
+		auto chunk_write_info = modules::rtmp::ChunkWriteInfo::Create(modules::rtmp::ChunkStreamId::Media, modules::rtmp::MessageTypeID::Video, _rtmp_stream_id);
+		chunk_write_info->timestamp = timestamp;
+
+		chunk_write_info->AppendPayload(static_cast<uint8_t>((ov::ToUnderlyingType(frame_type) << 4) | ov::ToUnderlyingType(modules::flv::VideoCodecId::Avc)));
+		chunk_write_info->AppendPayload(modules::flv::VideoPacketType::CodedFrames);
+		// Composition time is SI24
+		chunk_write_info->AppendPayload(static_cast<uint8_t>((composition_time >> 16) & 0xFF));
+		chunk_write_info->AppendPayload(static_cast<uint8_t>((composition_time >> 8) & 0xFF));
+		chunk_write_info->AppendPayload(static_cast<uint8_t>(composition_time & 0xFF));
+		chunk_write_info->AppendPayload(data.get());
+
+		return chunk_write_info;
+	}
+
+	std::shared_ptr<modules::rtmp::ChunkWriteInfo> RtmpPushClient::CreateAudioMessage(const std::shared_ptr<MediaPacket> &packet, uint32_t timestamp)
+	{
+		std::shared_ptr<const ov::Data> data;
+
+		switch (packet->GetBitstreamFormat())
+		{
+			case cmn::BitstreamFormat::AAC_ADTS:
+				data = AacConverter::ConvertAdtsToRaw(packet->GetData(), nullptr);
+				break;
+
+			case cmn::BitstreamFormat::AAC_RAW:
+				data = packet->GetData();
+				break;
+
+			default:
+				break;
+		}
+
+		if (data == nullptr)
+		{
+			return nullptr;
+		}
+
+		auto chunk_write_info = modules::rtmp::ChunkWriteInfo::Create(modules::rtmp::ChunkStreamId::Media, modules::rtmp::MessageTypeID::Audio, _rtmp_stream_id);
+		chunk_write_info->timestamp = timestamp;
+
+		chunk_write_info->AppendPayload(static_cast<uint8_t>(
+			(ov::ToUnderlyingType(modules::flv::SoundFormat::Aac) << 4) |
+			(ov::ToUnderlyingType(modules::flv::SoundRate::_44) << 2) |
+			(ov::ToUnderlyingType(modules::flv::SoundSize::_16Bit) << 1) |
+			ov::ToUnderlyingType(modules::flv::SoundType::Stereo)));
+		chunk_write_info->AppendPayload(modules::flv::AACPacketType::Raw);
+		chunk_write_info->AppendPayload(data.get());
+
+		return chunk_write_info;
+	}
+
+	std::shared_ptr<modules::rtmp::ChunkWriteInfo> RtmpPushClient::CreateDataMessage(const std::shared_ptr<MediaPacket> &packet, uint32_t timestamp)
+	{
+		if (packet->GetBitstreamFormat() != cmn::BitstreamFormat::AMF)
+		{
+			return nullptr;
+		}
+
+		auto chunk_write_info = modules::rtmp::ChunkWriteInfo::Create(modules::rtmp::ChunkStreamId::Media, modules::rtmp::MessageTypeID::Amf0Data, _rtmp_stream_id);
+		chunk_write_info->timestamp = timestamp;
+
+		chunk_write_info->AppendPayload(packet->GetData().get());
+
+		return chunk_write_info;
+	}
+
+	bool RtmpPushClient::CheckSendBuffer(const std::shared_ptr<MediaPacket> &packet)
+	{
+		auto socket = GetSocket();
+
+		if (socket == nullptr)
+		{
+			return false;
+		}
+
+		auto pending_bytes = socket->GetPendingSendBytes();
+
+		if (_waiting_key_frame)
+		{
+			// Wait until the queue is drained enough, and resume from the key frame
+			if (pending_bytes > (_send_buffer_size / 2))
+			{
+				return false;
+			}
+
+			if (_video_track != nullptr)
+			{
+				if ((packet->GetMediaType() != cmn::MediaType::Video) || (packet->GetFlag() != MediaPacketFlag::Key))
+				{
+					return false;
+				}
+			}
+
+			_waiting_key_frame = false;
+
+			return true;
+		}
+
+		if (pending_bytes > _send_buffer_size)
+		{
+			logtw("The send buffer of %s/%s is full (%zu bytes are pending), packets are dropped until the next key frame (total dropped: %" PRIu64 ")",
+				  _tc_url.CStr(), _stream_name.CStr(), pending_bytes, _dropped_packet_count.load());
+
+			_waiting_key_frame = true;
+
+			return false;
+		}
+
+		return true;
+	}
+
+	bool RtmpPushClient::SendPacket(const std::shared_ptr<MediaPacket> &packet, uint64_t *sent_bytes)
+	{
+		*sent_bytes = 0;
+
+		auto state = _state.load();
+
+		if ((state == State::Error) || (state == State::Stopped))
+		{
+			return false;
+		}
+
+		if (state != State::Publishing)
+		{
+			// Packets are not sent until the publish is started
+			return true;
+		}
+
+		std::shared_ptr<MediaTrack> track;
+		auto track_id = packet->GetTrackId();
+
+		if ((_video_track != nullptr) && (_video_track->GetId() == track_id))
+		{
+			track = _video_track;
+		}
+		else if ((_audio_track != nullptr) && (_audio_track->GetId() == track_id))
+		{
+			track = _audio_track;
+		}
+		else if ((_data_track != nullptr) && (_data_track->GetId() == track_id))
+		{
+			track = _data_track;
+		}
+		else
+		{
+			// Not selected track
+			return true;
+		}
+
+		if (packet->GetPacketType() == cmn::PacketType::SEQUENCE_HEADER)
+		{
+			// The sequence headers are sent from the decoder configuration records when the publish is started
+			return true;
+		}
+
+		if (CheckSendBuffer(packet) == false)
+		{
+			_dropped_packet_count++;
+			return true;
+		}
+
+		auto timestamp_msec = static_cast<int64_t>(packet->GetDts() * track->GetTimeBase().GetExpr() * 1000.0);
+
+		if (_is_base_timestamp_set == false)
+		{
+			_base_timestamp_msec = timestamp_msec;
+			_is_base_timestamp_set = true;
+		}
+
+		auto timestamp = static_cast<uint32_t>(std::max<int64_t>(timestamp_msec - _base_timestamp_msec, 0));
+
+		std::shared_ptr<modules::rtmp::ChunkWriteInfo> chunk_write_info;
+
+		switch (track->GetMediaType())
+		{
+			OV_CASE_BREAK(cmn::MediaType::Video, chunk_write_info = CreateVideoMessage(packet, timestamp));
+			OV_CASE_BREAK(cmn::MediaType::Audio, chunk_write_info = CreateAudioMessage(packet, timestamp));
+			OV_CASE_BREAK(cmn::MediaType::Data, chunk_write_info = CreateDataMessage(packet, timestamp));
+
+			default:
+				break;
+		}
+
+		if (chunk_write_info == nullptr)
+		{
+			logtd("Could not convert the packet (track: %u, format: %d)", track_id, ov::ToUnderlyingType(packet->GetBitstreamFormat()));
+			return true;
+		}
+
+		auto data = _chunk_writer.Serialize(chunk_write_info);
+		auto socket = GetSocket();
+
+		if ((socket == nullptr) || (socket->Send(data) == false))
+		{
+			logte("Could not send the packet to %s/%s", _tc_url.CStr(), _stream_name.CStr());
+			SetState(State::Error);
+			return false;
+		}
+
+		*sent_bytes = data->GetLength();
+
+		return true;
+	}
+}  // namespace pub
@@ -0,0 +1,141 @@
+//==============================================================================
+//
+//  OvenMediaEngine
+//
+//  Created by Keukhan
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/info/media_track.h>
+#include <base/mediarouter/media_buffer.h>
+#include <base/ovsocket/ovsocket.h>
+#include <modules/rtmp_v2/rtmp.h>
+
+namespace pub
+{
+	// RTMP client which pushes a stream using the nonblocking socket of the TCP socket pool
+	//
+	// Unlike ffmpeg::Writer, SendPacket() never blocks the stream worker thread.
+	// Packets are queued to the socket, and if the queued bytes exceed the send buffer size (slow peer),
+	// packets are dropped until the next key frame.
+	class RtmpPushClient : public ov::EnableSharedFromThis<RtmpPushClient>,
+						   public ov::SocketAsyncInterface
+	{
+	public:
+		enum class State : uint8_t
+		{
+			Idle,
+			Connecting,
+			Handshaking,
+			WaitingForConnectResult,
+			WaitingForCreateStreamResult,
+			WaitingForPublishStart,
+			Publishing,
+			Stopped,
+			Error
+		};
+
+		static std::shared_ptr<RtmpPushClient> Create(size_t send_buffer_size);
+
+		RtmpPushClient(size_t send_buffer_size);
+		~RtmpPushClient() override;
+
+		// Only one video track and one audio track (H.264/AAC) are used
+		bool AddTrack(const std::shared_ptr<MediaTrack> &track);
+
+		// url: rtmp://host[:port]/app[/stream]
+		// stream_key: stream name (If it is empty, the last path of the url is used)
+		bool Start(const ov::String &url, const ov::String &stream_key);
+		void Stop();
+
+		// Returns false if the connection is lost
+		//
+		// sent_bytes: The number of bytes queued to the socket (0 if the packet is dropped)
+		bool SendPacket(const std::shared_ptr<MediaPacket> &packet, uint64_t *sent_bytes);
+
+		State GetState() const
+		{
+			return _state;
+		}
+
+		uint64_t GetDroppedPacketCount() const
+		{
+			return _dropped_packet_count;
+		}
+
+		// Implementation of SocketAsyncInterface
+		void OnConnected(const std::shared_ptr<const ov::SocketError> &error) override;
+		void OnReadable() override;
+		void OnClosed() override;
+
+	private:
+		void SetState(State state);
+		std::shared_ptr<ov::Socket> GetSocket();
+
+		bool SendHandshake();
+		bool HandleHandshake(const std::shared_ptr<const ov::Data> &data, size_t *bytes_used);
+
+		bool HandleData(const std::shared_ptr<const ov::Data> &data);
+		bool HandleChunkMessage();
+		bool HandleUserControl(const std::shared_ptr<const modules::rtmp::Message> &message);
+		bool HandleAmf0Command(const std::shared_ptr<const modules::rtmp::Message> &message);
+		bool HandleAmfResult(const modules::rtmp::AmfDocument &document, double transaction_id);
+		bool HandleAmfOnStatus(const modules::rtmp::AmfDocument &document);
+		void AccumulateAcknowledgementSize(size_t data_size);
+
+		bool SendMessage(const std::shared_ptr<const modules::rtmp::ChunkWriteInfo> &chunk_write_info);
+		bool SendAmfCommand(const std::shared_ptr<modules::rtmp::ChunkWriteInfo> &chunk_write_info, const modules::rtmp::AmfDocument &document);
+		bool SendSetChunkSize(uint32_t chunk_size);
+		bool SendAcknowledgement(uint32_t acknowledgement_traffic);
+		bool SendAmfConnect();
+		bool SendAmfCreateStream();
+		bool SendAmfPublish();
+		bool SendMetadata();
+		bool SendSequenceHeaders();
+
+		std::shared_ptr<modules::rtmp::ChunkWriteInfo> CreateVideoMessage(const std::shared_ptr<MediaPacket> &packet, uint32_t timestamp);
+		std::shared_ptr<modules::rtmp::ChunkWriteInfo> CreateAudioMessage(const std::shared_ptr<MediaPacket> &packet, uint32_t timestamp);
+		std::shared_ptr<modules::rtmp::ChunkWriteInfo> CreateDataMessage(const std::shared_ptr<MediaPacket> &packet, uint32_t timestamp);
+
+		// Returns true if the packet can be sent, or false if it have to be dropped because the peer is too slow
+		bool CheckSendBuffer(const std::shared_ptr<MediaPacket> &packet);
+
+		std::atomic<State> _state{State::Idle};
+
+		size_t _send_buffer_size = 0;
+
+		std::shared_ptr<ov::Socket> _socket;
+		mutable std::mutex _socket_mutex;
+
+		ov::String _tc_url;
+		ov::String _app_name;
+		ov::String _stream_name;
+
+		std::shared_ptr<MediaTrack> _video_track;
+		std::shared_ptr<MediaTrack> _audio_track;
+		std::shared_ptr<MediaTrack> _data_track;
+
+		// Received handshake data (S0 + S1 + S2)
+		ov::Data _handshake_data;
+
+		modules::rtmp::ChunkParser _chunk_parser;
+		// The data which is not consumed by _chunk_parser (e.g. a chunk header split across reads) is parsed again with the next data
+		std::shared_ptr<ov::Data> _remained_data;
+		modules::rtmp::ChunkWriter _chunk_writer;
+
+		uint32_t _rtmp_stream_id = 0;
+
+		uint32_t _acknowledgement_size = 0;
+		uint32_t _acknowledgement_traffic = 0;
+		uint32_t _acknowledgement_traffic_after_last_acked = 0;
+
+		// Used by the stream worker thread
+		bool _waiting_key_frame = true;
+		bool _is_base_timestamp_set = false;
+		int64_t _base_timestamp_msec = 0;
+
+		std::atomic<uint64_t> _dropped_packet_count{0};
+	};
+}  // namespace pub
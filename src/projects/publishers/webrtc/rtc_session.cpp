@@ -195,6 +195,8 @@ bool RtcSession::Start()
 	_abr_test_watch.Start();
 	_bitrate_estimate_watch.Start();
 
+	_stream_metrics_handle = MonitorInstance->GetStreamMetricsHandle(*GetStream());
+
 	return Session::Start();
 }
 
@@ -526,38 +528,48 @@ void RtcSession::SendOutgoingData(const std::any &packet)
 		return;
 	}
 
-	// RTP Session must be copied and sent because data is altered due to SRTP.
-	auto copy_packet = std::make_shared<RtpPacket>(*session_packet);
+	// The packet is shared by all sessions of the stream and SRTP encrypts in place.
+	// So the header is patched in the per-session scratch buffer, and the header and the shared payload are gathered
+	// into the buffer to be encrypted. It is the only copy of the payload per session.
+	auto header_size = session_packet->HeadersSize();
+	_rtp_header_scratch.assign(session_packet->Header(), session_packet->Header() + header_size);
+	auto header = _rtp_header_scratch.data();
 
-	if (copy_packet->IsVideoPacket())
-	{
-		copy_packet->SetSequenceNumber(_video_rtp_sequence_number++);
-	}
-	else
-	{
-		copy_packet->SetSequenceNumber(_audio_rtp_sequence_number++);
-	}
+	uint16_t sequence_number = session_packet->IsVideoPacket() ? _video_rtp_sequence_number++ : _audio_rtp_sequence_number++;
+	ByteWriter<uint16_t>::WriteBigEndian(&header[2], sequence_number);
 
 	// Set transport-wide sequence number
-	SetTransportWideSequenceNumber(copy_packet, _wide_sequence_number);
-	SetAbsSendTime(copy_packet, ov::Clock::NowMSec());
+	SetTransportWideSequenceNumber(session_packet, header, _wide_sequence_number);
+	SetAbsSendTime(session_packet, header, ov::Clock::NowMSec());
+
+	auto data_length = session_packet->GetDataLength();
+	auto data = std::make_shared<ov::Data>(data_length + SRTP_MAX_TRAILER_LEN);
+	data->Append(header, header_size);
+	data->Append(session_packet->Header() + header_size, data_length - header_size);
 
 	// rtp_rtcp -> srtp -> dtls -> Edge Node(RtcSession)
 
 	// Packet loss simulation codes
 	// if (ov::Random::GenerateUInt32(1, 33) != 10)
 	{
-		_rtp_rtcp->SendRtpPacket(copy_packet);
+		_rtp_rtcp->SendRtpPacket(session_packet, data);
 	}
 
-	RecordRtpSent(copy_packet, session_packet->SequenceNumber(), _wide_sequence_number);
+	RecordRtpSent(session_packet, sequence_number, _wide_sequence_number);
 
 	_wide_sequence_number ++;
 
-	MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Webrtc, copy_packet->GetDataLength());
+	if (_stream_metrics_handle != nullptr)
+	{
+		_stream_metrics_handle->IncreaseBytesOut(PublisherType::Webrtc, data_length);
+	}
+	else
+	{
+		MonitorInstance->IncreaseBytesOut(*GetStream(), PublisherType::Webrtc, data_length);
+	}
 }
 
-bool RtcSession::SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t wide_sequence_number)
+bool RtcSession::SetTransportWideSequenceNumber(const std::shared_ptr<const RtpPacket> &rtp_packet, uint8_t *header, uint16_t wide_sequence_number)
 {
 	auto extension_buffer = rtp_packet->Extension(RTP_HEADER_EXTENSION_TRANSPORT_CC_ID);
 	if (extension_buffer == nullptr)
@@ -567,12 +579,12 @@ bool RtcSession::SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket>
 
 	auto payload_offset = rtp_packet->GetExtensionType() == RtpHeaderExtension::HeaderType::ONE_BYTE_HEADER ? 1 : 2;
 	
-	ByteWriter<uint16_t>::WriteBigEndian(extension_buffer + payload_offset, wide_sequence_number);
+	ByteWriter<uint16_t>::WriteBigEndian(header + (extension_buffer - rtp_packet->Header()) + payload_offset, wide_sequence_number);
 
 	return true;
 }
 
-bool RtcSession::SetAbsSendTime(const std::shared_ptr<RtpPacket> &rtp_packet, uint64_t time_ms)
+bool RtcSession::SetAbsSendTime(const std::shared_ptr<const RtpPacket> &rtp_packet, uint8_t *header, uint64_t time_ms)
 {
 	auto extension_buffer = rtp_packet->Extension(RTP_HEADER_EXTENSION_ABS_SEND_TIME_ID);
 	if (extension_buffer == nullptr)
@@ -583,12 +595,12 @@ bool RtcSession::SetAbsSendTime(const std::shared_ptr<RtpPacket> &rtp_packet, ui
 	auto payload_offset = rtp_packet->GetExtensionType() == RtpHeaderExtension::HeaderType::ONE_BYTE_HEADER ? 1 : 2;
 
 	auto abs_send_time = RtpHeaderExtensionAbsSendTime::MsToAbsSendTime(time_ms);
-	ByteWriter<uint24_t>::WriteBigEndian(extension_buffer + payload_offset, abs_send_time);
+	ByteWriter<uint24_t>::WriteBigEndian(header + (extension_buffer - rtp_packet->Header()) + payload_offset, abs_send_time);
 
 	return true;
 }
 
-bool RtcSession::RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t origin_sequence_number, uint16_t wide_sequence_number)
+bool RtcSession::RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t sequence_number, uint16_t wide_sequence_number)
 {
 	if (rtp_packet == nullptr)
 	{
@@ -596,11 +608,11 @@ bool RtcSession::RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packe
 	}
 
 	auto sent_log = std::make_shared<RtpSentLog>();
-	sent_log->_sequence_number = rtp_packet->SequenceNumber();
+	sent_log->_sequence_number = sequence_number;
 	sent_log->_wide_sequence_number = wide_sequence_number;
 	sent_log->_track_id = rtp_packet->GetTrackId();
 	sent_log->_payload_type = rtp_packet->PayloadType();
-	sent_log->_origin_sequence_number = origin_sequence_number;
+	sent_log->_origin_sequence_number = rtp_packet->SequenceNumber();
 	sent_log->_timestamp = rtp_packet->Timestamp();
 	sent_log->_marker = rtp_packet->Marker();
 	sent_log->_ssrc = rtp_packet->Ssrc();
@@ -148,6 +148,13 @@ private:
 	uint16_t _audio_rtp_sequence_number = 0;
 	uint16_t _wide_sequence_number = 0;
 
+	// The RTP packet from the stream is shared by all sessions, so only its header is copied here and patched per session.
+	// The payload is gathered from the shared packet when building the data to be encrypted.
+	std::vector<uint8_t> _rtp_header_scratch;
+
+	// Resolved once in Start() to count the bytes sent for every packet without looking up the metrics
+	std::shared_ptr<mon::StreamMetricsHandle> _stream_metrics_handle;
+
 	ov::StopWatch _abr_test_watch;
 	bool _changed = false;
 
@@ -174,7 +181,7 @@ private:
 		}
 	};
 
-	bool RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t origin_sequence_number, uint16_t wide_sequence_number);
+	bool RecordRtpSent(const std::shared_ptr<const RtpPacket> &rtp_packet, uint16_t sequence_number, uint16_t wide_sequence_number);
 
 	std::shared_mutex _rtp_record_map_lock;
 	// For NACK
@@ -187,8 +194,9 @@ private:
 	std::shared_ptr<RtpSentLog> TraceRtpSentByVideoSeqNo(uint16_t sequence_number);
 	std::shared_ptr<RtpSentLog> TraceRtpSentByWideSeqNo(uint16_t wide_sequence_number);
 
-	bool SetTransportWideSequenceNumber(const std::shared_ptr<RtpPacket> &rtp_packet, uint16_t wide_sequence_number);
-	bool SetAbsSendTime(const std::shared_ptr<RtpPacket> &rtp_packet, uint64_t time_ms);
+	// |header| is a copy of the header of |rtp_packet|
+	bool SetTransportWideSequenceNumber(const std::shared_ptr<const RtpPacket> &rtp_packet, uint8_t *header, uint16_t wide_sequence_number);
+	bool SetAbsSendTime(const std::shared_ptr<const RtpPacket> &rtp_packet, uint8_t *header, uint64_t time_ms);
 
 	// For Estimated bitrate
 	double _total_sent_seconds = 0;
@@ -15,7 +15,7 @@
 #include <base/mediarouter/media_type.h>
 #include <base/ovlibrary/ovlibrary.h>
 #include <modules/ffmpeg/compat.h>
-#include <modules/managed_queue/managed_queue.h>
+#include <modules/managed_queue/lock_free_managed_queue.h>
 
 #include <algorithm>
 #include <stdint.h>
@@ -89,7 +89,13 @@ public:
 	{
 		return _input_buffer.Size();
 	}
+
+	// Returns true if SendBuffer() has to wait for the input buffer to be consumed
+	bool IsInputBufferFull() const
+	{
+		return (_input_buffer.GetThreshold() > 0) && (_input_buffer.Size() >= _input_buffer.GetThreshold());
+	}
 	
 protected:
-	ov::ManagedQueue<std::shared_ptr<const InputType>> _input_buffer;
+	ov::LockFreeManagedQueue<std::shared_ptr<const InputType>> _input_buffer;
 };
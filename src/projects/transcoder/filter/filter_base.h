@@ -17,13 +17,14 @@
 
 #include "../codec/codec_base.h"
 #include "../transcoder_context.h"
+#include "../transcoder_worker_pool.h"
 
 #include <base/info/application.h>
 #include <base/info/media_track.h>
 #include <base/mediarouter/media_buffer.h>
 #include <base/mediarouter/media_type.h>
 #include <modules/ffmpeg/compat.h>
-#include <modules/managed_queue/managed_queue.h>
+#include <modules/managed_queue/lock_free_managed_queue.h>
 
 class FilterBase
 {
@@ -36,6 +37,8 @@ public:
 	};
 
 	typedef std::function<void(std::shared_ptr<MediaFrame>)> CompleteHandler;
+	// Returns true if the next stage cannot receive the output frame without waiting
+	typedef std::function<bool()> OutputBlockedHandler;
 	FilterBase() = default;
 	virtual ~FilterBase() = default;
 
@@ -74,6 +77,10 @@ public:
 		_complete_handler = complete_handler;
 	}
 
+	void SetOutputBlockedHandler(OutputBlockedHandler output_blocked_handler) {
+		_output_blocked_handler = output_blocked_handler;
+	}
+
 	void SetQueueUrn(std::shared_ptr<info::ManagedQueue::URN> &urn) {
 		_input_buffer.SetUrn(urn);
 	}
@@ -94,6 +101,11 @@ public:
 		{
 			_input_buffer.Enqueue(std::move(buffer));
 
+			if (_task != nullptr)
+			{
+				_task->Schedule();
+			}
+
 			return true;
 		}
 
@@ -108,6 +120,11 @@ public:
 		}
 	}
 
+	bool IsOutputBlocked() const
+	{
+		return (_output_blocked_handler != nullptr) && _output_blocked_handler();
+	}
+
 	void SetInputTrack(std::shared_ptr<MediaTrack> input_track)
 	{
 		_input_track = input_track;
@@ -123,11 +140,17 @@ public:
 		return _input_buffer.Size();
 	}
 
+	// Filters with the same affinity key(stream) are executed on the same worker of the shared worker pool
+	void SetAffinityKey(uint32_t affinity_key)
+	{
+		_affinity_key = affinity_key;
+	}
+
 protected:
 
 	std::atomic<State> _state = State::CREATED;
 
-	ov::ManagedQueue<std::shared_ptr<MediaFrame>> _input_buffer;
+	ov::LockFreeManagedQueue<std::shared_ptr<MediaFrame>> _input_buffer;
 
 	AVFrame *_frame = nullptr;
 
@@ -157,7 +180,12 @@ protected:
 	bool _kill_flag = false;
 	std::thread _thread_work;
 
+	// If the shared worker pool is running, the filter is executed as a task of the pool instead of the dedicated thread.
+	std::shared_ptr<TranscodeWorkerPool::Task> _task;
+	uint32_t _affinity_key = 0;
+
 	CompleteHandler _complete_handler;
+	OutputBlockedHandler _output_blocked_handler;
 
 	bool _use_hwframe_transfer = false;
 
@@ -190,6 +190,37 @@ bool FilterResampler::Start()
 {
 	_source_id = ov::Random::GenerateInt32();
 
+	// Use the shared worker pool instead of the dedicated thread
+	auto worker_pool = TranscodeWorkerPool::GetInstance();
+	if (worker_pool->IsRunning() == true)
+	{
+		_kill_flag = false;
+
+		if (Configure(_input_track, _output_track) == false)
+		{
+			return false;
+		}
+
+		_task = worker_pool->CreateTask(_input_buffer.ToString(), _affinity_key, [this]() -> TranscodeWorkerPool::Task::Result {
+			return DoTask();
+		});
+		if (_task == nullptr)
+		{
+			SetState(State::ERROR);
+
+			logte("Failed to create resample filter task");
+
+			return false;
+		}
+
+		SetState(State::STARTED);
+
+		// Process the frames that are queued before the task is created
+		_task->Schedule();
+
+		return true;
+	}
+
 	try
 	{
 		_kill_flag = false;
@@ -223,6 +254,12 @@ void FilterResampler::Stop()
 
 	_input_buffer.Stop();
 
+	if (_task != nullptr)
+	{
+		_task->Stop();
+		_task.reset();
+	}
+
 	if (_thread_work.joinable())
 	{
 		_thread_work.join();
@@ -241,8 +278,6 @@ void FilterResampler::WorkerThread()
 		return;
 	}
 
-	int ret;
-
 	SetState(State::STARTED);
 
 	while (!_kill_flag)
@@ -253,69 +288,101 @@ void FilterResampler::WorkerThread()
 			continue;
 		}
 
-		auto media_frame = std::move(obj.value());
-
-		auto av_frame = ffmpeg::compat::ToAVFrame(cmn::MediaType::Video, media_frame);
-		if (!av_frame)
+		if (ProcessFrame(std::move(obj.value())) == false)
 		{
-			logte("Could not allocate the frame data");
-
-			SetState(State::ERROR);
-
 			break;
 		}
+	}
+}
 
-		// logtw("Resampled in frame. pts: %lld, linesize: %d, samples: %d", av_frame->pts, av_frame->linesize[0], av_frame->nb_samples);
+TranscodeWorkerPool::Task::Result FilterResampler::DoTask()
+{
+	if (_kill_flag || GetState() == State::ERROR || _input_buffer.IsEmpty())
+	{
+		return TranscodeWorkerPool::Task::Result::Idle;
+	}
 
-		ret = ::av_buffersrc_write_frame(_buffersrc_ctx, av_frame);
-		if (ret < 0)
-		{
-			logte("An error occurred while feeding the audio filtergraph: pts: %lld, linesize: %d, srate: %d, channels: %d, format: %d",
-				  av_frame->pts, av_frame->linesize[0], av_frame->sample_rate, av_frame->ch_layout.nb_channels, av_frame->format);
+	// Sending to a full encoder waits until it consumes the frame, which would hold the shared worker
+	if (IsOutputBlocked())
+	{
+		return TranscodeWorkerPool::Task::Result::Blocked;
+	}
 
-			continue;
-		}
+	auto obj = _input_buffer.Dequeue(0);
+	if (obj.has_value() == false)
+	{
+		return TranscodeWorkerPool::Task::Result::Idle;
+	}
 
-		while (!_kill_flag)
-		{
-			int ret = ::av_buffersink_get_frame(_buffersink_ctx, _frame);
+	ProcessFrame(std::move(obj.value()));
 
-			if (ret == AVERROR(EAGAIN))
-			{
-				break;
-			}
-			else if (ret == AVERROR_EOF)
-			{
-				logte("Error receiving filtered frame. error(EOF)");
+	return TranscodeWorkerPool::Task::Result::Processed;
+}
+
+bool FilterResampler::ProcessFrame(std::shared_ptr<MediaFrame> media_frame)
+{
+	auto av_frame = ffmpeg::compat::ToAVFrame(cmn::MediaType::Video, media_frame);
+	if (!av_frame)
+	{
+		logte("Could not allocate the frame data");
 
-				SetState(State::ERROR);
+		SetState(State::ERROR);
 
-				break;
-			}
-			else if (ret < 0)
-			{
-				logte("Error receiving filtered frame. error(%d)", ret);
+		return false;
+	}
 
-				SetState(State::ERROR);
+	// logtw("Resampled in frame. pts: %lld, linesize: %d, samples: %d", av_frame->pts, av_frame->linesize[0], av_frame->nb_samples);
 
-				break;
-			}
-			else
-			{
-				// logti("Resampled out frame. pts: %lld, linesize: %d, samples : %d", _frame->pts, _frame->linesize[0], _frame->nb_samples);
-				auto output_frame = ffmpeg::compat::ToMediaFrame(cmn::MediaType::Audio, _frame);
-				::av_frame_unref(_frame);
-				if (output_frame == nullptr)
-				{
-					logte("Could not allocate the frame data");
+	int ret = ::av_buffersrc_write_frame(_buffersrc_ctx, av_frame);
+	if (ret < 0)
+	{
+		logte("An error occurred while feeding the audio filtergraph: pts: %lld, linesize: %d, srate: %d, channels: %d, format: %d",
+			  av_frame->pts, av_frame->linesize[0], av_frame->sample_rate, av_frame->ch_layout.nb_channels, av_frame->format);
+
+		return true;
+	}
+
+	while (!_kill_flag)
+	{
+		int ret = ::av_buffersink_get_frame(_buffersink_ctx, _frame);
 
-					continue;
-				}
+		if (ret == AVERROR(EAGAIN))
+		{
+			break;
+		}
+		else if (ret == AVERROR_EOF)
+		{
+			logte("Error receiving filtered frame. error(EOF)");
+
+			SetState(State::ERROR);
+
+			break;
+		}
+		else if (ret < 0)
+		{
+			logte("Error receiving filtered frame. error(%d)", ret);
 
-				output_frame->SetSourceId(_source_id);
+			SetState(State::ERROR);
+
+			break;
+		}
+		else
+		{
+			// logti("Resampled out frame. pts: %lld, linesize: %d, samples : %d", _frame->pts, _frame->linesize[0], _frame->nb_samples);
+			auto output_frame = ffmpeg::compat::ToMediaFrame(cmn::MediaType::Audio, _frame);
+			::av_frame_unref(_frame);
+			if (output_frame == nullptr)
+			{
+				logte("Could not allocate the frame data");
 
-				Complete(std::move(output_frame));
+				continue;
 			}
+
+			output_frame->SetSourceId(_source_id);
+
+			Complete(std::move(output_frame));
 		}
 	}
+
+	return true;
 }
@@ -27,6 +27,10 @@ public:
 	void WorkerThread();
 
 private:
+	// Process a frame from the input buffer. It is called by the task of the shared worker pool.
+	TranscodeWorkerPool::Task::Result DoTask();
+	bool ProcessFrame(std::shared_ptr<MediaFrame> media_frame);
+
 	bool InitializeSourceFilter();
 	bool InitializeFilterDescription();
 	bool InitializeSinkFilter();
@@ -22,6 +22,13 @@
 #define _SKIP_FRAMES_CHECK_INTERVAL 500 					// 500ms
 #define _SKIP_FRAMES_STABLE_FOR_RETRIEVE_INTERVAL 10000 	// 10s
 
+#define DO_FILTER_ONCE(frame) \
+		if (!PushProcess(frame)) { break; } \
+		if (!PopProcess()) { break; } 
+
+#define FLUSH_FILTER_ONCE() \
+		{ PushProcess(nullptr); PopProcess(true); }
+
 FilterRescaler::FilterRescaler()
 {
 	_frame = ::av_frame_alloc();
@@ -373,6 +380,44 @@ bool FilterRescaler::Start()
 {
 	_source_id = ov::Random::GenerateInt32();
 
+	_skip_frames_last_check_time = ov::Time::GetTimestampInMs();
+	_skip_frames_last_changed_time = ov::Time::GetTimestampInMs();
+	// Set initial Skip Frames
+	_skip_frames = _output_track->GetSkipFramesByConfig();
+	_skip_frames_previous_queue_size = 0;
+	_start_frame_syncronization = true;
+
+	// Use the shared worker pool instead of the dedicated thread
+	auto worker_pool = TranscodeWorkerPool::GetInstance();
+	if (worker_pool->IsRunning() == true)
+	{
+		_kill_flag = false;
+
+		if (Configure(_input_track, _output_track) == false)
+		{
+			return false;
+		}
+
+		_task = worker_pool->CreateTask(_input_buffer.ToString(), _affinity_key, [this]() -> TranscodeWorkerPool::Task::Result {
+			return DoTask();
+		});
+		if (_task == nullptr)
+		{
+			SetState(State::ERROR);
+
+			logte("Failed to create rescaling filter task");
+
+			return false;
+		}
+
+		SetState(State::STARTED);
+
+		// Process the frames that are queued before the task is created
+		_task->Schedule();
+
+		return true;
+	}
+
 	try
 	{
 		_kill_flag = false;
@@ -409,6 +454,15 @@ void FilterRescaler::Stop()
 
 	_input_buffer.Stop();
 
+	if (_task != nullptr)
+	{
+		_task->Stop();
+		_task.reset();
+
+		// The handler is no longer called, flush the filter like the dedicated thread does
+		FLUSH_FILTER_ONCE();
+	}
+
 	if (_thread_work.joinable())
 	{
 		_thread_work.join();
@@ -545,13 +599,6 @@ bool FilterRescaler::PopProcess(bool is_flush)
 	return true;
 }
 
-#define DO_FILTER_ONCE(frame) \
-		if (!PushProcess(frame)) { break; } \
-		if (!PopProcess()) { break; } 
-
-#define FLUSH_FILTER_ONCE() \
-		{ PushProcess(nullptr); PopProcess(true); }
-
 void FilterRescaler::WorkerThread()
 {
 	if(_codec_init_event.Submit(Configure(_input_track, _output_track)) == false)
@@ -561,21 +608,6 @@ void FilterRescaler::WorkerThread()
 
 	SetState(State::STARTED);
 
-#if _SKIP_FRAMES_ENABLED
-	auto skip_frames_last_check_time = ov::Time::GetTimestampInMs();
-	auto skip_frames_last_changed_time = ov::Time::GetTimestampInMs();
-	
-
-	// Set initial Skip Frames
-	int32_t skip_frames = _output_track->GetSkipFramesByConfig();
-	size_t  skip_frames_previous_queue_size = 0;
-#endif
-
-	// XMA devices expand the memory pool when processing the first frame filtering. 
-	// At this time, memory allocation failure occurs because it is not 'Thread safe'. 
-	// It is used for the purpose of preventing this.
-	bool start_frame_syncronization = true;
-
 	while (!_kill_flag)
 	{
 		auto obj = _input_buffer.Dequeue();
@@ -584,122 +616,151 @@ void FilterRescaler::WorkerThread()
 			continue;
 		}
 
-		auto media_frame = std::move(obj.value());
+		ProcessFrame(std::move(obj.value()));
+	}
 
-#if _SKIP_FRAMES_ENABLED 
-		// If the set value is greater than or equal to 0, the skip frame is automatically calculated.
-		// The skip frame is not less than the value set by the user.
-		if(_output_track->GetSkipFramesByConfig() >= 0)
-		{
-			auto curr_time = ov::Time::GetTimestampInMs();
+	// Flush the filter
+	FLUSH_FILTER_ONCE();
+}
 
-			// Periodically check the status of the queue
-			// If the queue exceeds an arbitrary threshold, increase the number of skip frames quickly
-			// If the queue is stable, slowly decrease the number of skip frames.
-			// If the queue exceeds the threshold, drop the frame.
-			auto elapsed_check_time = curr_time - skip_frames_last_check_time;
-			auto elapsed_stable_time = curr_time - skip_frames_last_changed_time;
+TranscodeWorkerPool::Task::Result FilterRescaler::DoTask()
+{
+	if (_kill_flag || _input_buffer.IsEmpty())
+	{
+		return TranscodeWorkerPool::Task::Result::Idle;
+	}
 
-			if (elapsed_check_time > _SKIP_FRAMES_CHECK_INTERVAL)
-			{
-				skip_frames_last_check_time = curr_time;
+	// Sending to a full encoder waits until it consumes the frame, which would hold the shared worker
+	if (IsOutputBlocked())
+	{
+		return TranscodeWorkerPool::Task::Result::Blocked;
+	}
 
-				// The frame skip should not be more than 1 second.
-				if ((skip_frames < _output_track->GetFrameRateByConfig()) &&		   // Maximum 1 second
-					(_input_buffer.GetSize() > (_input_buffer.GetThreshold() / 4)) &&  // 25% of the threshold == 0.5s
-					(_input_buffer.GetSize() >= skip_frames_previous_queue_size))	   // The queue is growing
-				{
-					skip_frames++;
-					skip_frames_previous_queue_size = _input_buffer.GetSize();
-					skip_frames_last_changed_time = curr_time;
+	auto obj = _input_buffer.Dequeue(0);
+	if (obj.has_value() == false)
+	{
+		return TranscodeWorkerPool::Task::Result::Idle;
+	}
 
-					logtw("Scaler is unstable. changing skip frames %d to %d", skip_frames-1, skip_frames);
-				}
-				// If the queue is stable, slowly decrease the number of skip frames.
-				else if ((skip_frames > _output_track->GetSkipFramesByConfig()) &&
-						 (elapsed_stable_time > _SKIP_FRAMES_STABLE_FOR_RETRIEVE_INTERVAL) &&
-						 _input_buffer.GetSize() <= 1)
-				{
-					if (--skip_frames < 0)
-					{
-						skip_frames = 0;
-					}
+	ProcessFrame(std::move(obj.value()));
 
-					skip_frames_previous_queue_size = _input_buffer.GetSize();
-					skip_frames_last_changed_time = curr_time;
+	return TranscodeWorkerPool::Task::Result::Processed;
+}
 
-					logtd("Scaler is stable. changing skip frames %d to %d", skip_frames+1, skip_frames);
-				}
+void FilterRescaler::ProcessFrame(std::shared_ptr<MediaFrame> media_frame)
+{
+#if _SKIP_FRAMES_ENABLED 
+	// If the set value is greater than or equal to 0, the skip frame is automatically calculated.
+	// The skip frame is not less than the value set by the user.
+	if(_output_track->GetSkipFramesByConfig() >= 0)
+	{
+		auto curr_time = ov::Time::GetTimestampInMs();
 
-				_fps_filter.SetSkipFrames(skip_frames);
-			}
-		}
+		// Periodically check the status of the queue
+		// If the queue exceeds an arbitrary threshold, increase the number of skip frames quickly
+		// If the queue is stable, slowly decrease the number of skip frames.
+		// If the queue exceeds the threshold, drop the frame.
+		auto elapsed_check_time = curr_time - _skip_frames_last_check_time;
+		auto elapsed_stable_time = curr_time - _skip_frames_last_changed_time;
 
-		// If the user does not set the output Framerate, use the recommend framerate
-		// Cases where the framerate changes dynamically, such as when using WebRTC, WHIP, or SRTP protocols, were considered.
-		// It is similar to maintaining the original frame rate.
-		if (_output_track->GetFrameRateByConfig() == 0.0f)
+		if (elapsed_check_time > _SKIP_FRAMES_CHECK_INTERVAL)
 		{
-			auto recommended_output_framerate = TranscoderStreamInternal::MeasurementToRecommendFramerate(_input_track->GetFrameRate());
-			if (_fps_filter.GetOutputFrameRate() != recommended_output_framerate)
+			_skip_frames_last_check_time = curr_time;
+
+			// The frame skip should not be more than 1 second.
+			if ((_skip_frames < _output_track->GetFrameRateByConfig()) &&		   // Maximum 1 second
+				(_input_buffer.GetSize() > (_input_buffer.GetThreshold() / 4)) &&  // 25% of the threshold == 0.5s
+				(_input_buffer.GetSize() >= _skip_frames_previous_queue_size))	   // The queue is growing
 			{
-				logtd("Change output framerate. Input: %.2ffps, Output: %.2f -> %.2ffps", _input_track->GetFrameRate(), _fps_filter.GetOutputFrameRate(), recommended_output_framerate);
-				_fps_filter.SetOutputFrameRate(recommended_output_framerate);
+				_skip_frames++;
+				_skip_frames_previous_queue_size = _input_buffer.GetSize();
+				_skip_frames_last_changed_time = curr_time;
+
+				logtw("Scaler is unstable. changing skip frames %d to %d", _skip_frames-1, _skip_frames);
 			}
+			// If the queue is stable, slowly decrease the number of skip frames.
+			else if ((_skip_frames > _output_track->GetSkipFramesByConfig()) &&
+					 (elapsed_stable_time > _SKIP_FRAMES_STABLE_FOR_RETRIEVE_INTERVAL) &&
+					 _input_buffer.GetSize() <= 1)
+			{
+				if (--_skip_frames < 0)
+				{
+					_skip_frames = 0;
+				}
+
+				_skip_frames_previous_queue_size = _input_buffer.GetSize();
+				_skip_frames_last_changed_time = curr_time;
+
+				logtd("Scaler is stable. changing skip frames %d to %d", _skip_frames+1, _skip_frames);
+			}
+
+			_fps_filter.SetSkipFrames(_skip_frames);
 		}
+	}
 
-		// If the queue exceeds the threshold, drop the frame.
-		if (_input_buffer.IsThresholdExceeded())
+	// If the user does not set the output Framerate, use the recommend framerate
+	// Cases where the framerate changes dynamically, such as when using WebRTC, WHIP, or SRTP protocols, were considered.
+	// It is similar to maintaining the original frame rate.
+	if (_output_track->GetFrameRateByConfig() == 0.0f)
+	{
+		auto recommended_output_framerate = TranscoderStreamInternal::MeasurementToRecommendFramerate(_input_track->GetFrameRate());
+		if (_fps_filter.GetOutputFrameRate() != recommended_output_framerate)
 		{
-			media_frame = nullptr;;
+			logtd("Change output framerate. Input: %.2ffps, Output: %.2f -> %.2ffps", _input_track->GetFrameRate(), _fps_filter.GetOutputFrameRate(), recommended_output_framerate);
+			_fps_filter.SetOutputFrameRate(recommended_output_framerate);
 		}
+	}
 
-		// logti("buffer.size(%d), i/omps(%d/%d), threshold(%d), skip(%d/%d), stable(%d ms)",
-		// 	  _input_buffer.GetSize(),
-		// 	  _input_buffer.GetInputMessagePerSecond(), _input_buffer.GetOutputMessagePerSecond(), 
-		// 	  _input_buffer.GetThreshold(),
-		// 	  skip_frames, _output_track->GetSkipFramesByConfig(),
-		// 	  elapsed_stable_time);
+	// If the queue exceeds the threshold, drop the frame.
+	if (_input_buffer.IsThresholdExceeded())
+	{
+		media_frame = nullptr;;
+	}
 
-		if(media_frame != nullptr)
-		{
-			_fps_filter.Push(media_frame);
-		}
+	// logti("buffer.size(%d), i/omps(%d/%d), threshold(%d), skip(%d/%d), stable(%d ms)",
+	// 	  _input_buffer.GetSize(),
+	// 	  _input_buffer.GetInputMessagePerSecond(), _input_buffer.GetOutputMessagePerSecond(), 
+	// 	  _input_buffer.GetThreshold(),
+	// 	  _skip_frames, _output_track->GetSkipFramesByConfig(),
+	// 	  elapsed_stable_time);
+
+	if(media_frame != nullptr)
+	{
+		_fps_filter.Push(media_frame);
+	}
 
-		while (auto frame = _fps_filter.Pop())
+	while (auto frame = _fps_filter.Pop())
+	{
+		if (_start_frame_syncronization)
 		{
-			if (start_frame_syncronization)
-			{
-				std::lock_guard<std::mutex> lock(TranscodeGPU::GetInstance()->GetDeviceMutex());
+			std::lock_guard<std::mutex> lock(TranscodeGPU::GetInstance()->GetDeviceMutex());
 
-				DO_FILTER_ONCE(frame);
+			DO_FILTER_ONCE(frame);
 
-				start_frame_syncronization = false;
-			}
-			else
-			{
-				DO_FILTER_ONCE(frame);
-			}
+			_start_frame_syncronization = false;
 		}
+		else
+		{
+			DO_FILTER_ONCE(frame);
+		}
+	}
 #else
-		if (start_frame_syncronization)
+	do
+	{
+		if (_start_frame_syncronization)
 		{
 			std::lock_guard<std::mutex> lock(TranscodeGPU::GetInstance()->GetDeviceMutex());
 
 			DO_FILTER_ONCE(media_frame);
 
-			start_frame_syncronization = false;
+			_start_frame_syncronization = false;
 		}
 		else
 		{
 			DO_FILTER_ONCE(media_frame);
 		}
+	} while (false);
 #endif
-
-	}
-
-	// Flush the filter
-	FLUSH_FILTER_ONCE();
 }
 
 bool FilterRescaler::SetHWContextToFilterIfNeed()
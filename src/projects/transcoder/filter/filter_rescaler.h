@@ -28,6 +28,10 @@ public:
 	void WorkerThread();
 
 private:
+	// Process a frame from the input buffer. It is called by the task of the shared worker pool.
+	TranscodeWorkerPool::Task::Result DoTask();
+	void ProcessFrame(std::shared_ptr<MediaFrame> media_frame);
+
 	bool InitializeSourceFilter();
 	bool InitializeFilterDescription();
 	bool InitializeSinkFilter();	
@@ -39,4 +43,15 @@ private:
 
 	// Constant FrameRate & SkipFrame Filter
 	FilterFps _fps_filter;
+
+	// Skip Frames
+	int64_t _skip_frames_last_check_time = 0;
+	int64_t _skip_frames_last_changed_time = 0;
+	int32_t _skip_frames = 0;
+	size_t _skip_frames_previous_queue_size = 0;
+
+	// XMA devices expand the memory pool when processing the first frame filtering.
+	// At this time, memory allocation failure occurs because it is not 'Thread safe'.
+	// It is used for the purpose of preventing this.
+	bool _start_frame_syncronization = true;
 };
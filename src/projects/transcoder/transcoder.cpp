@@ -17,6 +17,7 @@
 #include "transcoder.h"
 #include "transcoder_gpu.h"
 #include "transcoder_private.h"
+#include "transcoder_worker_pool.h"
 
 std::shared_ptr<Transcoder> Transcoder::Create(std::shared_ptr<MediaRouterInterface> router)
 {
@@ -42,6 +43,15 @@ bool Transcoder::Start()
 
 	TranscodeGPU::GetInstance()->Initialize();
 
+	auto worker_pool_config = cfg::ConfigManager::GetInstance()->GetServer()->GetModules().GetTranscoderWorkerPool();
+	if (worker_pool_config.IsEnabled() == true)
+	{
+		if (TranscodeWorkerPool::GetInstance()->Initialize(worker_pool_config.GetWorkerCount()) == false)
+		{
+			logtw("Could not start the transcoder worker pool. The dedicated threads are used.");
+		}
+	}
+
 	return true;
 }
 
@@ -49,6 +59,8 @@ bool Transcoder::Stop()
 {
 	logtd("Transcoder has been stopped");
 
+	TranscodeWorkerPool::GetInstance()->Uninitialize();
+
 	TranscodeGPU::GetInstance()->Uninitialize();
 
 	return true;
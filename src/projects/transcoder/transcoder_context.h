@@ -186,12 +186,40 @@ public:
 		return _flags;
 	}
 
+	// Returns true if the frame buffers are not shared with any other MediaFrame.
+	bool IsWritable() const
+	{
+		if (_priv_data == nullptr)
+		{
+			return false;
+		}
+
+		return (::av_frame_is_writable(_priv_data) != 0);
+	}
+
+	// Copy-on-write. If the frame buffers are shared with other MediaFrames (shallow clones),
+	// the buffers are copied so that they can be modified without affecting the others.
+	bool MakeWritable()
+	{
+		if (_priv_data == nullptr)
+		{
+			return false;
+		}
+
+		return (::av_frame_make_writable(_priv_data) == 0);
+	}
+
 	void FillZeroData()
 	{
 		if(!_priv_data) {
 			return;
 		}
 
+		if (MakeWritable() == false)
+		{
+			return;
+		}
+
 		for (int i = 0; i < AV_NUM_DATA_POINTERS; i++)
 		{
 			if(_priv_data->linesize[i] > 0)
@@ -202,6 +230,8 @@ public:
 	}
 
 	// This function should only be called before filtering 
+	// If deep_copy is false, the cloned frame shares the reference counted buffers of the source frame
+	// and should be treated as read-only. Call MakeWritable() before modifying the buffers.
 	std::shared_ptr<MediaFrame> CloneFrame(bool deep_copy = false)
 	{
 		auto frame = std::make_shared<MediaFrame>();
@@ -93,7 +93,9 @@ bool TranscodeFilter::CreateInternal()
 		"trs",
 		name.LowerCaseString());
 	_internal->SetQueueUrn(urn);
+	_internal->SetAffinityKey(_input_stream_info->GetId());
 	_internal->SetCompleteHandler(bind(&TranscodeFilter::OnComplete, this, std::placeholders::_1));
+	_internal->SetOutputBlockedHandler(bind(&TranscodeFilter::IsOutputBlocked, this));
 	_internal->SetInputTrack(_input_track);
 	_internal->SetOutputTrack(_output_track);
 
@@ -209,6 +211,21 @@ void TranscodeFilter::OnComplete(std::shared_ptr<MediaFrame> frame)
 	}
 }
 
+void TranscodeFilter::SetOutputBlockedHandler(OutputBlockedHandler output_blocked_handler)
+{
+	_output_blocked_handler = std::move(output_blocked_handler);
+}
+
+bool TranscodeFilter::IsOutputBlocked()
+{
+	if (_output_blocked_handler)
+	{
+		return _output_blocked_handler(_id);
+	}
+
+	return false;
+}
+
 cmn::Timebase TranscodeFilter::GetInputTimebase() const
 {
 	return _internal->GetInputTimebase();
@@ -22,6 +22,7 @@ class TranscodeFilter
 {
 public:
 	typedef std::function<void(int32_t, std::shared_ptr<MediaFrame>)> CompleteHandler;
+	typedef std::function<bool(int32_t)> OutputBlockedHandler;
 
 	static std::shared_ptr<TranscodeFilter> Create(
 		int32_t filter_id,
@@ -54,6 +55,9 @@ public:
 	void SetCompleteHandler(CompleteHandler complete_handler);
 	void OnComplete(std::shared_ptr<MediaFrame> frame);
 
+	void SetOutputBlockedHandler(OutputBlockedHandler output_blocked_handler);
+	bool IsOutputBlocked();
+
 private:
 	bool CreateInternal();
 	bool IsNeedUpdate(std::shared_ptr<MediaFrame> buffer);
@@ -69,6 +73,7 @@ private:
 	std::shared_ptr<MediaTrack> _output_track;
 
 	CompleteHandler _complete_handler;
+	OutputBlockedHandler _output_blocked_handler;
 
 	std::shared_mutex _mutex;
 	std::shared_ptr<FilterBase> _internal;
@@ -144,7 +144,10 @@ bool TranscoderStream::Stop()
 	
 	_link_input_to_decoder.clear();
 	_link_decoder_to_filters.clear();
-	_link_filter_to_encoder.clear();
+	{
+		std::unique_lock<std::shared_mutex> link_lock(_link_filter_to_encoder_mutex);
+		_link_filter_to_encoder.clear();
+	}
 	_link_encoder_to_outputs.clear();
 
 	// Delete all last decoded frame information
@@ -323,6 +326,9 @@ void TranscoderStream::RemoveFilters()
 	auto filters = _filters;
 	_filters.clear();
 
+	_link_filter_to_filters.clear();
+	_link_filter_to_parent.clear();
+
 	filter_lock.unlock();
 
 	for (auto &[id, object] : filters)
@@ -843,7 +849,10 @@ size_t TranscoderStream::BuildComposite()
 				}
 
 				// Encoding: Filter(1) -> Encoder (1)
-				_link_filter_to_encoder[filter_id] = encoder_id;
+				{
+					std::unique_lock<std::shared_mutex> link_lock(_link_filter_to_encoder_mutex);
+					_link_filter_to_encoder[filter_id] = encoder_id;
+				}
 
 				// Flushing: Encoder(1) -> OutputTrack (N)
 				_link_encoder_to_outputs[encoder_id].push_back(output_stream_and_track);
@@ -900,9 +909,10 @@ ov::String TranscoderStream::GetInfoStringComposite()
 				{
 					debug_log.AppendFormat("    + Filter(%u)\n", filter_id);
 
-					if (_link_filter_to_encoder.find(filter_id) != _link_filter_to_encoder.end())
+					auto linked_encoder_id = GetEncoderIdOfFilter(filter_id);
+					if (linked_encoder_id.has_value())
 					{
-						auto encoder_id = _link_filter_to_encoder[filter_id];
+						auto encoder_id = linked_encoder_id.value();
 						debug_log.AppendFormat("      + Encoder(%d)\n", encoder_id);
 
 						if (_link_encoder_to_outputs.find(encoder_id) != _link_encoder_to_outputs.end())
@@ -1136,6 +1146,7 @@ bool TranscoderStream::CreateEncoder(MediaTrackId encoder_id, std::shared_ptr<in
 
 			return false;
 		}
+		post_filter->SetOutputBlockedHandler(bind(&TranscoderStream::IsPostFilterOutputBlocked, this, std::placeholders::_1));
 	}
 
 	SetPostFilterAndEncoder(encoder_id, post_filter, encoder);
@@ -1198,11 +1209,24 @@ size_t TranscoderStream::CreateFilters(std::shared_ptr<MediaFrame> buffer)
 		return 0;
 	}
 
-	// 2. Get Output Track of Encoders
+	// 2. Build scaling tree of the filters (1080p -> 720p -> 480p -> 360p)
+	if (GetOutputProfilesCfg()->IsCascadedScaling() == true)
+	{
+		BuildCascadedFilters(decoder_id);
+	}
+
+	// 3. Get Output Track of Encoders
 	auto filter_ids = decoder_to_filters_it->second;
 	for (auto &filter_id : filter_ids)
 	{
-		MediaTrackId encoder_id = _link_filter_to_encoder[filter_id];
+		auto linked_encoder_id = GetEncoderIdOfFilter(filter_id);
+		if (linked_encoder_id.has_value() == false)
+		{
+			logte("%s Failed to create filter. could not found encoder linked to the filter. Filter(%d)", _log_prefix.CStr(), filter_id);
+			continue;
+		}
+
+		MediaTrackId encoder_id = linked_encoder_id.value();
 		auto encoder = GetEncoder(encoder_id);
 		if(encoder == nullptr)
 		{
@@ -1218,6 +1242,27 @@ size_t TranscoderStream::CreateFilters(std::shared_ptr<MediaFrame> buffer)
 		}
 
 		auto input_track = decoder->GetRefTrack();
+
+		// In cascaded scaling, the output track of the parent filter is used as the input track
+		std::shared_lock<std::shared_mutex> filter_lock(_filter_map_mutex);
+		auto parent_it = _link_filter_to_parent.find(filter_id);
+		std::optional<MediaTrackId> parent_filter_id;
+		if (parent_it != _link_filter_to_parent.end())
+		{
+			parent_filter_id = parent_it->second;
+		}
+		filter_lock.unlock();
+
+		if (parent_filter_id.has_value())
+		{
+			auto parent_encoder_id = GetEncoderIdOfFilter(parent_filter_id.value());
+			auto parent_encoder = parent_encoder_id.has_value() ? GetEncoder(parent_encoder_id.value()) : nullptr;
+			if (parent_encoder != nullptr)
+			{
+				input_track = parent_encoder->GetRefTrack();
+			}
+		}
+
 		auto output_track = encoder->GetRefTrack();
 		if(input_track == nullptr || output_track == nullptr)
 		{
@@ -1262,6 +1307,7 @@ bool TranscoderStream::CreateFilter(MediaTrackId filter_id, std::shared_ptr<Medi
 		logte("%s Failed to create filter. Filter(%d)", _log_prefix.CStr(), filter_id);
 		return false;
 	}
+	filter->SetOutputBlockedHandler(bind(&TranscoderStream::IsPreFilterOutputBlocked, this, std::placeholders::_1));
 
 	SetFilter(filter_id, filter);
 
@@ -1270,6 +1316,112 @@ bool TranscoderStream::CreateFilter(MediaTrackId filter_id, std::shared_ptr<Medi
 	return true;
 }
 
+void TranscoderStream::BuildCascadedFilters(MediaTrackId decoder_id)
+{
+	auto decoder_to_filters_it = _link_decoder_to_filters.find(decoder_id);
+	if (decoder_to_filters_it == _link_decoder_to_filters.end())
+	{
+		return;
+	}
+
+	auto &filter_ids = decoder_to_filters_it->second;
+
+	// If the filters already exist, they are reused with the previously built tree.
+	std::vector<std::pair<MediaTrackId, std::shared_ptr<MediaTrack>>> candidates;
+	for (auto &filter_id : filter_ids)
+	{
+		if (GetFilter(filter_id) != nullptr)
+		{
+			return;
+		}
+
+		auto encoder_id = GetEncoderIdOfFilter(filter_id);
+		auto encoder = encoder_id.has_value() ? GetEncoder(encoder_id.value()) : nullptr;
+		if (encoder == nullptr || encoder->GetRefTrack() == nullptr)
+		{
+			continue;
+		}
+
+		if (encoder->GetRefTrack()->GetMediaType() != cmn::MediaType::Video)
+		{
+			continue;
+		}
+
+		candidates.emplace_back(filter_id, encoder->GetRefTrack());
+	}
+
+	// Sort in descending order of resolution
+	std::stable_sort(candidates.begin(), candidates.end(), [](const auto &a, const auto &b) {
+		return ((int64_t)a.second->GetWidth() * a.second->GetHeight()) > ((int64_t)b.second->GetWidth() * b.second->GetHeight());
+	});
+
+	std::unique_lock<std::shared_mutex> lock(_filter_map_mutex);
+
+	for (auto &filter_id : filter_ids)
+	{
+		_link_filter_to_filters.erase(filter_id);
+		_link_filter_to_parent.erase(filter_id);
+	}
+
+	for (size_t i = 1; i < candidates.size(); i++)
+	{
+		auto &[child_id, child_track] = candidates[i];
+
+		// Find the nearest larger rendition
+		for (size_t j = i; j-- > 0;)
+		{
+			auto &[parent_id, parent_track] = candidates[j];
+
+			if (IsCascadableScaling(parent_track, child_track) == false)
+			{
+				continue;
+			}
+
+			_link_filter_to_filters[parent_id].push_back(child_id);
+			_link_filter_to_parent[child_id] = parent_id;
+
+			logtd("%s Cascaded scaling. Filter(%d, %dx%d) -> Filter(%d, %dx%d)",
+				  _log_prefix.CStr(),
+				  parent_id, parent_track->GetWidth(), parent_track->GetHeight(),
+				  child_id, child_track->GetWidth(), child_track->GetHeight());
+			break;
+		}
+	}
+}
+
+bool TranscoderStream::IsCascadedFilter(MediaTrackId filter_id)
+{
+	std::shared_lock<std::shared_mutex> lock(_filter_map_mutex);
+
+	return (_link_filter_to_parent.find(filter_id) != _link_filter_to_parent.end());
+}
+
+std::vector<MediaTrackId> TranscoderStream::GetChildFilters(MediaTrackId filter_id)
+{
+	std::shared_lock<std::shared_mutex> lock(_filter_map_mutex);
+
+	auto it = _link_filter_to_filters.find(filter_id);
+	if (it == _link_filter_to_filters.end())
+	{
+		return {};
+	}
+
+	return it->second;
+}
+
+std::optional<MediaTrackId> TranscoderStream::GetEncoderIdOfFilter(MediaTrackId filter_id)
+{
+	std::shared_lock<std::shared_mutex> lock(_link_filter_to_encoder_mutex);
+
+	auto it = _link_filter_to_encoder.find(filter_id);
+	if (it == _link_filter_to_encoder.end())
+	{
+		return std::nullopt;
+	}
+
+	return it->second;
+}
+
 std::shared_ptr<TranscodeFilter> TranscoderStream::GetFilter(MediaTrackId filter_id)
 {
 	std::shared_lock<std::shared_mutex> lock(_filter_map_mutex);
@@ -1605,7 +1757,8 @@ void TranscoderStream::OnDecodedFrame(TranscodeResult result, MediaTrackId decod
 
 					for (int64_t filler_pts = start_pts; filler_pts < end_pts; filler_pts += duration_per_frame)
 					{
-						std::shared_ptr<MediaFrame> clone_frame = decoded_frame->CloneFrame(true);
+						// The buffers are copied only when the filler frame is modified (FillZeroData)
+						std::shared_ptr<MediaFrame> clone_frame = decoded_frame->CloneFrame(false);
 						if (!clone_frame)
 						{
 							continue;
@@ -1699,18 +1852,24 @@ std::shared_ptr<MediaTrack> TranscoderStream::GetInputTrackOfFilter(MediaTrackId
 	}
 
 	auto filter_ids = decoder_to_filter_map_it->second;
-	if (filter_ids.size() == 0)
+	for (auto &filter_id : filter_ids)
 	{
-		return nullptr;
-	}
+		// The input of cascaded filter is not the decoder
+		if (IsCascadedFilter(filter_id) == true)
+		{
+			continue;
+		}
 
-	auto filter = GetFilter(filter_ids[0]);
-	if (filter == nullptr)
-	{
-		return nullptr;
+		auto filter = GetFilter(filter_id);
+		if (filter == nullptr)
+		{
+			return nullptr;
+		}
+
+		return filter->GetInputTrack();
 	}
 
-	return filter->GetInputTrack();
+	return nullptr;
 }
 
 TranscodeResult TranscoderStream::PreFilterFrame(MediaTrackId filter_id, std::shared_ptr<MediaFrame> decoded_frame)
@@ -1737,22 +1896,43 @@ void TranscoderStream::OnPreFilteredFrame(MediaTrackId filter_id, std::shared_pt
 		return;
 	}
 
+	// Cascaded scaling. The rescaled frame is used as the input of the smaller renditions.
+	SpreadToChildFilters(filter_id, filtered_frame);
+
 	filtered_frame->SetTrackId(filter_id);
 
 	PostFilterFrame(std::move(filtered_frame));
 }
 
+bool TranscoderStream::IsPreFilterOutputBlocked(MediaTrackId filter_id)
+{
+	auto linked_encoder_id = GetEncoderIdOfFilter(filter_id);
+	if (linked_encoder_id.has_value() == false)
+	{
+		return false;
+	}
+	auto encoder_id = linked_encoder_id.value();
+
+	// The pre-encode filter doesn't wait, it checks the encoder by itself
+	if (GetPostFilter(encoder_id) != nullptr)
+	{
+		return false;
+	}
+
+	return IsPostFilterOutputBlocked(encoder_id);
+}
+
 TranscodeResult TranscoderStream::PostFilterFrame(std::shared_ptr<MediaFrame> frame)
 {
 	auto filter_id = frame->GetTrackId();
 
 	// Get Encoder ID form Filter ID
-	auto filter_to_encoder_it = _link_filter_to_encoder.find(filter_id);
-	if (filter_to_encoder_it == _link_filter_to_encoder.end())
+	auto linked_encoder_id = GetEncoderIdOfFilter(filter_id);
+	if (linked_encoder_id.has_value() == false)
 	{
 		return TranscodeResult::NoData;
 	}
-	auto encoder_id = filter_to_encoder_it->second;
+	auto encoder_id = linked_encoder_id.value();
 
 	// If the encoder has a pre-encode filter, it is passed to the filter.
 	auto post_filter = GetPostFilter(encoder_id);
@@ -1781,6 +1961,17 @@ void TranscoderStream::OnPostFilteredFrame(MediaTrackId encoder_id, std::shared_
 	EncodeFrame(std::move(filtered_frame));
 }
 
+bool TranscoderStream::IsPostFilterOutputBlocked(MediaTrackId encoder_id)
+{
+	auto encoder = GetEncoder(encoder_id);
+	if (encoder == nullptr)
+	{
+		return false;
+	}
+
+	return encoder->IsInputBufferFull();
+}
+
 TranscodeResult TranscoderStream::EncodeFrame(std::shared_ptr<const MediaFrame> frame)
 {
 	auto encoder_id = frame->GetTrackId();
@@ -1873,7 +2064,16 @@ void TranscoderStream::SpreadToFilters(MediaTrackId decoder_id, std::shared_ptr<
 
 	for (auto &filter_id : filter_ids)
 	{
-		auto frame_clone = frame->CloneFrame(true);
+		// The cascaded filters receive the frame from the parent filter
+		if (IsCascadedFilter(filter_id) == true)
+		{
+			continue;
+		}
+
+		// All filters share the decoded frame buffers. The filters only read from the frame, 
+		// so only the frame properties(pts, duration, etc) are cloned for each filter.
+		// If a filter needs to modify the buffers, it should call MakeWritable() (copy-on-write).
+		auto frame_clone = frame->CloneFrame(false);
 		if (frame_clone == nullptr)
 		{
 			logte("%s Failed to clone frame", _log_prefix.CStr());
@@ -1885,6 +2085,23 @@ void TranscoderStream::SpreadToFilters(MediaTrackId decoder_id, std::shared_ptr<
 	}
 }
 
+void TranscoderStream::SpreadToChildFilters(MediaTrackId filter_id, const std::shared_ptr<MediaFrame> &frame)
+{
+	auto child_filter_ids = GetChildFilters(filter_id);
+
+	for (auto &child_filter_id : child_filter_ids)
+	{
+		auto frame_clone = frame->CloneFrame(false);
+		if (frame_clone == nullptr)
+		{
+			logte("%s Failed to clone frame", _log_prefix.CStr());
+
+			continue;
+		}
+
+		PreFilterFrame(child_filter_id, std::move(frame_clone));
+	}
+}
 
 void TranscoderStream::NotifyCreateStreams()
 {
@@ -132,6 +132,8 @@ private:
 	std::shared_mutex _decoder_map_mutex;
 	std::shared_mutex _filter_map_mutex;
 	std::shared_mutex _encoder_map_mutex;
+	// _link_filter_to_encoder is read by the filter threads (PostFilterFrame, IsPreFilterOutputBlocked)
+	std::shared_mutex _link_filter_to_encoder_mutex;
 
 
 	const info::Application _application_info;
@@ -176,6 +178,12 @@ private:
 	// [FILTER_ID, ENCODER_ID]
 	std::map<MediaTrackId, MediaTrackId> _link_filter_to_encoder;
 
+	// Cascaded scaling. The output of the parent filter is used as the input of the child filters.
+	// [PARENT_FILTER_ID, CHILD_FILTER_IDS]
+	std::map<MediaTrackId, std::vector<MediaTrackId>> _link_filter_to_filters;
+	// [CHILD_FILTER_ID, PARENT_FILTER_ID]
+	std::map<MediaTrackId, MediaTrackId> _link_filter_to_parent;
+
 	// [ENCODER_ID, OUTPUT_TRACK_ID]
 	std::map<MediaTrackId, std::vector<std::pair<std::shared_ptr<info::Stream>, MediaTrackId>>> _link_encoder_to_outputs;
 
@@ -234,6 +242,13 @@ private:
 
 	std::shared_ptr<MediaTrack> GetInputTrackOfFilter(MediaTrackId decoder_id);
 
+	// Cascaded scaling (1080p -> 720p -> 480p -> 360p)
+	void BuildCascadedFilters(MediaTrackId decoder_id);
+	bool IsCascadedFilter(MediaTrackId filter_id);
+	std::vector<MediaTrackId> GetChildFilters(MediaTrackId filter_id);
+	// Returns the ID of the encoder fed by the filter
+	std::optional<MediaTrackId> GetEncoderIdOfFilter(MediaTrackId filter_id);
+
 	size_t CreateEncoders(std::shared_ptr<MediaFrame> buffer);
 	bool CreateEncoder(MediaTrackId encoder_id, std::shared_ptr<info::Stream> output_stream, std::shared_ptr<MediaTrack> output_track);
 	std::optional<std::pair<std::shared_ptr<TranscodeFilter>, std::shared_ptr<TranscodeEncoder>>> GetEncoderSet(MediaTrackId encoder_id);
@@ -262,11 +277,15 @@ private:
 
 	// Step 2: Filter (resample/rescale the decoded frame)
 	void SpreadToFilters(MediaTrackId decoder_id, std::shared_ptr<MediaFrame> frame);
+	void SpreadToChildFilters(MediaTrackId filter_id, const std::shared_ptr<MediaFrame> &frame);
 	TranscodeResult PreFilterFrame(MediaTrackId track_id, std::shared_ptr<MediaFrame> frame);
 	void OnPreFilteredFrame(MediaTrackId filter_id, std::shared_ptr<MediaFrame> decoded_frame);
+	// Returns true if the encoder fed by the filter is full (the filter should not wait for it)
+	bool IsPreFilterOutputBlocked(MediaTrackId filter_id);
 
 	TranscodeResult PostFilterFrame(std::shared_ptr<MediaFrame> frame);
 	void OnPostFilteredFrame(MediaTrackId filter_id, std::shared_ptr<MediaFrame> decoded_frame);
+	bool IsPostFilterOutputBlocked(MediaTrackId encoder_id);
 
 	// Step 3: Encode (Encode the filtered frame to packets)
 	TranscodeResult EncodeFrame(std::shared_ptr<const MediaFrame> frame);
@@ -650,6 +650,76 @@ double TranscoderStreamInternal::MeasurementToRecommendFramerate(double framerat
 	return ::floor(recommend_framerate);
 }
 
+bool TranscoderStreamInternal::IsCascadableScaling(const std::shared_ptr<MediaTrack> &parent_output_track, const std::shared_ptr<MediaTrack> &child_output_track)
+{
+	if (parent_output_track == nullptr || child_output_track == nullptr)
+	{
+		return false;
+	}
+
+	if (parent_output_track->GetMediaType() != cmn::MediaType::Video ||
+		child_output_track->GetMediaType() != cmn::MediaType::Video)
+	{
+		return false;
+	}
+
+	// Only the modules that process frames in CPU memory are supported.
+	// The frames of the hardware modules(NVENC, XMA) are located in device memory and use dedicated scalers.
+	auto is_cpu_memory_module = [](cmn::MediaCodecModuleId module_id) -> bool {
+		switch (module_id)
+		{
+			case cmn::MediaCodecModuleId::DEFAULT:
+			case cmn::MediaCodecModuleId::BEAMR:
+			case cmn::MediaCodecModuleId::OPENH264:
+			case cmn::MediaCodecModuleId::X264:
+			case cmn::MediaCodecModuleId::QSV:
+			case cmn::MediaCodecModuleId::LIBVPX:
+			case cmn::MediaCodecModuleId::NILOGAN:
+				return true;
+			default:
+				break;
+		}
+
+		return false;
+	};
+
+	if (is_cpu_memory_module(parent_output_track->GetCodecModuleId()) == false ||
+		is_cpu_memory_module(child_output_track->GetCodecModuleId()) == false)
+	{
+		return false;
+	}
+
+	// Resolution should be downscaled only
+	if (child_output_track->GetWidth() > parent_output_track->GetWidth() ||
+		child_output_track->GetHeight() > parent_output_track->GetHeight())
+	{
+		return false;
+	}
+
+	if ((int64_t)child_output_track->GetWidth() * child_output_track->GetHeight() >=
+		(int64_t)parent_output_track->GetWidth() * parent_output_track->GetHeight())
+	{
+		return false;
+	}
+
+	// The parent should not skip frames dynamically. Otherwise, the frames of the child are also dropped.
+	if (parent_output_track->GetSkipFramesByConfig() >= 0)
+	{
+		return false;
+	}
+
+	// The framerate of the child should not be higher than the parent.
+	// If the framerate of the parent is not set, it follows the framerate of the input.
+	auto parent_framerate = parent_output_track->GetFrameRateByConfig();
+	auto child_framerate = child_output_track->GetFrameRateByConfig();
+	if (parent_framerate > 0.0f && (child_framerate == 0.0f || child_framerate > parent_framerate))
+	{
+		return false;
+	}
+
+	return true;
+}
+
 void TranscoderStreamInternal::UpdateOutputTrackPassthrough(const std::shared_ptr<MediaTrack> &output_track, std::shared_ptr<MediaFrame> buffer)
 {
 	if (output_track->GetMediaType() == cmn::MediaType::Video)
@@ -44,6 +44,9 @@ public:
 	bool IsMatchesBypassCondition(const std::shared_ptr<MediaTrack> &input_track, const cfg::vhost::app::oprf::VideoProfile &profile);
 	bool IsMatchesBypassCondition(const std::shared_ptr<MediaTrack> &input_track, const cfg::vhost::app::oprf::AudioProfile &profile);
 
+	// Checks whether the output of the parent rescaler can be used as the input of the child rescaler.
+	static bool IsCascadableScaling(const std::shared_ptr<MediaTrack> &parent_output_track, const std::shared_ptr<MediaTrack> &child_output_track);
+
 	double GetProperFramerate(const std::shared_ptr<MediaTrack> &ref_track);
 	static double MeasurementToRecommendFramerate(double framerate);
 
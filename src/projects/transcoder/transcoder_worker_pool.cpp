@@ -0,0 +1,381 @@
+//==============================================================================
+//
+//  TranscodeWorkerPool
+//
+//  Created by Keukhan
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#include "transcoder_worker_pool.h"
+
+#include <time.h>
+
+#include "transcoder_private.h"
+
+// Maximum number of jobs processed at once by a task. Other tasks of the worker are executed after that.
+#define MAX_JOBS_PER_RUN 8
+// Idle workers wake up at this interval to steal tasks from other workers
+#define STEAL_INTERVAL_IN_MSEC 10
+// Blocked tasks are retried after this interval
+#define BLOCKED_TASK_RETRY_INTERVAL_IN_MSEC 5
+
+static int64_t GetThreadCpuTimeUs()
+{
+	struct timespec ts;
+
+	if (::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+	{
+		return 0;
+	}
+
+	return (static_cast<int64_t>(ts.tv_sec) * 1000000LL) + (ts.tv_nsec / 1000LL);
+}
+
+TranscodeWorkerPool::Task::Task(TranscodeWorkerPool *pool, const ov::String &name, uint32_t affinity_key, Handler handler)
+	: _pool(pool),
+	  _name(name),
+	  _affinity_key(affinity_key),
+	  _handler(std::move(handler))
+{
+	_metrics = MonitorInstance->GetServerMetrics()->OnWorkerCreated(mon::WorkerMetrics::Type::Task, _name);
+}
+
+TranscodeWorkerPool::Task::~Task()
+{
+	MonitorInstance->GetServerMetrics()->OnWorkerDeleted(_metrics);
+}
+
+void TranscodeWorkerPool::Task::Schedule()
+{
+	auto state = _state.load();
+
+	while (true)
+	{
+		switch (state)
+		{
+			case State::Idle:
+				if (_state.compare_exchange_weak(state, State::Scheduled))
+				{
+					_pool->Push(GetSharedPtr());
+					return;
+				}
+				break;
+
+			case State::Running:
+				// The worker will schedule the task again after running
+				if (_state.compare_exchange_weak(state, State::RunningNotified))
+				{
+					return;
+				}
+				break;
+
+			case State::Scheduled:
+			case State::RunningNotified:
+			case State::Stopped:
+				return;
+		}
+	}
+}
+
+void TranscodeWorkerPool::Task::Stop()
+{
+	std::unique_lock<std::mutex> lock(_run_mutex);
+
+	auto state = _state.load();
+
+	while (state != State::Stopped)
+	{
+		if (state == State::Running || state == State::RunningNotified)
+		{
+			// Wait until the worker completes the job
+			_run_condition.wait(lock);
+			state = _state.load();
+			continue;
+		}
+
+		_state.compare_exchange_weak(state, State::Stopped);
+	}
+}
+
+TranscodeWorkerPool::Task::Result TranscodeWorkerPool::Task::Run(int max_jobs)
+{
+	auto state = State::Scheduled;
+	if (_state.compare_exchange_strong(state, State::Running) == false)
+	{
+		// Stopped
+		return Result::Idle;
+	}
+
+	auto start_cpu_time = GetThreadCpuTimeUs();
+
+	auto result = Result::Idle;
+	for (int i = 0; i < max_jobs; i++)
+	{
+		result = _handler();
+		if (result != Result::Processed)
+		{
+			break;
+		}
+	}
+
+	if (_metrics != nullptr)
+	{
+		_metrics->OnExecuted(GetThreadCpuTimeUs() - start_cpu_time);
+	}
+
+	std::lock_guard<std::mutex> lock(_run_mutex);
+
+	// If there are remaining jobs or new jobs are queued while running, the task should be scheduled again.
+	// A blocked task stays scheduled until it is retried, so Schedule() doesn't push it twice.
+	state = State::Running;
+	if (result != Result::Idle)
+	{
+		_state = State::Scheduled;
+	}
+	else if (_state.compare_exchange_strong(state, State::Idle) == false)
+	{
+		// State::RunningNotified
+		_state = State::Scheduled;
+		result = Result::Processed;
+	}
+
+	_run_condition.notify_all();
+
+	return result;
+}
+
+TranscodeWorkerPool::~TranscodeWorkerPool()
+{
+	Uninitialize();
+}
+
+bool TranscodeWorkerPool::Initialize(int32_t worker_count)
+{
+	if (_running == true)
+	{
+		return true;
+	}
+
+	if (worker_count <= 0)
+	{
+		worker_count = std::max(1U, std::thread::hardware_concurrency());
+	}
+
+	_running = true;
+
+	for (int32_t index = 0; index < worker_count; index++)
+	{
+		auto worker = std::make_unique<Worker>();
+
+		worker->index = index;
+		worker->metrics = MonitorInstance->GetServerMetrics()->OnWorkerCreated(mon::WorkerMetrics::Type::Worker, ov::String::FormatString("trs_worker_%d", index));
+
+		_workers.push_back(std::move(worker));
+	}
+
+	for (auto &worker : _workers)
+	{
+		try
+		{
+			worker->thread = std::thread(&TranscodeWorkerPool::WorkerThread, this, worker.get());
+			pthread_setname_np(worker->thread.native_handle(), ov::String::FormatString("TRS-Worker-%zu", worker->index).CStr());
+		}
+		catch (const std::system_error &e)
+		{
+			logte("Failed to start transcoder worker thread");
+
+			Uninitialize();
+
+			return false;
+		}
+	}
+
+	logti("Transcoder worker pool has been started. workers(%d)", worker_count);
+
+	return true;
+}
+
+bool TranscodeWorkerPool::Uninitialize()
+{
+	if (_running == false)
+	{
+		return true;
+	}
+
+	_running = false;
+
+	for (auto &worker : _workers)
+	{
+		{
+			std::lock_guard<std::mutex> lock(worker->mutex);
+			worker->condition.notify_all();
+		}
+
+		if (worker->thread.joinable())
+		{
+			worker->thread.join();
+		}
+
+		worker->tasks.clear();
+		worker->blocked_tasks.clear();
+
+		MonitorInstance->GetServerMetrics()->OnWorkerDeleted(worker->metrics);
+	}
+
+	_workers.clear();
+
+	logti("Transcoder worker pool has been stopped");
+
+	return true;
+}
+
+std::shared_ptr<TranscodeWorkerPool::Task> TranscodeWorkerPool::CreateTask(const ov::String &name, uint32_t affinity_key, Task::Handler handler)
+{
+	if (_running == false)
+	{
+		return nullptr;
+	}
+
+	return std::make_shared<Task>(this, name, affinity_key, std::move(handler));
+}
+
+void TranscodeWorkerPool::Push(const std::shared_ptr<Task> &task)
+{
+	if (_workers.empty())
+	{
+		return;
+	}
+
+	Push(_workers[task->GetAffinityKey() % _workers.size()].get(), task);
+}
+
+void TranscodeWorkerPool::Push(Worker *worker, const std::shared_ptr<Task> &task)
+{
+	std::lock_guard<std::mutex> lock(worker->mutex);
+
+	worker->tasks.push_back(task);
+	worker->metrics->SetQueueSize(worker->tasks.size());
+
+	worker->condition.notify_one();
+}
+
+std::shared_ptr<TranscodeWorkerPool::Task> TranscodeWorkerPool::Pop(Worker *worker, bool wait)
+{
+	std::unique_lock<std::mutex> lock(worker->mutex);
+
+	if (worker->tasks.empty())
+	{
+		if (wait == false)
+		{
+			return nullptr;
+		}
+
+		worker->condition.wait_for(lock, std::chrono::milliseconds(STEAL_INTERVAL_IN_MSEC), [this, worker]() -> bool {
+			return (worker->tasks.empty() == false) || (_running == false);
+		});
+
+		if (worker->tasks.empty())
+		{
+			return nullptr;
+		}
+	}
+
+	auto task = std::move(worker->tasks.front());
+	worker->tasks.pop_front();
+	worker->metrics->SetQueueSize(worker->tasks.size());
+
+	return task;
+}
+
+std::shared_ptr<TranscodeWorkerPool::Task> TranscodeWorkerPool::Steal(Worker *thief)
+{
+	auto worker_count = _workers.size();
+
+	for (size_t i = 1; i < worker_count; i++)
+	{
+		auto victim = _workers[(thief->index + i) % worker_count].get();
+
+		std::unique_lock<std::mutex> lock(victim->mutex, std::try_to_lock);
+		if (lock.owns_lock() == false || victim->tasks.empty())
+		{
+			continue;
+		}
+
+		// Steal from the back to keep the order of the victim as much as possible
+		auto task = std::move(victim->tasks.back());
+		victim->tasks.pop_back();
+		victim->metrics->SetQueueSize(victim->tasks.size());
+
+		thief->metrics->IncreaseStealCount();
+
+		return task;
+	}
+
+	return nullptr;
+}
+
+void TranscodeWorkerPool::RetryBlockedTasks(Worker *worker)
+{
+	if (worker->blocked_tasks.empty())
+	{
+		return;
+	}
+
+	auto now = std::chrono::steady_clock::now();
+
+	for (auto it = worker->blocked_tasks.begin(); it != worker->blocked_tasks.end();)
+	{
+		if (it->first > now)
+		{
+			++it;
+			continue;
+		}
+
+		Push(worker, it->second);
+		it = worker->blocked_tasks.erase(it);
+	}
+}
+
+void TranscodeWorkerPool::WorkerThread(Worker *worker)
+{
+	while (_running)
+	{
+		RetryBlockedTasks(worker);
+
+		auto task = Pop(worker, false);
+		if (task == nullptr)
+		{
+			task = Steal(worker);
+		}
+
+		if (task == nullptr)
+		{
+			task = Pop(worker, true);
+		}
+
+		if (task == nullptr)
+		{
+			continue;
+		}
+
+		auto start_cpu_time = GetThreadCpuTimeUs();
+
+		switch (task->Run(MAX_JOBS_PER_RUN))
+		{
+			case Task::Result::Processed:
+				// Jobs are remaining. Run the other tasks first.
+				Push(task);
+				break;
+
+			case Task::Result::Blocked:
+				// Run the other tasks while the next stage of the task is full
+				worker->blocked_tasks.emplace_back(std::chrono::steady_clock::now() + std::chrono::milliseconds(BLOCKED_TASK_RETRY_INTERVAL_IN_MSEC), task);
+				break;
+
+			case Task::Result::Idle:
+				break;
+		}
+
+		worker->metrics->OnExecuted(GetThreadCpuTimeUs() - start_cpu_time);
+	}
+}
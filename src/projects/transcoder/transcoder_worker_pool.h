@@ -0,0 +1,137 @@
+//==============================================================================
+//
+//  TranscodeWorkerPool
+//
+//  Created by Keukhan
+//  Copyright (c) 2024 AirenSoft. All rights reserved.
+//
+//==============================================================================
+#pragma once
+
+#include <base/ovlibrary/ovlibrary.h>
+#include <monitoring/monitoring.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <thread>
+
+// Shared worker pool of the transcoder.
+//
+// - A task is executed by only one worker at a time, so the jobs of a task are processed in order.
+// - The task is assigned to a worker by the affinity key(e.g. stream id). The tasks of the same stream run on the same worker.
+// - When a worker has no tasks to run, it steals a task from the other workers.
+// - A task whose next stage is full is retried later instead of blocking the worker.
+class TranscodeWorkerPool : public ov::Singleton<TranscodeWorkerPool>
+{
+public:
+	class Task : public ov::EnableSharedFromThis<Task>
+	{
+		friend class TranscodeWorkerPool;
+
+	public:
+		enum class Result : uint8_t
+		{
+			// There is no job to process
+			Idle,
+			// A job has been processed
+			Processed,
+			// The job cannot be processed without waiting for the next stage. The task is retried after a while.
+			Blocked
+		};
+
+		typedef std::function<Result()> Handler;
+
+		Task(TranscodeWorkerPool *pool, const ov::String &name, uint32_t affinity_key, Handler handler);
+		~Task() override;
+
+		// Notify that a new job has been queued
+		void Schedule();
+
+		// Wait until the running job is completed. After this call, the handler is never called.
+		void Stop();
+
+		const ov::String &GetName() const
+		{
+			return _name;
+		}
+
+		uint32_t GetAffinityKey() const
+		{
+			return _affinity_key;
+		}
+
+	private:
+		enum class State : uint8_t
+		{
+			Idle,
+			Scheduled,
+			Running,
+			// Schedule() is called while running
+			RunningNotified,
+			Stopped
+		};
+
+		// Called by worker. Returns Idle if the task doesn't need to be scheduled again.
+		Result Run(int max_jobs);
+
+		TranscodeWorkerPool *_pool = nullptr;
+		ov::String _name;
+		uint32_t _affinity_key = 0;
+		Handler _handler;
+
+		std::atomic<State> _state{State::Idle};
+		std::mutex _run_mutex;
+		std::condition_variable _run_condition;
+
+		std::shared_ptr<mon::WorkerMetrics> _metrics;
+	};
+
+public:
+	TranscodeWorkerPool() = default;
+	~TranscodeWorkerPool() override;
+
+	// If worker_count is 0, the number of CPU cores is used
+	bool Initialize(int32_t worker_count);
+	bool Uninitialize();
+
+	bool IsRunning() const
+	{
+		return _running;
+	}
+
+	size_t GetWorkerCount() const
+	{
+		return _workers.size();
+	}
+
+	std::shared_ptr<Task> CreateTask(const ov::String &name, uint32_t affinity_key, Task::Handler handler);
+
+private:
+	struct Worker
+	{
+		size_t index = 0;
+		std::thread thread;
+
+		std::mutex mutex;
+		std::condition_variable condition;
+		std::deque<std::shared_ptr<Task>> tasks;
+
+		// Blocked tasks and the time to retry them. Only accessed by the worker thread.
+		std::vector<std::pair<std::chrono::steady_clock::time_point, std::shared_ptr<Task>>> blocked_tasks;
+
+		std::shared_ptr<mon::WorkerMetrics> metrics;
+	};
+
+	void Push(const std::shared_ptr<Task> &task);
+	void Push(Worker *worker, const std::shared_ptr<Task> &task);
+
+	std::shared_ptr<Task> Pop(Worker *worker, bool wait);
+	std::shared_ptr<Task> Steal(Worker *thief);
+	void RetryBlockedTasks(Worker *worker);
+
+	void WorkerThread(Worker *worker);
+
+	std::atomic<bool> _running{false};
+	std::vector<std::unique_ptr<Worker>> _workers;
+};